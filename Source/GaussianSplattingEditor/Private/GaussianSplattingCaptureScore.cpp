@@ -0,0 +1,194 @@
+#include "GaussianSplattingCaptureScore.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Serialization/MemoryReader.h"
+#include "Algo/Sort.h"
+
+#define LOCTEXT_NAMESPACE "GaussianSplatting"
+
+namespace
+{
+	struct FColmapCamera
+	{
+		FIntPoint Size = FIntPoint::ZeroValue;
+		FVector2f FocalLength = FVector2f::ZeroVector;
+		FVector2f PrincipalPoint = FVector2f::ZeroVector;
+	};
+
+	/** Number of parameters of the COLMAP camera models by id, see Scripts/read_write_model.py. */
+	constexpr int32 ColmapModelNumParams[] = { 3, 4, 4, 5, 8, 8, 12, 5, 4, 5, 12 };
+
+	/** Models with a single focal length: SIMPLE_PINHOLE, SIMPLE_RADIAL, RADIAL, SIMPLE_RADIAL_FISHEYE and RADIAL_FISHEYE. */
+	bool HasSingleFocalLength(int32 ModelId)
+	{
+		return ModelId == 0 || ModelId == 2 || ModelId == 3 || ModelId == 8 || ModelId == 9;
+	}
+
+	/** Same axes and scale as the PLY import: COLMAP world units are meters with Y down and Z forward. */
+	FVector3f ColmapToPointSpace(const FVector3d& Vector)
+	{
+		return FVector3f((float)Vector.X, (float)-Vector.Z, (float)-Vector.Y);
+	}
+
+	constexpr float ColmapUnitScale = 100.0f;
+
+	bool ReadColmapCameras(const FString& FilePath, TMap<int32, FColmapCamera>& OutCameras)
+	{
+		TArray<uint8> Data;
+		if (!FFileHelper::LoadFileToArray(Data, *FilePath)) {
+			return false;
+		}
+		FMemoryReader Reader(Data);
+		uint64 NumCameras = 0;
+		Reader << NumCameras;
+		for (uint64 CameraIndex = 0; CameraIndex < NumCameras && !Reader.IsError(); CameraIndex++) {
+			int32 CameraId = 0;
+			int32 ModelId = 0;
+			uint64 Width = 0;
+			uint64 Height = 0;
+			Reader << CameraId << ModelId << Width << Height;
+			if (ModelId < 0 || ModelId >= UE_ARRAY_COUNT(ColmapModelNumParams)) {
+				return false;
+			}
+			double Params[12] = {};
+			for (int32 ParamIndex = 0; ParamIndex < ColmapModelNumParams[ModelId]; ParamIndex++) {
+				Reader << Params[ParamIndex];
+			}
+			FColmapCamera& Camera = OutCameras.Add(CameraId);
+			Camera.Size = FIntPoint((int32)Width, (int32)Height);
+			if (HasSingleFocalLength(ModelId)) {
+				Camera.FocalLength = FVector2f((float)Params[0], (float)Params[0]);
+				Camera.PrincipalPoint = FVector2f((float)Params[1], (float)Params[2]);
+			}
+			else {
+				Camera.FocalLength = FVector2f((float)Params[0], (float)Params[1]);
+				Camera.PrincipalPoint = FVector2f((float)Params[2], (float)Params[3]);
+			}
+		}
+		return !Reader.IsError();
+	}
+}
+
+bool GaussianSplattingCaptureScore::LoadColmapCameras(const FString& SparseDir, TArray<FCaptureCamera>& OutCameras)
+{
+	OutCameras.Reset();
+	TMap<int32, FColmapCamera> Cameras;
+	if (!ReadColmapCameras(SparseDir / TEXT("cameras.bin"), Cameras)) {
+		UE_LOG(LogTemp, Warning, TEXT("Failed to read the COLMAP cameras in %s."), *SparseDir);
+		return false;
+	}
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *(SparseDir / TEXT("images.bin")))) {
+		UE_LOG(LogTemp, Warning, TEXT("Failed to read the COLMAP images in %s."), *SparseDir);
+		return false;
+	}
+	FMemoryReader Reader(Data);
+	uint64 NumImages = 0;
+	Reader << NumImages;
+	for (uint64 ImageIndex = 0; ImageIndex < NumImages && !Reader.IsError(); ImageIndex++) {
+		int32 ImageId = 0;
+		double Quat[4] = {};
+		double Translation[3] = {};
+		int32 CameraId = 0;
+		Reader << ImageId;
+		for (double& Value : Quat) {
+			Reader << Value;
+		}
+		for (double& Value : Translation) {
+			Reader << Value;
+		}
+		Reader << CameraId;
+		TArray<ANSICHAR> NameBytes;
+		ANSICHAR Char = 0;
+		for (Reader << Char; Char != 0 && !Reader.IsError(); Reader << Char) {
+			NameBytes.Add(Char);
+		}
+		uint64 NumPoints2D = 0;
+		Reader << NumPoints2D;
+		// Observations are x, y and a point id, which scoring does not need.
+		if (NumPoints2D > (uint64)(Reader.TotalSize() - Reader.Tell()) / 24) {
+			Reader.SetError();
+			break;
+		}
+		Reader.Seek(Reader.Tell() + (int64)NumPoints2D * 24);
+
+		const FColmapCamera* Camera = Cameras.Find(CameraId);
+		if (Camera == nullptr) {
+			continue;
+		}
+		// COLMAP stores world to camera transforms with a w, x, y, z rotation, the camera looks along +Z with +Y down.
+		const FQuat4d Rotation = FQuat4d(Quat[1], Quat[2], Quat[3], Quat[0]).GetNormalized();
+		const FVector3d Center = -Rotation.UnrotateVector(FVector3d(Translation[0], Translation[1], Translation[2]));
+		const FVector3f Forward = ColmapToPointSpace(Rotation.UnrotateVector(FVector3d::ZAxisVector));
+		const FVector3f Up = -ColmapToPointSpace(Rotation.UnrotateVector(FVector3d::YAxisVector));
+
+		const FUTF8ToTCHAR ImageName(NameBytes.GetData(), NameBytes.Num());
+		FCaptureCamera& CaptureCamera = OutCameras.AddDefaulted_GetRef();
+		CaptureCamera.ImageName = FString(ImageName.Length(), ImageName.Get());
+		CaptureCamera.View.Location = ColmapToPointSpace(Center) * ColmapUnitScale;
+		CaptureCamera.View.Rotation = FRotationMatrix44f::MakeFromXZ(Forward, Up).ToQuat();
+		CaptureCamera.View.Width = Camera->Size.X;
+		CaptureCamera.View.Height = Camera->Size.Y;
+		CaptureCamera.View.FocalLength = Camera->FocalLength;
+		CaptureCamera.View.PrincipalPoint = Camera->PrincipalPoint;
+	}
+	if (Reader.IsError()) {
+		UE_LOG(LogTemp, Warning, TEXT("COLMAP images in %s are truncated."), *SparseDir);
+		OutCameras.Reset();
+		return false;
+	}
+	Algo::SortBy(OutCameras, &FCaptureCamera::ImageName);
+	return true;
+}
+
+void GaussianSplattingCaptureScore::ScorePoints(TConstArrayView<FGaussianSplattingPoint> Points, TConstArrayView<FCaptureCamera> Cameras, const FSettings& Settings, TArray<FGaussianSplattingContributionScore>& OutScores, FStats& OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingCaptureScore::ScorePoints);
+	const double StartTime = FPlatformTime::Seconds();
+	OutStats = FStats();
+	const int32 NumPoints = Points.Num();
+	OutScores.Reset();
+	OutScores.SetNum(NumPoints);
+	const int32 NumViews = Settings.MaxViews > 0 ? FMath::Min(Settings.MaxViews, Cameras.Num()) : Cameras.Num();
+	if (NumPoints == 0 || NumViews == 0) {
+		return;
+	}
+	FScopedSlowTask SlowTask((float)NumViews, LOCTEXT("ScoreCapture", "Scoring splats against the capture views"));
+
+	TArray<float> MaxWeights;
+	TArray<float> SumWeights;
+	TArray<float> ViewSumWeights;
+	MaxWeights.SetNumZeroed(NumPoints);
+	SumWeights.SetNumZeroed(NumPoints);
+	ViewSumWeights.SetNumUninitialized(NumPoints);
+	for (int32 ViewIndex = 0; ViewIndex < NumViews; ViewIndex++) {
+		SlowTask.EnterProgressFrame(1.0f);
+		const FCaptureCamera& Camera = Cameras[(int32)((int64)ViewIndex * Cameras.Num() / NumViews)];
+		FGaussianSplattingRenderView View = Camera.View;
+		const int32 LongestSide = FMath::Max(View.Width, View.Height);
+		const float Scale = Settings.MaxResolution > 0 && LongestSide > Settings.MaxResolution ? (float)Settings.MaxResolution / LongestSide : 1.0f;
+		View.Width = FMath::Max(FMath::RoundToInt32(View.Width * Scale), 1);
+		View.Height = FMath::Max(FMath::RoundToInt32(View.Height * Scale), 1);
+		View.FocalLength *= Scale;
+		View.PrincipalPoint *= Scale;
+
+		// Every view sums into its own array first, so downscaled views count in pixels of the captured resolution.
+		FMemory::Memzero(ViewSumWeights.GetData(), NumPoints * sizeof(float));
+		GaussianSplattingSoftwareRenderer::AccumulateWeights(Points, View, MaxWeights, ViewSumWeights);
+		const float AreaScale = 1.0f / (Scale * Scale);
+		ParallelFor(TEXT("GaussianSplatting.CaptureScoreSum"), NumPoints, 65536, [&](int32 i) {
+			SumWeights[i] += ViewSumWeights[i] * AreaScale;
+		});
+	}
+
+	for (int32 i = 0; i < NumPoints; i++) {
+		OutScores[i].MaxWeight = MaxWeights[i];
+		OutScores[i].SumWeight = SumWeights[i];
+		OutStats.NumUnseen += MaxWeights[i] < 1.0f / 255.0f ? 1 : 0;
+	}
+	OutStats.NumViews = NumViews;
+	OutStats.Seconds = FPlatformTime::Seconds() - StartTime;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GaussianSplattingPointCloud.h"
+#include "GaussianSplattingSoftwareRenderer.h"
+
+/**
+ * Measures how much every splat shows in the capture a cloud was trained from. The registered cameras of the COLMAP
+ * reconstruction in the work dir are rendered with the software rasterizer, and every splat accumulates the largest and
+ * the summed blending weight it reaches in their pixels, occlusion included. Lens distortion is ignored.
+ */
+namespace GaussianSplattingCaptureScore
+{
+	struct FCaptureCamera
+	{
+		FString ImageName;
+
+		/** Pose converted to the space of imported points, with the focal lengths and principal point of the full resolution image. */
+		FGaussianSplattingRenderView View;
+	};
+
+	struct FSettings
+	{
+		/** Images larger than this on their longest side are scored at a lower resolution, sums stay in pixels of the full one. */
+		int32 MaxResolution = 1600;
+
+		/** Largest number of cameras scored, spread evenly over the capture. 0 scores all of them. */
+		int32 MaxViews = 0;
+	};
+
+	struct FStats
+	{
+		int32 NumViews = 0;
+
+		/** Splats whose blending weight never reached 1/255 in any view. */
+		int32 NumUnseen = 0;
+
+		double Seconds = 0.0;
+	};
+
+	/** Reads cameras.bin and images.bin of a binary COLMAP model, sorted by image name. Returns false with a warning when they are missing or malformed. */
+	bool LoadColmapCameras(const FString& SparseDir, TArray<FCaptureCamera>& OutCameras);
+
+	/** Scores every point over the cameras, each view is rasterized in parallel. */
+	void ScorePoints(TConstArrayView<FGaussianSplattingPoint> Points, TConstArrayView<FCaptureCamera> Cameras, const FSettings& Settings, TArray<FGaussianSplattingContributionScore>& OutScores, FStats& OutStats);
+}
@@ -0,0 +1,262 @@
+#include "GaussianSplattingCommandlet.h"
+#include "GaussianSplattingSimplifyCommandlet.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/LoaderAdapter/LoaderAdapterShape.h"
+
+namespace
+{
+	/** Prints an event of the run as one line of JSON, and appends the line to the progress file when there is one. */
+	void EmitJobEvent(const TSharedRef<FJsonObject>& Event, const FString& ProgressPath)
+	{
+		FString Line;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+		if (!FJsonSerializer::Serialize(Event, JsonWriter) || !JsonWriter->Close()) {
+			return;
+		}
+		UE_LOG(LogTemp, Display, TEXT("GaussianSplattingJob: %s"), *Line);
+		if (!ProgressPath.IsEmpty()) {
+			FFileHelper::SaveStringToFile(Line + TEXT("\n"), *ProgressPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+		}
+	}
+
+	/**
+	 * Loads a map as the editor world for the duration of a job, with all of its world partition actors, so spawning, destroying
+	 * and saving actors behave as they do in the editor. The previous editor world is restored afterwards.
+	 */
+	class FScopedJobWorld
+	{
+	public:
+		explicit FScopedJobWorld(const FString& Map)
+		{
+			UPackage* Package = LoadPackage(nullptr, *Map, LOAD_None);
+			World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+			if (World == nullptr) {
+				UE_LOG(LogTemp, Error, TEXT("Failed to load the map %s."), *Map);
+				return;
+			}
+			World->WorldType = EWorldType::Editor;
+			World->AddToRoot();
+			if (!World->bIsWorldInitialized) {
+				World->InitWorld(UWorld::InitializationValues()
+					.ShouldSimulatePhysics(false)
+					.EnableTraceCollision(false)
+					.CreateNavigation(false)
+					.CreateAISystem(false)
+					.AllowAudioPlayback(false)
+					.CreatePhysicsScene(true));
+			}
+			World->UpdateWorldComponents(true, true);
+			if (GEditor) {
+				PreviousWorld = GEditor->GetEditorWorldContext().World();
+				GEditor->GetEditorWorldContext().SetCurrentWorld(World);
+			}
+			GWorld = World;
+			if (UWorldPartition* WorldPartition = World->GetWorldPartition()) {
+				LoaderAdapter = MakeUnique<FLoaderAdapterShape>(World, WorldPartition->GetEditorWorldBounds(), TEXT("GaussianSplatting"));
+				LoaderAdapter->Load();
+			}
+		}
+
+		~FScopedJobWorld()
+		{
+			if (World == nullptr) {
+				return;
+			}
+			LoaderAdapter.Reset();
+			if (GEditor) {
+				GEditor->GetEditorWorldContext().SetCurrentWorld(PreviousWorld);
+			}
+			GWorld = PreviousWorld;
+			World->ClearWorldComponents();
+			World->CleanupWorld();
+			World->RemoveFromRoot();
+			CollectGarbage(RF_NoFlags);
+		}
+
+		UWorld* Get() const { return World; }
+
+	private:
+		UWorld* World = nullptr;
+		UWorld* PreviousWorld = nullptr;
+		TUniquePtr<FLoaderAdapterShape> LoaderAdapter;
+	};
+
+	/** An empty path keeps the plugin default system, a path that fails to load is an error. */
+	bool LoadTemplateSystem(const FString& Path, UNiagaraSystem*& OutSystem)
+	{
+		OutSystem = nullptr;
+		if (Path.IsEmpty()) {
+			return true;
+		}
+		OutSystem = LoadObject<UNiagaraSystem>(nullptr, *Path);
+		if (OutSystem == nullptr) {
+			UE_LOG(LogTemp, Error, TEXT("Failed to load the Niagara system %s."), *Path);
+		}
+		return OutSystem != nullptr;
+	}
+
+	bool RunImport(const FGaussianSplattingCommandletJob& Job, TSharedRef<FJsonObject>& OutResult)
+	{
+		if (Job.SearchDir.IsEmpty() || Job.SaveContentDir.IsEmpty()) {
+			UE_LOG(LogTemp, Error, TEXT("An import needs a SearchDir, a SaveContentDir and a Map."));
+			return false;
+		}
+		UNiagaraSystem* TemplateSystem = nullptr;
+		if (!LoadTemplateSystem(Job.TemplateSystem, TemplateSystem)) {
+			return false;
+		}
+		FScopedJobWorld World(Job.Map);
+		if (World.Get() == nullptr) {
+			return false;
+		}
+		const FGaussianSplattingImportReport Report = UGaussianSplattingEditorLibrary::ImportPointClouds(World.Get(), Job.SearchDir, Job.SaveContentDir, TemplateSystem, Job.bUseStandaloneNiagaraSystem, Job.MaxInFlightMegabytes, Job.bForceReimport);
+		FJsonObjectConverter::UStructToJsonObject(FGaussianSplattingImportReport::StaticStruct(), &Report, OutResult, 0, 0);
+		return Report.NumFiles > 0 && Report.NumClouds == Report.NumFiles;
+	}
+
+	bool RunRepartition(const FGaussianSplattingCommandletJob& Job, TSharedRef<FJsonObject>& OutResult)
+	{
+		UNiagaraSystem* TemplateSystem = nullptr;
+		if (!LoadTemplateSystem(Job.TemplateSystem, TemplateSystem)) {
+			return false;
+		}
+		FScopedJobWorld World(Job.Map);
+		if (World.Get() == nullptr) {
+			return false;
+		}
+		const FGaussianSplattingPartitionManifest Manifest = Job.bAdaptive
+			? UGaussianSplattingEditorLibrary::RepartitionPointCloudsAdaptive(World.Get(), Job.PartitionBaseName, Job.MaxPointsPerCell, Job.MaxMegabytesPerCell, Job.MaxDepth, TemplateSystem, Job.bUseStandaloneNiagaraSystem, Job.OverlapMode, Job.OverlapCellSize)
+			: UGaussianSplattingEditorLibrary::RepartitionPointClouds(World.Get(), Job.PartitionBaseName, Job.CellSize, TemplateSystem, Job.bUseStandaloneNiagaraSystem, Job.OverlapMode, Job.OverlapCellSize);
+		// The cells themselves are listed in the manifest written next to them.
+		OutResult->SetNumberField(TEXT("NumCells"), Manifest.Cells.Num());
+		OutResult->SetNumberField(TEXT("NumPoints"), Manifest.NumPoints);
+		OutResult->SetNumberField(TEXT("NumOverlapsRemoved"), Manifest.NumOverlapsRemoved);
+		return Manifest.Cells.Num() > 0;
+	}
+
+	bool RunSimplify(const FGaussianSplattingCommandletJob& Job, TSharedRef<FJsonObject>& OutResult)
+	{
+		FGaussianSplattingSimplifyReport Report;
+		const bool bSucceeded = UGaussianSplattingSimplifyCommandlet::SimplifyToAsset(Job.Source, Job.Dest, Job.Simplify, Report);
+		FJsonObjectConverter::UStructToJsonObject(FGaussianSplattingSimplifyReport::StaticStruct(), &Report, OutResult, 0, 0);
+		return bSucceeded;
+	}
+
+	/** Entries with an object name are single clouds, the other ones are content folders searched recursively. */
+	bool RunCompress(const FGaussianSplattingCommandletJob& Job, TSharedRef<FJsonObject>& OutResult)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		TArray<UGaussianSplattingPointCloud*> PointClouds;
+		bool bLoadedAll = true;
+		for (const FString& Entry : Job.PointClouds) {
+			if (Entry.Contains(TEXT("."))) {
+				UGaussianSplattingPointCloud* PointCloud = LoadObject<UGaussianSplattingPointCloud>(nullptr, *Entry);
+				if (PointCloud == nullptr) {
+					UE_LOG(LogTemp, Error, TEXT("Failed to load the point cloud %s."), *Entry);
+					bLoadedAll = false;
+					continue;
+				}
+				PointClouds.AddUnique(PointCloud);
+				continue;
+			}
+			AssetRegistry.ScanPathsSynchronous({ Entry }, true);
+			FARFilter Filter;
+			Filter.PackagePaths.Add(FName(*Entry));
+			Filter.bRecursivePaths = true;
+			Filter.ClassPaths.Add(UGaussianSplattingPointCloud::StaticClass()->GetClassPathName());
+			TArray<FAssetData> Assets;
+			AssetRegistry.GetAssets(Filter, Assets);
+			for (const FAssetData& Asset : Assets) {
+				if (UGaussianSplattingPointCloud* PointCloud = Cast<UGaussianSplattingPointCloud>(Asset.GetAsset())) {
+					PointClouds.AddUnique(PointCloud);
+				}
+			}
+		}
+		const int32 NumSaved = UGaussianSplattingEditorLibrary::CompressPointClouds(PointClouds, Job.CompressionMethod);
+		OutResult->SetNumberField(TEXT("NumClouds"), PointClouds.Num());
+		OutResult->SetNumberField(TEXT("NumSaved"), NumSaved);
+		return bLoadedAll && PointClouds.Num() > 0 && NumSaved == PointClouds.Num();
+	}
+}
+
+int32 UGaussianSplattingCommandlet::Main(const FString& Params)
+{
+	FString JobsPath;
+	if (!FParse::Value(*Params, TEXT("Jobs="), JobsPath)) {
+		UE_LOG(LogTemp, Error, TEXT("Usage: -run=GaussianSplatting -Jobs=Path/To/Jobs.json [-Progress=Path/To/Progress.jsonl] [-ContinueOnError]"));
+		return 1;
+	}
+	FString ProgressPath;
+	FParse::Value(*Params, TEXT("Progress="), ProgressPath);
+	const bool bContinueOnError = FParse::Param(*Params, TEXT("ContinueOnError"));
+
+	FString JobsString;
+	FGaussianSplattingCommandletJobFile JobFile;
+	if (!FFileHelper::LoadFileToString(JobsString, *JobsPath) || !FJsonObjectConverter::JsonObjectStringToUStruct(JobsString, &JobFile, 0, 0)) {
+		UE_LOG(LogTemp, Error, TEXT("Failed to read the jobs of %s."), *JobsPath);
+		return 1;
+	}
+	if (!ProgressPath.IsEmpty()) {
+		IFileManager::Get().Delete(*ProgressPath);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumFailed = 0;
+	int32 NumRun = 0;
+	for (int32 JobIndex = 0; JobIndex < JobFile.Jobs.Num(); JobIndex++) {
+		const FGaussianSplattingCommandletJob& Job = JobFile.Jobs[JobIndex];
+		TSharedRef<FJsonObject> StartEvent = MakeShared<FJsonObject>();
+		StartEvent->SetStringField(TEXT("Event"), TEXT("Start"));
+		StartEvent->SetNumberField(TEXT("Job"), JobIndex);
+		StartEvent->SetNumberField(TEXT("NumJobs"), JobFile.Jobs.Num());
+		StartEvent->SetStringField(TEXT("Type"), Job.Type);
+		EmitJobEvent(StartEvent, ProgressPath);
+
+		const double JobStartTime = FPlatformTime::Seconds();
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		bool bSucceeded = false;
+		if (Job.Type == TEXT("Import")) {
+			bSucceeded = RunImport(Job, Result);
+		}
+		else if (Job.Type == TEXT("Repartition")) {
+			bSucceeded = RunRepartition(Job, Result);
+		}
+		else if (Job.Type == TEXT("Simplify")) {
+			bSucceeded = RunSimplify(Job, Result);
+		}
+		else if (Job.Type == TEXT("Compress")) {
+			bSucceeded = RunCompress(Job, Result);
+		}
+		else {
+			UE_LOG(LogTemp, Error, TEXT("Unknown job type %s, expected Import, Repartition, Simplify or Compress."), *Job.Type);
+		}
+		NumRun++;
+		NumFailed += bSucceeded ? 0 : 1;
+
+		TSharedRef<FJsonObject> EndEvent = MakeShared<FJsonObject>();
+		EndEvent->SetStringField(TEXT("Event"), TEXT("End"));
+		EndEvent->SetNumberField(TEXT("Job"), JobIndex);
+		EndEvent->SetNumberField(TEXT("NumJobs"), JobFile.Jobs.Num());
+		EndEvent->SetStringField(TEXT("Type"), Job.Type);
+		EndEvent->SetBoolField(TEXT("Success"), bSucceeded);
+		EndEvent->SetNumberField(TEXT("Seconds"), FPlatformTime::Seconds() - JobStartTime);
+		EndEvent->SetObjectField(TEXT("Result"), Result);
+		EmitJobEvent(EndEvent, ProgressPath);
+		if (!bSucceeded && !bContinueOnError) {
+			break;
+		}
+	}
+
+	TSharedRef<FJsonObject> DoneEvent = MakeShared<FJsonObject>();
+	DoneEvent->SetStringField(TEXT("Event"), TEXT("Done"));
+	DoneEvent->SetNumberField(TEXT("NumJobs"), JobFile.Jobs.Num());
+	DoneEvent->SetNumberField(TEXT("NumRun"), NumRun);
+	DoneEvent->SetNumberField(TEXT("NumFailed"), NumFailed);
+	DoneEvent->SetNumberField(TEXT("Seconds"), FPlatformTime::Seconds() - StartTime);
+	EmitJobEvent(DoneEvent, ProgressPath);
+	return NumFailed > 0 || NumRun < JobFile.Jobs.Num() ? 1 : 0;
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "GaussianSplattingEditorLibrary.h"
+#include "GaussianSplattingCommandlet.generated.h"
+
+/** One step of a job file, the fields a type does not use are ignored. */
+USTRUCT()
+struct FGaussianSplattingCommandletJob
+{
+	GENERATED_BODY()
+public:
+	/** Import, Repartition, Simplify or Compress. */
+	UPROPERTY()
+	FString Type;
+
+	/** Map the actors of an import are spawned in, or whose point clouds are repartitioned. */
+	UPROPERTY()
+	FString Map;
+
+	/** Import: folder searched recursively for trained PLY files. */
+	UPROPERTY()
+	FString SearchDir;
+
+	/** Import: content folder the point clouds are saved in. */
+	UPROPERTY()
+	FString SaveContentDir;
+
+	/** Import and repartition: Niagara system the actors use, the plugin default when empty. */
+	UPROPERTY()
+	FString TemplateSystem;
+
+	UPROPERTY()
+	bool bUseStandaloneNiagaraSystem = false;
+
+	UPROPERTY()
+	int32 MaxInFlightMegabytes = 8192;
+
+	/** Import: converts every file again, even the ones whose contents and settings match the last import. */
+	UPROPERTY()
+	bool bForceReimport = false;
+
+	UPROPERTY()
+	FString PartitionBaseName = TEXT("Cell");
+
+	/** Repartition: octree cells with the budgets below instead of a grid of CellSize. */
+	UPROPERTY()
+	bool bAdaptive = false;
+
+	UPROPERTY()
+	int32 CellSize = 51200;
+
+	UPROPERTY()
+	int32 MaxPointsPerCell = 1000000;
+
+	UPROPERTY()
+	int32 MaxMegabytesPerCell = 0;
+
+	UPROPERTY()
+	int32 MaxDepth = 8;
+
+	UPROPERTY()
+	EGaussianSplattingOverlapMode OverlapMode = EGaussianSplattingOverlapMode::Ownership;
+
+	UPROPERTY()
+	float OverlapCellSize = 20.0f;
+
+	/** Simplify: object path of the source cloud and of the new one. */
+	UPROPERTY()
+	FString Source;
+
+	UPROPERTY()
+	FString Dest;
+
+	UPROPERTY()
+	FGaussianSplattingSimplifySettings Simplify;
+
+	/** Compress: object paths of point clouds, or content folders whose point clouds are all compressed. */
+	UPROPERTY()
+	TArray<FString> PointClouds;
+
+	UPROPERTY()
+	EGaussianSplattingCompressionMethod CompressionMethod = EGaussianSplattingCompressionMethod::Zlib;
+};
+
+USTRUCT()
+struct FGaussianSplattingCommandletJobFile
+{
+	GENERATED_BODY()
+public:
+	/** Run in order, the first failing job stops the run unless -ContinueOnError is given. */
+	UPROPERTY()
+	TArray<FGaussianSplattingCommandletJob> Jobs;
+};
+
+/**
+ * Runs the import, repartition, simplify and compress steps of a JSON job file without the editor UI, so it works with -nullrhi.
+ * Every job prints one JSON line when it starts and one with its timing and result when it ends, prefixed with
+ * "GaussianSplattingJob: ", and appends the same lines to the -Progress file when given.
+ * -run=GaussianSplatting -Jobs=Path/To/Jobs.json [-Progress=Path/To/Progress.jsonl] [-ContinueOnError]
+ */
+UCLASS()
+class UGaussianSplattingCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+public:
+	int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,89 @@
+#include "GaussianSplattingEditorLibrary.h"
+#include "GaussianSplattingBenchmarks.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Editor.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/IConsoleManager.h"
+#include "StaticMeshResources.h"
+
+static int64 GetLODVertexBytes(const FStaticMeshLODResources& LODResources)
+{
+	const FStaticMeshVertexBuffers& VertexBuffers = LODResources.VertexBuffers;
+	return (int64)VertexBuffers.PositionVertexBuffer.GetNumVertices() * VertexBuffers.PositionVertexBuffer.GetStride()
+		+ (int64)VertexBuffers.ColorVertexBuffer.GetNumVertices() * VertexBuffers.ColorVertexBuffer.GetStride()
+		+ VertexBuffers.StaticMeshVertexBuffer.GetTangentSize() + VertexBuffers.StaticMeshVertexBuffer.GetTexCoordSize();
+}
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkStaticMesh(
+	TEXT("GaussianSplatting.Benchmark.StaticMesh"),
+	TEXT("Bakes a synthetic cloud into a static mesh by filling its render data directly and, unless disabled, through the mesh description and the mesh build, then logs the time and vertex memory of both and checks they hold the same geometry. Arguments: [NumPoints=2000000] [bMeshBuild=1]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 2000000, 1);
+		const bool bMeshBuild = Args.Num() > 1 ? FCString::ToBool(*Args[1]) : true;
+		UGaussianSplattingPointCloud* PointCloud = NewObject<UGaussianSplattingPointCloud>(GetTransientPackage());
+		PointCloud->SetPoints(GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints));
+
+		double StartTime = FPlatformTime::Seconds();
+		UStaticMesh* DirectMesh = UGaussianSplattingEditorLibrary::CreateStaticMeshFromPointCloud(PointCloud, GetTransientPackage(), NAME_None, true);
+		const double DirectSeconds = FPlatformTime::Seconds() - StartTime;
+		const FStaticMeshLODResources& DirectLOD = DirectMesh->GetRenderData()->LODResources[0];
+		UE_LOG(LogTemp, Log, TEXT("StaticMesh: %d points, direct render data %.2f s, %d vertices, %d triangles, %.1f MB of vertices"),
+			NumPoints, DirectSeconds, DirectLOD.GetNumVertices(), DirectLOD.GetNumTriangles(), GetLODVertexBytes(DirectLOD) / (1024.0 * 1024.0));
+		if (!bMeshBuild) {
+			return;
+		}
+
+		StartTime = FPlatformTime::Seconds();
+		UStaticMesh* BuiltMesh = UGaussianSplattingEditorLibrary::CreateStaticMeshFromPointCloud(PointCloud, GetTransientPackage(), NAME_None, false);
+		const double BuildSeconds = FPlatformTime::Seconds() - StartTime;
+		const FStaticMeshLODResources& BuiltLOD = BuiltMesh->GetRenderData()->LODResources[0];
+		UE_LOG(LogTemp, Log, TEXT("StaticMesh: mesh description and build %.2f s (%.1fx slower), %d vertices, %d triangles, %.1f MB of vertices"),
+			BuildSeconds, BuildSeconds / FMath::Max(DirectSeconds, 1e-6), BuiltLOD.GetNumVertices(), BuiltLOD.GetNumTriangles(), GetLODVertexBytes(BuiltLOD) / (1024.0 * 1024.0));
+		// The build may weld or reorder vertices, the triangles and the bounds they cover must match.
+		const FBox DirectBounds = DirectMesh->GetBoundingBox();
+		const FBox BuiltBounds = BuiltMesh->GetBoundingBox();
+		if (DirectLOD.GetNumTriangles() != BuiltLOD.GetNumTriangles() || !DirectBounds.Min.Equals(BuiltBounds.Min, 0.01) || !DirectBounds.Max.Equals(BuiltBounds.Max, 0.01)) {
+			UE_LOG(LogTemp, Error, TEXT("StaticMesh: the direct render data differs from the mesh build, %d and %d triangles, bounds %s and %s"),
+				DirectLOD.GetNumTriangles(), BuiltLOD.GetNumTriangles(), *DirectBounds.ToString(), *BuiltBounds.ToString());
+		}
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkInstancedStaticMesh(
+	TEXT("GaussianSplatting.Benchmark.InstancedStaticMesh"),
+	TEXT("Sets up a synthetic cloud as instances of a shared quad on a transient actor of the editor world and bakes it into a static mesh with direct render data, then logs the time and memory of both. Arguments: [NumPoints=2000000]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+		if (World == nullptr) {
+			UE_LOG(LogTemp, Error, TEXT("InstancedStaticMesh: no editor world"));
+			return;
+		}
+		const int32 NumPoints = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 2000000, 1);
+		UGaussianSplattingPointCloud* PointCloud = NewObject<UGaussianSplattingPointCloud>(GetTransientPackage());
+		PointCloud->SetPoints(GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints));
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.ObjectFlags = RF_Transient;
+		AActor* Actor = World->SpawnActor<AActor>(SpawnParameters);
+		UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(Actor);
+		Actor->SetRootComponent(Component);
+		Component->RegisterComponent();
+		double StartTime = FPlatformTime::Seconds();
+		UGaussianSplattingEditorLibrary::SetupPointCloudToInstancedStaticMeshComponent(PointCloud, Component);
+		const double InstancedSeconds = FPlatformTime::Seconds() - StartTime;
+		const int64 InstanceBytes = (int64)Component->GetInstanceCount() * (sizeof(FRenderTransform) + Component->NumCustomDataFloats * sizeof(float));
+		const FStaticMeshLODResources& QuadLOD = Component->GetStaticMesh()->GetRenderData()->LODResources[0];
+		UE_LOG(LogTemp, Log, TEXT("InstancedStaticMesh: %d points, instanced %.2f s, %d instances of %d vertices, %.1f MB of instance data"),
+			NumPoints, InstancedSeconds, Component->GetInstanceCount(), QuadLOD.GetNumVertices(), InstanceBytes / (1024.0 * 1024.0));
+		if (Component->GetInstanceCount() != NumPoints) {
+			UE_LOG(LogTemp, Error, TEXT("InstancedStaticMesh: %d instances for %d points"), Component->GetInstanceCount(), NumPoints);
+		}
+		Actor->Destroy();
+
+		StartTime = FPlatformTime::Seconds();
+		UStaticMesh* DirectMesh = UGaussianSplattingEditorLibrary::CreateStaticMeshFromPointCloud(PointCloud, GetTransientPackage(), NAME_None, true);
+		const double DirectSeconds = FPlatformTime::Seconds() - StartTime;
+		const FStaticMeshLODResources& DirectLOD = DirectMesh->GetRenderData()->LODResources[0];
+		const int64 DirectBytes = GetLODVertexBytes(DirectLOD) + DirectLOD.IndexBuffer.GetIndexDataSize();
+		UE_LOG(LogTemp, Log, TEXT("InstancedStaticMesh: direct render data %.2f s, %.1f MB of vertices and indices, %.1fx the instance data"),
+			DirectSeconds, DirectBytes / (1024.0 * 1024.0), (double)DirectBytes / FMath::Max(InstanceBytes, (int64)1));
+	}));
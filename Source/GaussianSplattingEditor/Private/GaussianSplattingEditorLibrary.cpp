@@ -7,6 +7,10 @@
 #include "MaterialDomain.h"
 #include "StaticMeshCompiler.h"
 #include "Materials/MaterialInstanceConstant.h"
+#include "Materials/MaterialExpressionAppendVector.h"
+#include "Materials/MaterialExpressionConstant.h"
+#include "Materials/MaterialExpressionPerInstanceCustomData.h"
+#include "Materials/MaterialExpressionVertexColor.h"
 #include "NiagaraDataInterfaceArrayFloat.h"
 #include "NiagaraSystemFactoryNew.h"
 #include "NiagaraEditorModule.h"
@@ -23,9 +27,23 @@
 #include "NiagaraComponent.h"
 #include "FileHelpers.h"
 #include "Engine/StaticMeshActor.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "JsonObjectConverter.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Kismet/GameplayStatics.h"
+#include "Async/ParallelFor.h"
+#include "GaussianSplattingMotionFit.h"
+#include "GaussianSplattingSequence.h"
+#include "GaussianSplattingSimplify.h"
+#include "GaussianSplattingCaptureScore.h"
+#include "GaussianSplattingImportPipeline.h"
+#include "GaussianSplattingBinning.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Misc/PackageName.h"
+#include "UObject/SavePackage.h"
+#include "Hash/xxhash.h"
+#include "GaussianSplattingSoftwareRenderer.h"
+#include "GaussianSplattingStaticMesh.h"
 #include <string>
 #include <cmath>
 
@@ -42,183 +60,443 @@ UGaussianSplattingPointCloud* UGaussianSplattingEditorLibrary::LoadSplatPly(
 	return PointCloud;
 }
 
-UStaticMesh* UGaussianSplattingEditorLibrary::CreateStaticMeshFromPointCloud(UGaussianSplattingPointCloud* PointCloud, UObject* Outer, FName AssetName /*= NAME_None*/)
+static TArray<FString> FindPlyFrames(const FString& Directory)
 {
-	if (PointCloud == nullptr) {
+	TArray<FString> FrameFiles;
+	IFileManager::Get().FindFiles(FrameFiles, *(Directory / TEXT("*.ply")), true, false);
+	// Frame numbers are not always zero padded, so files are ordered by their trailing number first.
+	auto GetFrameNumber = [](const FString& FileName) -> int64 {
+		const FString BaseName = FPaths::GetBaseFilename(FileName);
+		int32 DigitsBegin = BaseName.Len();
+		while (DigitsBegin > 0 && FChar::IsDigit(BaseName[DigitsBegin - 1])) {
+			DigitsBegin--;
+		}
+		return DigitsBegin < BaseName.Len() ? FCString::Atoi64(*BaseName.Mid(DigitsBegin)) : -1;
+	};
+	FrameFiles.Sort([&GetFrameNumber](const FString& A, const FString& B) {
+		const int64 FrameA = GetFrameNumber(A);
+		const int64 FrameB = GetFrameNumber(B);
+		return FrameA != FrameB ? FrameA < FrameB : A < B;
+	});
+	return FrameFiles;
+}
+
+UGaussianSplattingPointCloud* UGaussianSplattingEditorLibrary::LoadSplatPlySequence(FString Directory, UObject* Outer, FName AssetName, const FGaussianSplattingSequenceImportSettings& Settings, FGaussianSplattingSequenceImportReport& OutReport)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingEditorLibrary::LoadSplatPlySequence);
+	const double StartTime = FPlatformTime::Seconds();
+	OutReport = FGaussianSplattingSequenceImportReport();
+
+	const TArray<FString> FrameFiles = FindPlyFrames(Directory);
+	const int32 NumFrames = FrameFiles.Num();
+	if (NumFrames < 2) {
+		UE_LOG(LogTemp, Warning, TEXT("Expected at least two PLY frames in %s, found %d."), *Directory, NumFrames);
 		return nullptr;
 	}
-	UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Outer, AssetName);
 
-	{
-		FStaticMeshSourceModel& NewSourceModel = StaticMesh->AddSourceModel();
-		FMeshDescription& NewMeshDescription = *StaticMesh->CreateMeshDescription(0);
-		FStaticMeshAttributes AttributeGetter = FStaticMeshAttributes(NewMeshDescription);
-		AttributeGetter.Register();
-		NewSourceModel.BuildSettings.bUseMikkTSpace = false;
-		NewSourceModel.BuildSettings.bRecomputeNormals = false;
-		NewSourceModel.BuildSettings.bRecomputeTangents = false;
-		NewSourceModel.BuildSettings.bComputeWeightedNormals = false;
-		NewSourceModel.BuildSettings.bUseFullPrecisionUVs = true;
-		NewSourceModel.BuildSettings.bRemoveDegenerates = false;
-		NewSourceModel.BuildSettings.bUseBackwardsCompatibleF16TruncUVs = true;
-		NewSourceModel.BuildSettings.bGenerateLightmapUVs = false;
-
-		TPolygonGroupAttributesRef<FName> PolygonGroupNames = AttributeGetter.GetPolygonGroupMaterialSlotNames();
-		TVertexAttributesRef<FVector3f> VertexPositions = AttributeGetter.GetVertexPositions();
-		TVertexInstanceAttributesRef<FVector3f> Normals = AttributeGetter.GetVertexInstanceNormals();
-		TVertexInstanceAttributesRef<FVector3f> Tangents = AttributeGetter.GetVertexInstanceTangents();
-		TVertexInstanceAttributesRef<float> BinormalSigns = AttributeGetter.GetVertexInstanceBinormalSigns();
-		TVertexInstanceAttributesRef<FVector4f> Colors = AttributeGetter.GetVertexInstanceColors();
-		TVertexInstanceAttributesRef<FVector2f> UVs = AttributeGetter.GetVertexInstanceUVs();
-
-		auto Points = PointCloud->GetPoints();
-		int PointCount = Points.Num();
-
-		int TextureDimension = FMath::RoundUpToPowerOfTwo(FMath::Sqrt((double)PointCount));
-		FVector2f InvTextureDimension(1.0f / (TextureDimension + 0.5f), 1.0f / TextureDimension);
-		TArray<FFloat16> ColorData;
-		TArray<FFloat16> ScaleData;
-		TArray<FFloat16> QuatData;
-
-		ColorData.Reserve(PointCount * 4);
-		ScaleData.Reserve(PointCount * 4);
-		QuatData.Reserve(PointCount * 4);
-
-		int32 VertexCount = PointCount * 4;
-		int32 VertexInstanceCount = PointCount * 6;
-		int32 PolygonCount = 0;
-
-		NewMeshDescription.ReserveNewVertices(VertexCount);
-		NewMeshDescription.ReserveNewVertexInstances(VertexInstanceCount);
-		NewMeshDescription.ReserveNewPolygons(PolygonCount);
-		NewMeshDescription.ReserveNewEdges(PolygonCount * 2);
-		UVs.SetNumChannels(1);
-		Colors.SetNumChannels(1);
-
-		FPolygonGroupID PolygonGroup0 = NewMeshDescription.CreatePolygonGroup();
-
-		int VaildIndex = 0;
-
-		for (int i = 0; i < PointCount; i++) {
-			const FGaussianSplattingPoint& Point = Points[i];
-
-			const FVertexID VertexID0 = NewMeshDescription.CreateVertex();
-			const FVertexID VertexID1 = NewMeshDescription.CreateVertex();
-			const FVertexID VertexID2 = NewMeshDescription.CreateVertex();
-			const FVertexID VertexID3 = NewMeshDescription.CreateVertex();
-
-			float SizeFeature = 4 * FMath::Max(Point.Scale.Length(), 0.00001f) * 0.001f;
-
-			VertexPositions[VertexID0] = Point.Position + SizeFeature * FVector3f(-1.f, 0.0f, -1.f);
-			VertexPositions[VertexID1] = Point.Position + SizeFeature * FVector3f(1.f, 0.0f, -1.f);
-			VertexPositions[VertexID2] = Point.Position + SizeFeature * FVector3f(1.f, 0.0f, 1.f);
-			VertexPositions[VertexID3] = Point.Position + SizeFeature * FVector3f(-1.f, 0.0f, 1.f);
-
-			const FVertexInstanceID VertexInstanceID0 = NewMeshDescription.CreateVertexInstance(VertexID0);
-			const FVertexInstanceID VertexInstanceID1 = NewMeshDescription.CreateVertexInstance(VertexID1);
-			const FVertexInstanceID VertexInstanceID2 = NewMeshDescription.CreateVertexInstance(VertexID2);
-
-			const FVertexInstanceID VertexInstanceID3 = NewMeshDescription.CreateVertexInstance(VertexID0);
-			const FVertexInstanceID VertexInstanceID4 = NewMeshDescription.CreateVertexInstance(VertexID2);
-			const FVertexInstanceID VertexInstanceID5 = NewMeshDescription.CreateVertexInstance(VertexID3);
-
-			UVs[VertexInstanceID0] = FVector2f(0.0f, 0.0f);
-			UVs[VertexInstanceID1] = FVector2f(1.0f, 0.0f);
-			UVs[VertexInstanceID2] = FVector2f(1.0f, 1.0f);
-
-			UVs[VertexInstanceID3] = FVector2f(0.0f, 0.0f);
-			UVs[VertexInstanceID4] = FVector2f(1.0f, 1.0f);
-			UVs[VertexInstanceID5] = FVector2f(0.0f, 1.0f);
-
-			UVs.Set(VertexInstanceID0, 0, FVector2f(0.0f, 0.0f));
-			UVs.Set(VertexInstanceID1, 0, FVector2f(1.0f, 0.0f));
-			UVs.Set(VertexInstanceID2, 0, FVector2f(1.0f, 1.0f));
-			UVs.Set(VertexInstanceID3, 0, FVector2f(0.0f, 0.0f));
-			UVs.Set(VertexInstanceID4, 0, FVector2f(1.0f, 1.0f));
-			UVs.Set(VertexInstanceID5, 0, FVector2f(0.0f, 1.0f));
-
-			FVector2f Coord = FVector2f(VaildIndex % TextureDimension, VaildIndex / TextureDimension);
-			VaildIndex++;
-
-			FVector2f SampleUV = (Coord + 0.5) * InvTextureDimension;
-			FLinearColor VertexColor = SRGBToLinear(FVector4f(SampleUV.X, 0, 0, SampleUV.Y));
-
-			Colors[VertexInstanceID0] = VertexColor;
-			Colors[VertexInstanceID1] = VertexColor;
-			Colors[VertexInstanceID2] = VertexColor;
-			Colors[VertexInstanceID3] = VertexColor;
-			Colors[VertexInstanceID4] = VertexColor;
-			Colors[VertexInstanceID5] = VertexColor;
-
-			ScaleData.Append({
-				Point.Scale.X,
-				Point.Scale.Y,
-				Point.Scale.Z,
-				SizeFeature
-			});
+	// Only the centers and opacities of the frames are kept, splat-major so every splat is fitted from contiguous samples.
+	// Frames are parsed a batch at a time, and each splat keeps the appearance of the frame where it is the most opaque.
+	int32 NumSplats = INDEX_NONE;
+	TArray<FGaussianSplattingFrameSample, FDefaultAllocator64> Samples;
+	TArray<FGaussianSplattingPoint> Appearances;
+	const int32 BatchSize = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	for (int32 BatchBegin = 0; BatchBegin < NumFrames; BatchBegin += BatchSize) {
+		const int32 BatchCount = FMath::Min(BatchSize, NumFrames - BatchBegin);
+		TArray<TArray<FGaussianSplattingPoint>> BatchPoints;
+		BatchPoints.SetNum(BatchCount);
+		ParallelFor(BatchCount, [&](int32 i) {
+			BatchPoints[i] = UGaussianSplattingPointCloud::LoadPointsFromFile(Directory / FrameFiles[BatchBegin + i]);
+		});
+		if (NumSplats == INDEX_NONE) {
+			NumSplats = BatchPoints[0].Num();
+			Samples.SetNumUninitialized((int64)NumSplats * NumFrames);
+			Appearances = BatchPoints[0];
+		}
+		for (int32 i = 0; i < BatchCount; i++) {
+			if (NumSplats == 0 || BatchPoints[i].Num() != NumSplats) {
+				UE_LOG(LogTemp, Warning, TEXT("Frame %s has %d splats instead of %d, every frame must hold the same corresponding splats."), *FrameFiles[BatchBegin + i], BatchPoints[i].Num(), NumSplats);
+				return nullptr;
+			}
+		}
+		ParallelFor(NumSplats, [&](int32 SplatIndex) {
+			for (int32 i = 0; i < BatchCount; i++) {
+				const FGaussianSplattingPoint& Point = BatchPoints[i][SplatIndex];
+				FGaussianSplattingFrameSample& Sample = Samples[(int64)SplatIndex * NumFrames + BatchBegin + i];
+				Sample.Position = Point.Position;
+				Sample.Opacity = Point.Color.A;
+				if (Point.Color.A > Appearances[SplatIndex].Color.A) {
+					Appearances[SplatIndex] = Point;
+				}
+			}
+		});
+	}
 
+	GaussianSplattingMotionFit::FSettings FitSettings;
+	FitSettings.FrameRate = Settings.FrameRate;
+	FitSettings.PositionTolerance = Settings.PositionTolerance;
+	FitSettings.MinOpacity = Settings.MinOpacity;
+	const int32 SplatsPerBlock = 4096;
+	const int32 NumBlocks = FMath::DivideAndRoundUp(NumSplats, SplatsPerBlock);
+	TArray<TArray<FGaussianSplattingPoint>> BlockPoints;
+	TArray<GaussianSplattingMotionFit::FStats> BlockStats;
+	BlockPoints.SetNum(NumBlocks);
+	BlockStats.SetNum(NumBlocks);
+	ParallelFor(NumBlocks, [&](int32 BlockIndex) {
+		const int32 End = FMath::Min((BlockIndex + 1) * SplatsPerBlock, NumSplats);
+		for (int32 SplatIndex = BlockIndex * SplatsPerBlock; SplatIndex < End; SplatIndex++) {
+			const TConstArrayView<FGaussianSplattingFrameSample> SplatSamples(Samples.GetData() + (int64)SplatIndex * NumFrames, NumFrames);
+			GaussianSplattingMotionFit::FitSplat(SplatSamples, Appearances[SplatIndex], FitSettings, BlockPoints[BlockIndex], BlockStats[BlockIndex]);
+		}
+	});
 
-			ColorData.Append({
-				Point.Color.R,
-				Point.Color.G,
-				Point.Color.B,
-				Point.Color.A
-				});
-
-			QuatData.Append({
-				Point.Quat.X,
-				Point.Quat.Y,
-				Point.Quat.Z,
-				Point.Quat.W,
-				});
-
-			NewMeshDescription.CreateTriangle(PolygonGroup0, {
-				VertexInstanceID0,
-				VertexInstanceID1,
-				VertexInstanceID2,
-				});
-
-			NewMeshDescription.CreateTriangle(PolygonGroup0, {
-				VertexInstanceID3,
-				VertexInstanceID4,
-				VertexInstanceID5,
-			});
+	TArray<FGaussianSplattingPoint> Points;
+	GaussianSplattingMotionFit::FStats Stats;
+	for (int32 BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex++) {
+		Points.Append(BlockPoints[BlockIndex]);
+		Stats.Accumulate(BlockStats[BlockIndex]);
+	}
+	if (Points.IsEmpty()) {
+		UE_LOG(LogTemp, Warning, TEXT("No splat of %s is ever visible."), *Directory);
+		return nullptr;
+	}
+	UGaussianSplattingPointCloud* PointCloud = NewObject<UGaussianSplattingPointCloud>(Outer, AssetName);
+	PointCloud->SetPoints(Points);
+
+	OutReport.NumFrames = NumFrames;
+	OutReport.NumSplats = NumSplats;
+	OutReport.NumPoints = Points.Num();
+	OutReport.Duration = NumFrames / FMath::Max(Settings.FrameRate, UE_KINDA_SMALL_NUMBER);
+	OutReport.CompressionRatio = (double)NumSplats * NumFrames / Points.Num();
+	OutReport.RMSPositionError = FMath::Sqrt(Stats.SumSquaredPositionError / FMath::Max(Stats.NumSamples, (int64)1));
+	OutReport.MaxPositionError = Stats.MaxPositionError;
+	OutReport.RMSOpacityError = FMath::Sqrt(Stats.SumSquaredOpacityError / FMath::Max(Stats.NumSamples, (int64)1));
+	OutReport.Seconds = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogTemp, Log, TEXT("Imported %d frames of %d splats from %s as %d points (%.1fx smaller), position error RMS %.3f max %.3f, opacity error RMS %.4f, %.1f s"),
+		OutReport.NumFrames, OutReport.NumSplats, *Directory, OutReport.NumPoints, OutReport.CompressionRatio,
+		OutReport.RMSPositionError, OutReport.MaxPositionError, OutReport.RMSOpacityError, OutReport.Seconds);
+	return PointCloud;
+}
+
+UGaussianSplattingSequence* UGaussianSplattingEditorLibrary::LoadSplatPlySequenceAsFrames(FString Directory, UObject* Outer, FName AssetName, float FrameRate, int32 KeyframeInterval)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingEditorLibrary::LoadSplatPlySequenceAsFrames);
+	const TArray<FString> FrameFiles = FindPlyFrames(Directory);
+	const int32 NumFrames = FrameFiles.Num();
+	if (NumFrames == 0) {
+		UE_LOG(LogTemp, Warning, TEXT("No PLY frames found in %s."), *Directory);
+		return nullptr;
+	}
+
+	UGaussianSplattingSequence* Sequence = NewObject<UGaussianSplattingSequence>(Outer, AssetName);
+	Sequence->SetFrameRate(FrameRate);
+	Sequence->SetKeyframeInterval(KeyframeInterval);
+	// Frames are parsed a batch at a time and encoded in order, the splats of consecutive frames correspond by index.
+	FGaussianSplattingSequenceBuilder Builder(Sequence);
+	const int32 BatchSize = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	for (int32 BatchBegin = 0; BatchBegin < NumFrames; BatchBegin += BatchSize) {
+		const int32 BatchCount = FMath::Min(BatchSize, NumFrames - BatchBegin);
+		TArray<TArray<FGaussianSplattingPoint>> BatchPoints;
+		BatchPoints.SetNum(BatchCount);
+		ParallelFor(BatchCount, [&](int32 i) {
+			BatchPoints[i] = UGaussianSplattingPointCloud::LoadPointsFromFile(Directory / FrameFiles[BatchBegin + i]);
+		});
+		for (int32 i = 0; i < BatchCount; i++) {
+			if (!Builder.AddFrame(BatchPoints[i])) {
+				UE_LOG(LogTemp, Warning, TEXT("Failed to encode frame %s."), *FrameFiles[BatchBegin + i]);
+				return nullptr;
+			}
 		}
+	}
+	UE_LOG(LogTemp, Log, TEXT("Imported %d frames from %s, %d keyframes in %.2f MB, deltas in %.2f MB."),
+		NumFrames, *Directory, Builder.GetNumKeyframes(), Builder.GetKeyframeBytes() / 1048576.0, Builder.GetDeltaBytes() / 1048576.0);
+	return Sequence;
+}
 
-		PolygonGroupNames[PolygonGroup0] = "LOD0_Section0";
-		UMaterialInterface* ParentMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Script/Engine.Material'/GaussianSplattingForUnrealEngine/Materials/M_GaussianSplatting.M_GaussianSplatting'"));
-		UMaterialInstanceConstant* NewMaterial = NewObject<UMaterialInstanceConstant>(StaticMesh);
-		NewMaterial->SetParentEditorOnly(ParentMaterial);
-
-		NewMaterial->SetTextureParameterValueEditorOnly(FMaterialParameterInfo("ScaleTexture"), CreateFloat16TextureFromData(
-			StaticMesh,
-			TEXT("ScaleTexture"),
-			TextureDimension,
-			TextureDimension,
-			ScaleData));
-
-		NewMaterial->SetTextureParameterValueEditorOnly(FMaterialParameterInfo("QuadTexture"), CreateFloat16TextureFromData(
-			StaticMesh,
-			TEXT("QuadTexture"),
-			TextureDimension,
-			TextureDimension,
-			QuatData));
-
-		NewMaterial->SetTextureParameterValueEditorOnly(FMaterialParameterInfo("ColorTexture"), CreateFloat16TextureFromData(
-			StaticMesh,
-			TEXT("ColorTexture"),
-			TextureDimension,
-			TextureDimension,
-			ColorData));
-
-		NewMaterial->PreEditChange(nullptr);
-		NewMaterial->PostEditChange();
-		StaticMesh->GetStaticMaterials().Add(FStaticMaterial(NewMaterial));
-		NewSourceModel.ScreenSize = 1;
-		StaticMesh->CommitMeshDescription(0);
+UGaussianSplattingPointCloud* UGaussianSplattingEditorLibrary::SimplifyPointCloud(UGaussianSplattingPointCloud* Source, UObject* Outer, FName AssetName, const FGaussianSplattingSimplifySettings& Settings, FGaussianSplattingSimplifyReport& OutReport)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingEditorLibrary::SimplifyPointCloud);
+	const double StartTime = FPlatformTime::Seconds();
+	OutReport = FGaussianSplattingSimplifyReport();
+	if (Source == nullptr) {
+		return nullptr;
+	}
+	Source->LoadAllSegments();
+	const TArray<FGaussianSplattingPoint>& SourcePoints = Source->GetPoints();
+	if (SourcePoints.IsEmpty()) {
+		UE_LOG(LogTemp, Warning, TEXT("%s has no points to simplify."), *Source->GetName());
+		return nullptr;
+	}
+
+	GaussianSplattingSimplify::FSettings SimplifySettings;
+	SimplifySettings.TargetPointCount = Settings.TargetPointCount;
+	SimplifySettings.MaxContributionLoss = Settings.MaxContributionLoss;
+	SimplifySettings.NumViews = Settings.NumViews;
+	for (const FVector& ViewLocation : Settings.ViewLocations) {
+		SimplifySettings.ViewLocations.Add(FVector3f(ViewLocation));
+	}
+	const TArray<FGaussianSplattingContributionScore>& Scores = Source->GetContributionScores();
+	if (Settings.bUseCaptureScores && Scores.Num() == SourcePoints.Num()) {
+		SimplifySettings.Contributions.SetNumUninitialized(Scores.Num());
+		for (int32 i = 0; i < Scores.Num(); i++) {
+			SimplifySettings.Contributions[i] = Scores[i].SumWeight;
+		}
+	}
+	TArray<FGaussianSplattingPoint> Points;
+	GaussianSplattingSimplify::FStats Stats;
+	GaussianSplattingSimplify::Simplify(SourcePoints, SimplifySettings, Points, Stats);
+
+	// Reference renders of both clouds from a few of the views, looking at the center of the source.
+	FBox3f Bounds(ForceInit);
+	for (const FGaussianSplattingPoint& Point : SourcePoints) {
+		Bounds += Point.Position;
+	}
+	TArray<FVector3f> QualityViews = SimplifySettings.ViewLocations;
+	if (QualityViews.IsEmpty()) {
+		GaussianSplattingSimplify::MakeSampleViews(Bounds, 8, QualityViews);
+	}
+	QualityViews.SetNum(FMath::Min(QualityViews.Num(), 8));
+	double SumPSNR = 0.0;
+	TArray<FLinearColor> SourcePixels;
+	TArray<FLinearColor> Pixels;
+	for (const FVector3f& ViewLocation : QualityViews) {
+		const FGaussianSplattingRenderView View = FGaussianSplattingRenderView::LookAt(ViewLocation, Bounds.GetCenter(), 256, 256, 60.0f);
+		GaussianSplattingSoftwareRenderer::Render(SourcePoints, View, SourcePixels);
+		GaussianSplattingSoftwareRenderer::Render(Points, View, Pixels);
+		SumPSNR += FMath::Min(GaussianSplattingSoftwareRenderer::ComputePSNR(Pixels, SourcePixels), 100.0f);
+	}
+
+	// A fresh cloud with the settings of the source, duplicating it would first copy and then throw away its points and payloads.
+	UGaussianSplattingPointCloud* PointCloud = NewObject<UGaussianSplattingPointCloud>(Outer, AssetName);
+	PointCloud->CopySettings(*Source);
+	PointCloud->SetPoints(Points);
+
+	OutReport.NumSourcePoints = SourcePoints.Num();
+	OutReport.NumPoints = Points.Num();
+	OutReport.ContributionLoss = Stats.ContributionLoss;
+	OutReport.MaxRemovedContribution = Stats.MaxRemovedContribution;
+	OutReport.RMSRemovedDistance = Stats.RMSRemovedDistance;
+	OutReport.NumUncovered = Stats.NumUncovered;
+	OutReport.PSNR = QualityViews.IsEmpty() ? 0.0f : (float)(SumPSNR / QualityViews.Num());
+	OutReport.Seconds = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogTemp, Log, TEXT("Simplified %s from %d to %d points, contribution loss %.2f%%, largest removed %.3fx the mean, removed splats %.3f from a kept one (RMS), %d uncovered, PSNR %.2f dB, %.1f s"),
+		*Source->GetName(), OutReport.NumSourcePoints, OutReport.NumPoints, OutReport.ContributionLoss * 100.0f, OutReport.MaxRemovedContribution,
+		OutReport.RMSRemovedDistance, OutReport.NumUncovered, OutReport.PSNR, OutReport.Seconds);
+	return PointCloud;
+}
+
+bool UGaussianSplattingEditorLibrary::ScorePointCloudFromCapture(UGaussianSplattingPointCloud* PointCloud, FString WorkDir, FGaussianSplattingCaptureScoreReport& OutReport, int32 MaxResolution, int32 MaxViews)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingEditorLibrary::ScorePointCloudFromCapture);
+	OutReport = FGaussianSplattingCaptureScoreReport();
+	if (PointCloud == nullptr) {
+		return false;
+	}
+	TArray<GaussianSplattingCaptureScore::FCaptureCamera> Cameras;
+	if (!GaussianSplattingCaptureScore::LoadColmapCameras(WorkDir / TEXT("sparse/0"), Cameras) || Cameras.IsEmpty()) {
+		return false;
+	}
+	PointCloud->LoadAllSegments();
+	GaussianSplattingCaptureScore::FSettings Settings;
+	Settings.MaxResolution = MaxResolution;
+	Settings.MaxViews = MaxViews;
+	TArray<FGaussianSplattingContributionScore> Scores;
+	GaussianSplattingCaptureScore::FStats Stats;
+	GaussianSplattingCaptureScore::ScorePoints(PointCloud->GetPoints(), Cameras, Settings, Scores, Stats);
+	PointCloud->Modify();
+	PointCloud->SetContributionScores(MoveTemp(Scores));
+
+	OutReport.NumViews = Stats.NumViews;
+	OutReport.NumUnseen = Stats.NumUnseen;
+	OutReport.Seconds = Stats.Seconds;
+	UE_LOG(LogTemp, Log, TEXT("Scored %d points of %s over %d capture views, %d never show, %.1f s"),
+		PointCloud->GetPointCount(), *PointCloud->GetName(), OutReport.NumViews, OutReport.NumUnseen, OutReport.Seconds);
+	return true;
+}
+
+static UMaterialInterface* LoadStaticMeshParentMaterial()
+{
+	return LoadObject<UMaterialInterface>(nullptr, TEXT("/Script/Engine.Material'/GaussianSplattingForUnrealEngine/Materials/M_GaussianSplatting.M_GaussianSplatting'"));
+}
+
+/**
+ * Material of the instanced output, M_GaussianSplatting reading the texel of a splat from the custom data of its instance
+ * instead of the vertex color. It is derived from M_GaussianSplatting the first time and saved next to it.
+ */
+static UMaterialInterface* LoadInstancedStaticMeshParentMaterial()
+{
+	const FString PackageName = TEXT("/GaussianSplattingForUnrealEngine/Materials/M_GaussianSplattingInstanced");
+	const FString MaterialName = FPackageName::GetShortName(PackageName);
+	if (UMaterialInterface* Material = LoadObject<UMaterialInterface>(nullptr, *(PackageName + TEXT(".") + MaterialName), nullptr, LOAD_NoWarn | LOAD_Quiet)) {
+		return Material;
+	}
+	UMaterial* ParentMaterial = Cast<UMaterial>(LoadStaticMeshParentMaterial());
+	if (ParentMaterial == nullptr) {
+		return nullptr;
+	}
+	if (!ParentMaterial->GetExpressions().ContainsByPredicate([](const UMaterialExpression* Expression) { return Expression && Expression->IsA<UMaterialExpressionVertexColor>(); })) {
+		UE_LOG(LogTemp, Error, TEXT("%s does not read the texel of the splats from the vertex color, no instanced material can be derived from it"), *ParentMaterial->GetPathName());
+		return nullptr;
+	}
+	UPackage* Package = CreatePackage(*PackageName);
+	UMaterial* Material = CastChecked<UMaterial>(StaticDuplicateObject(ParentMaterial, Package, *MaterialName));
+	Material->bUsedWithInstancedStaticMeshes = true;
+	TArray<UMaterialExpressionVertexColor*> VertexColors;
+	TArray<UMaterialExpression*> Expressions;
+	for (UMaterialExpression* Expression : Material->GetExpressions()) {
+		if (UMaterialExpressionVertexColor* VertexColor = Cast<UMaterialExpressionVertexColor>(Expression)) {
+			VertexColors.Add(VertexColor);
+		}
+		else if (Expression) {
+			Expressions.Add(Expression);
+		}
 	}
 
+	// The texel UV is in the red and alpha channels of the vertex color, and in the two custom data floats of an instance.
+	auto AddExpression = [Material](UMaterialExpression* Expression) {
+		Expression->Material = Material;
+		Material->GetExpressionCollection().AddExpression(Expression);
+		return Expression;
+	};
+	UMaterialExpressionPerInstanceCustomData* TexelU = NewObject<UMaterialExpressionPerInstanceCustomData>(Material);
+	TexelU->DataIndex = 0;
+	UMaterialExpressionPerInstanceCustomData* TexelV = NewObject<UMaterialExpressionPerInstanceCustomData>(Material);
+	TexelV->DataIndex = 1;
+	UMaterialExpressionConstant* Zero = NewObject<UMaterialExpressionConstant>(Material);
+	Zero->R = 0.0f;
+	UMaterialExpressionAppendVector* RG = NewObject<UMaterialExpressionAppendVector>(Material);
+	RG->A.Connect(0, AddExpression(TexelU));
+	RG->B.Connect(0, AddExpression(Zero));
+	UMaterialExpressionAppendVector* RGB = NewObject<UMaterialExpressionAppendVector>(Material);
+	RGB->A.Connect(0, AddExpression(RG));
+	RGB->B.Connect(0, Zero);
+	UMaterialExpressionAppendVector* RGBA = NewObject<UMaterialExpressionAppendVector>(Material);
+	RGBA->A.Connect(0, AddExpression(RGB));
+	RGBA->B.Connect(0, AddExpression(TexelV));
+	AddExpression(RGBA);
+
+	// The outputs of a vertex color are RGB, R, G, B, A and RGBA.
+	UMaterialExpression* const Replacements[] = { RGB, TexelU, Zero, Zero, TexelV, RGBA };
+	auto ReplaceVertexColor = [&](FExpressionInput& Input) {
+		if (Input.Expression && Input.Expression->IsA<UMaterialExpressionVertexColor>() && Input.OutputIndex >= 0 && Input.OutputIndex < UE_ARRAY_COUNT(Replacements)) {
+			Input.Connect(0, Replacements[Input.OutputIndex]);
+		}
+	};
+	for (UMaterialExpression* Expression : Expressions) {
+		for (FExpressionInputIterator It{ Expression }; It; ++It) {
+			ReplaceVertexColor(*It.Input);
+		}
+	}
+	for (int32 Property = 0; Property < MP_MAX; Property++) {
+		if (FExpressionInput* Input = Material->GetExpressionInputForProperty((EMaterialProperty)Property)) {
+			ReplaceVertexColor(*Input);
+		}
+	}
+	for (UMaterialExpressionVertexColor* VertexColor : VertexColors) {
+		Material->GetExpressionCollection().RemoveExpression(VertexColor);
+	}
+	Material->PreEditChange(nullptr);
+	Material->PostEditChange();
+
+	Material->SetFlags(RF_Public | RF_Standalone);
+	FAssetRegistryModule::AssetCreated(Material);
+	const FString Filename = FPackagePath::FromPackageNameChecked(PackageName).GetLocalFullPath();
+	if (!UPackage::SavePackage(Package, Material, RF_Public | RF_Standalone, *Filename, GError, nullptr, false, true, SAVE_NoError)) {
+		UE_LOG(LogTemp, Warning, TEXT("Could not save %s, it is derived again in the next editor session"), *Filename);
+	}
+	UE_LOG(LogTemp, Log, TEXT("Derived %s from %s, %d vertex colors replaced by the instance custom data"), *Material->GetPathName(), *ParentMaterial->GetPathName(), VertexColors.Num());
+	return Material;
+}
+
+/** Material instance of the static mesh output reading the attribute textures of the points, for the instanced output with bPerInstanceTexel. */
+static UMaterialInstanceConstant* CreateStaticMeshMaterial(UStaticMesh* StaticMesh, GaussianSplattingStaticMesh::FAttributeData&& AttributeData, bool bPerInstanceTexel = false)
+{
+	UMaterialInterface* ParentMaterial = bPerInstanceTexel ? LoadInstancedStaticMeshParentMaterial() : LoadStaticMeshParentMaterial();
+	UMaterialInstanceConstant* NewMaterial = NewObject<UMaterialInstanceConstant>(StaticMesh);
+	NewMaterial->SetParentEditorOnly(ParentMaterial);
+	const FIntPoint TextureSize = AttributeData.TextureSize;
+	NewMaterial->SetTextureParameterValueEditorOnly(FMaterialParameterInfo("ScaleTexture"), UGaussianSplattingEditorLibrary::CreateFloat16TextureFromData(
+		StaticMesh,
+		TEXT("ScaleTexture"),
+		TextureSize.X,
+		TextureSize.Y,
+		MoveTemp(AttributeData.Scale)));
+
+	NewMaterial->SetTextureParameterValueEditorOnly(FMaterialParameterInfo("QuadTexture"), UGaussianSplattingEditorLibrary::CreateFloat16TextureFromData(
+		StaticMesh,
+		TEXT("QuadTexture"),
+		TextureSize.X,
+		TextureSize.Y,
+		MoveTemp(AttributeData.Quat)));
+
+	NewMaterial->SetTextureParameterValueEditorOnly(FMaterialParameterInfo("ColorTexture"), UGaussianSplattingEditorLibrary::CreateFloat16TextureFromData(
+		StaticMesh,
+		TEXT("ColorTexture"),
+		TextureSize.X,
+		TextureSize.Y,
+		MoveTemp(AttributeData.Color)));
+
+	NewMaterial->PreEditChange(nullptr);
+	NewMaterial->PostEditChange();
+	return NewMaterial;
+}
+
+/** Adds the single LOD of the static mesh output, built without recomputing anything, and returns its empty mesh description. */
+static FMeshDescription& AddPointCloudSourceModel(UStaticMesh* StaticMesh)
+{
+	FStaticMeshSourceModel& NewSourceModel = StaticMesh->AddSourceModel();
+	NewSourceModel.BuildSettings.bUseMikkTSpace = false;
+	NewSourceModel.BuildSettings.bRecomputeNormals = false;
+	NewSourceModel.BuildSettings.bRecomputeTangents = false;
+	NewSourceModel.BuildSettings.bComputeWeightedNormals = false;
+	NewSourceModel.BuildSettings.bUseFullPrecisionUVs = true;
+	NewSourceModel.BuildSettings.bRemoveDegenerates = false;
+	NewSourceModel.BuildSettings.bUseBackwardsCompatibleF16TruncUVs = true;
+	NewSourceModel.BuildSettings.bGenerateLightmapUVs = false;
+	NewSourceModel.ScreenSize = 1;
 	StaticMesh->ImportVersion = EImportStaticMeshVersion::LastVersion;
+	return *StaticMesh->CreateMeshDescription(0);
+}
+
+UStaticMesh* UGaussianSplattingEditorLibrary::CreateStaticMeshFromPointCloud(UGaussianSplattingPointCloud* PointCloud, UObject* Outer, FName AssetName /*= NAME_None*/, bool bBuildRenderDataDirectly /*= false*/)
+{
+	if (PointCloud == nullptr) {
+		return nullptr;
+	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingEditorLibrary::CreateStaticMeshFromPointCloud);
+	PointCloud->LoadAllSegments();
+	const TArray<FGaussianSplattingPoint>& Points = PointCloud->GetPoints();
+	const int32 PointCount = Points.Num();
+	// Texels past the texture limit could not be looked up, such clouds are split by CreateChunkedStaticMeshesFromPointCloud.
+	const FIntPoint TextureSize = GaussianSplattingStaticMesh::GetTextureSize(PointCount);
+	if (TextureSize.X > (int32)GetMax2DTextureDimension()) {
+		UE_LOG(LogTemp, Error, TEXT("The attribute textures of the %d points of %s would be %d texels wide, above the limit of %u, use CreateChunkedStaticMeshesFromPointCloud"),
+			PointCount, *PointCloud->GetName(), TextureSize.X, GetMax2DTextureDimension());
+		return nullptr;
+	}
+	UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Outer, AssetName);
+	GaussianSplattingStaticMesh::FAttributeData AttributeData;
+	GaussianSplattingStaticMesh::BuildAttributeData(Points, AttributeData);
+
+	if (bBuildRenderDataDirectly) {
+		StaticMesh->GetStaticMaterials().Add(FStaticMaterial(CreateStaticMeshMaterial(StaticMesh, MoveTemp(AttributeData))));
+		GaussianSplattingStaticMesh::FStats Stats;
+		GaussianSplattingStaticMesh::BuildRenderData(StaticMesh, Points, TextureSize, &Stats);
+		UE_LOG(LogTemp, Log, TEXT("Built the render data of %s for %d points directly, vertices %.1f ms, upload %.1f ms, %.1f MB of vertices and %.1f MB of indices"),
+			*StaticMesh->GetName(), PointCount, Stats.VertexSeconds * 1000.0, Stats.UploadSeconds * 1000.0, Stats.NumVertexBytes / (1024.0 * 1024.0), Stats.NumIndexBytes / (1024.0 * 1024.0));
+		// Render data built directly is not saved, a mesh that will be keeps the mesh description to rebuild it from when
+		// it is loaded or cooked, still skipping the mesh build now.
+		if (Outer && !Outer->IsIn(GetTransientPackage()) && !Outer->HasAnyFlags(RF_Transient)) {
+			GaussianSplattingStaticMesh::BuildMeshDescription(AddPointCloudSourceModel(StaticMesh), Points, TextureSize);
+			StaticMesh->CommitMeshDescription(0);
+			StaticMesh->SetIsBuiltAtRuntime(false);
+			StaticMesh->MarkPackageDirty();
+		}
+		return StaticMesh;
+	}
+
+	GaussianSplattingStaticMesh::BuildMeshDescription(AddPointCloudSourceModel(StaticMesh), Points, TextureSize);
+	StaticMesh->GetStaticMaterials().Add(FStaticMaterial(CreateStaticMeshMaterial(StaticMesh, MoveTemp(AttributeData))));
+	StaticMesh->CommitMeshDescription(0);
 	StaticMesh->Build();
 	StaticMesh->PostEditChange();
 	StaticMesh->MarkPackageDirty();
@@ -227,6 +505,81 @@ UStaticMesh* UGaussianSplattingEditorLibrary::CreateStaticMeshFromPointCloud(UGa
 	return StaticMesh;
 }
 
+/** Unit quad every instance of the instanced output draws, with the corners and UVs of the quads of the static mesh. */
+static UStaticMesh* CreateInstancedQuadMesh(UObject* Outer)
+{
+	UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Outer, TEXT("Quad"));
+	FStaticMeshSourceModel& NewSourceModel = StaticMesh->AddSourceModel();
+	FMeshDescription& NewMeshDescription = *StaticMesh->CreateMeshDescription(0);
+	FStaticMeshAttributes AttributeGetter = FStaticMeshAttributes(NewMeshDescription);
+	AttributeGetter.Register();
+	NewSourceModel.BuildSettings.bRecomputeNormals = false;
+	NewSourceModel.BuildSettings.bRecomputeTangents = false;
+	NewSourceModel.BuildSettings.bUseFullPrecisionUVs = true;
+	NewSourceModel.BuildSettings.bGenerateLightmapUVs = false;
+
+	TVertexAttributesRef<FVector3f> VertexPositions = AttributeGetter.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector2f> UVs = AttributeGetter.GetVertexInstanceUVs();
+	UVs.SetNumChannels(1);
+	const FPolygonGroupID PolygonGroup0 = NewMeshDescription.CreatePolygonGroup();
+	const FVector2f Corners[4] = { FVector2f(0.0f, 0.0f), FVector2f(1.0f, 0.0f), FVector2f(1.0f, 1.0f), FVector2f(0.0f, 1.0f) };
+	FVertexInstanceID VertexInstanceIDs[4];
+	for (int32 Corner = 0; Corner < 4; Corner++) {
+		const FVertexID VertexID = NewMeshDescription.CreateVertex();
+		VertexPositions[VertexID] = FVector3f(Corners[Corner].X * 2.0f - 1.0f, 0.0f, Corners[Corner].Y * 2.0f - 1.0f);
+		VertexInstanceIDs[Corner] = NewMeshDescription.CreateVertexInstance(VertexID);
+		UVs.Set(VertexInstanceIDs[Corner], 0, Corners[Corner]);
+	}
+	NewMeshDescription.CreateTriangle(PolygonGroup0, { VertexInstanceIDs[0], VertexInstanceIDs[1], VertexInstanceIDs[2] });
+	NewMeshDescription.CreateTriangle(PolygonGroup0, { VertexInstanceIDs[0], VertexInstanceIDs[2], VertexInstanceIDs[3] });
+	AttributeGetter.GetPolygonGroupMaterialSlotNames()[PolygonGroup0] = "LOD0_Section0";
+	NewSourceModel.ScreenSize = 1;
+	StaticMesh->CommitMeshDescription(0);
+	StaticMesh->ImportVersion = EImportStaticMeshVersion::LastVersion;
+	return StaticMesh;
+}
+
+void UGaussianSplattingEditorLibrary::SetupPointCloudToInstancedStaticMeshComponent(UGaussianSplattingPointCloud* PointCloud, UInstancedStaticMeshComponent* Component)
+{
+	if (PointCloud == nullptr || Component == nullptr) {
+		return;
+	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingEditorLibrary::SetupPointCloudToInstancedStaticMeshComponent);
+	if (LoadInstancedStaticMeshParentMaterial() == nullptr) {
+		UE_LOG(LogTemp, Error, TEXT("No instanced material, the instances of %s could not find their texels"), *PointCloud->GetName());
+		return;
+	}
+	const double StartTime = FPlatformTime::Seconds();
+	PointCloud->LoadAllSegments();
+	const TArray<FGaussianSplattingPoint>& Points = PointCloud->GetPoints();
+	GaussianSplattingStaticMesh::FAttributeData AttributeData;
+	GaussianSplattingStaticMesh::BuildAttributeData(Points, AttributeData);
+	TArray<FTransform> Transforms;
+	TArray<float> CustomData;
+	GaussianSplattingStaticMesh::BuildInstanceData(Points, AttributeData.TextureSize, Transforms, CustomData);
+
+	UStaticMesh* QuadMesh = CreateInstancedQuadMesh(Component);
+	QuadMesh->GetStaticMaterials().Add(FStaticMaterial(CreateStaticMeshMaterial(QuadMesh, MoveTemp(AttributeData), true)));
+	QuadMesh->Build();
+	QuadMesh->PostEditChange();
+
+	Component->Modify();
+	Component->ClearInstances();
+	// Millions of instances must not each create a physics body.
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetStaticMesh(QuadMesh);
+	Component->SetNumCustomDataFloats(GaussianSplattingStaticMesh::NumInstanceCustomDataFloats);
+	Component->AddInstances(Transforms, false, false);
+	// The custom data of all instances is filled at once and the render state recreated a single time.
+	check(Component->PerInstanceSMCustomData.Num() == CustomData.Num());
+	Component->PerInstanceSMCustomData = MoveTemp(CustomData);
+	Component->MarkRenderStateDirty();
+	Component->MarkPackageDirty();
+	const int64 NumInstanceBytes = (int64)Points.Num() * (sizeof(FRenderTransform) + GaussianSplattingStaticMesh::NumInstanceCustomDataFloats * sizeof(float));
+	UE_LOG(LogTemp, Log, TEXT("Set up %d instances of %s on %s, %.1f ms, about %.1f MB of instance data on the GPU"),
+		Points.Num(), *PointCloud->GetName(), *Component->GetName(), (FPlatformTime::Seconds() - StartTime) * 1000.0, NumInstanceBytes / (1024.0 * 1024.0));
+}
+
 UNiagaraSystem* UGaussianSplattingEditorLibrary::CreateNiagaraSystemFromPointCloud(UGaussianSplattingPointCloud* PointCloud, UObject* Outer, FName AssetName /*= NAME_None*/, UNiagaraSystem* Template /*= nullptr*/)
 {
 	if (PointCloud == nullptr) {
@@ -535,145 +888,437 @@ FString GetDatasetNameName(const FString& FolderPath)
 	return DatasetName;
 }
 
-void UGaussianSplattingEditorLibrary::ImportPointClouds(UWorld* World, FString SearchDir, FString SaveContentDir, UNiagaraSystem* TemplateSystem /*= nullptr*/, bool bUseStandaloneNiagraSystem /*= false */)
+static TAutoConsoleVariable<bool> CVarGaussianSplattingConcurrentSave(
+	TEXT("GaussianSplatting.ConcurrentSave"),
+	true,
+	TEXT("Saves the point clouds written by an import or a repartition concurrently. When false they are saved one after the other."));
+
+/**
+ * Marks freshly written assets, one per package, as assets and saves their packages as one batch. Clouds whose payloads were
+ * not encoded beforehand compress them while they are serialized, so the packages are saved concurrently unless
+ * GaussianSplatting.ConcurrentSave is off. Returns the number of packages saved.
+ */
+static int32 SaveAssetPackages(TConstArrayView<UObject*> Assets, bool bNewAssets = true)
 {
-	TArray<TPair<FString, FGaussianSplattingPointCloudMetaInfo>> PlyInfoList;
-	SearchPlyFileRecursive(SearchDir, PlyInfoList);
-
-	TArray<TPair<UGaussianSplattingPointCloud*, FVector>> PointClouds;
-
-	for (auto PlyInfo : PlyInfoList) {
-		FString FolderPart, FileNamePart, ExtensionPart;
-		FPaths::Split(PlyInfo.Key, FolderPart, FileNamePart, ExtensionPart);
-		FString DatasetName = GetDatasetNameName(FolderPart);
-
-		UPackage* NewPackage = CreatePackage(*(SaveContentDir / DatasetName));
-
-		UGaussianSplattingPointCloud* PointCloud = UGaussianSplattingEditorLibrary::LoadSplatPly(PlyInfo.Key, NewPackage, *DatasetName);
-		PointCloud->SetFlags(RF_Public | RF_Standalone);
-		PointCloud->MarkPackageDirty();
-
-		FAssetRegistryModule::AssetCreated(PointCloud);
-		FPackagePath PackagePath = FPackagePath::FromPackageNameChecked(NewPackage->GetName());
-		FString PackageLocalPath = PackagePath.GetLocalFullPath();
-		UPackage::SavePackage(NewPackage, PointCloud, RF_Public | RF_Standalone, *PackageLocalPath, GError, nullptr, false, true, SAVE_NoError);
-
-		PointClouds.Add({ PointCloud, PlyInfo.Value.Location });
+	TRACE_CPUPROFILER_EVENT_SCOPE(SaveAssetPackages);
+	if (Assets.IsEmpty()) {
+		return 0;
 	}
-
-	for (auto PointCloudPair : PointClouds) {
-		ANiagaraActor* NiagaraActor = World->SpawnActor<ANiagaraActor>(PointCloudPair.Value, FRotator());
-		UNiagaraComponent* NiagaraComponent = NiagaraActor->GetNiagaraComponent();
-		UNiagaraSystem* Niagara = nullptr;
-		if (bUseStandaloneNiagraSystem) {
-			Niagara = UGaussianSplattingEditorLibrary::CreateNiagaraSystemFromPointCloud(PointCloudPair.Key, NiagaraActor->GetPackage(), NAME_None, TemplateSystem);
+	TArray<FPackageSaveInfo> SaveInfos;
+	for (UObject* Asset : Assets) {
+		Asset->SetFlags(RF_Public | RF_Standalone);
+		Asset->MarkPackageDirty();
+		if (bNewAssets) {
+			FAssetRegistryModule::AssetCreated(Asset);
 		}
-		else {
-			SetupPointCloudToNiagaraComponent(PointCloudPair.Key, NiagaraComponent, TemplateSystem);
+		FPackageSaveInfo& SaveInfo = SaveInfos.AddDefaulted_GetRef();
+		SaveInfo.Package = Asset->GetPackage();
+		SaveInfo.Asset = Asset;
+		SaveInfo.Filename = FPackagePath::FromPackageNameChecked(SaveInfo.Package->GetName()).GetLocalFullPath();
+	}
+	int32 NumSaved = 0;
+	if (CVarGaussianSplattingConcurrentSave.GetValueOnGameThread()) {
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_NoError;
+		SaveArgs.Error = GError;
+		TArray<FSavePackageResultStruct> Results;
+		UPackage::SaveConcurrent(SaveInfos, SaveArgs, Results);
+		for (int32 i = 0; i < Results.Num(); i++) {
+			if (Results[i].Result != ESavePackageResult::Success) {
+				UE_LOG(LogTemp, Warning, TEXT("Failed to save %s."), *SaveInfos[i].Filename);
+			}
+			else {
+				NumSaved++;
+			}
 		}
-		if (Niagara) {
-			Niagara->ClearFlags(RF_Public | RF_Standalone);
-			NiagaraComponent->SetAsset(Niagara);
-			NiagaraActor->Modify();
-			NiagaraActor->MarkPackageDirty();
+	}
+	else {
+		for (const FPackageSaveInfo& SaveInfo : SaveInfos) {
+			if (UPackage::SavePackage(SaveInfo.Package, SaveInfo.Asset, RF_Public | RF_Standalone, *SaveInfo.Filename, GError, nullptr, false, true, SAVE_NoError)) {
+				NumSaved++;
+			}
 		}
-		NiagaraActor->SetActorLabel(PointCloudPair.Key->GetName());
-		bool bPromptUserToSave = false;
-		bool bSaveMapPackages = true;
-		bool bSaveContentPackages = true;
-		bool bFastSave = true;
-		FEditorFileUtils::SaveDirtyPackages(bPromptUserToSave, bSaveMapPackages, bSaveContentPackages, bFastSave);
 	}
+	return NumSaved;
 }
 
-void UGaussianSplattingEditorLibrary::RepartitionPointClouds(UWorld* World, FString PartitionBaseName /*= "Cell"*/, int32 CellSize /*= 51200*/, UNiagaraSystem* TemplateSystem /*= nullptr*/, bool bUseStandaloneNiagraSystem /*= false */)
+static int32 SavePointCloudPackages(TConstArrayView<UGaussianSplattingPointCloud*> PointClouds, bool bNewAssets = true)
+{
+	return SaveAssetPackages(TArray<UObject*>(PointClouds), bNewAssets);
+}
+
+/** Dirty maps and actor packages are saved once after the whole batch of actors is spawned. */
+static void SaveSpawnedActorPackages()
+{
+	bool bPromptUserToSave = false;
+	bool bSaveMapPackages = true;
+	bool bSaveContentPackages = true;
+	bool bFastSave = true;
+	FEditorFileUtils::SaveDirtyPackages(bPromptUserToSave, bSaveMapPackages, bSaveContentPackages, bFastSave);
+}
+
+/** Point clouds of the Niagara actors of the world, and the content folder of the first one where the cells are saved. */
+static void GatherPartitionedClouds(UWorld* World, TMap<UNiagaraComponent*, UGaussianSplattingPointCloud*>& OutClouds, FString& OutSaveContentDir)
 {
 	TArray<AActor*> Actors;
 	UGameplayStatics::GetAllActorsOfClass(World, ANiagaraActor::StaticClass(), Actors);
-	TMap<UNiagaraComponent*, UGaussianSplattingPointCloud*> OldClouds;
-	FString SaveContentDir;
 	for (auto Actor : Actors) {
 		UNiagaraComponent* NiagaraComponent = Actor->GetComponentByClass<UNiagaraComponent>();
 		if (UNiagaraDataInterfaceGaussianSplattingPointCloud* PointCloudDI = UNiagaraFunctionLibrary::GetDataInterface<UNiagaraDataInterfaceGaussianSplattingPointCloud>(NiagaraComponent, "PointCloud")) {
 			UGaussianSplattingPointCloud* PointCloud = PointCloudDI->GetPointCloud();
-			OldClouds.Add(NiagaraComponent, PointCloud);
-			if (SaveContentDir.IsEmpty()) {
-				SaveContentDir = FPaths::GetPath(PointCloud->GetPackage()->GetPathName());
+			OutClouds.Add(NiagaraComponent, PointCloud);
+			if (OutSaveContentDir.IsEmpty()) {
+				OutSaveContentDir = FPaths::GetPath(PointCloud->GetPackage()->GetPathName());
 			}
 		}
 	}
-	FBox2D TotalBound;
-	for (auto CloudPair : OldClouds) {
-		FVector BoxExtent = CloudPair.Value->CalcBounds().GetExtent();
-		FVector Location = CloudPair.Key->GetComponentLocation();
-		TotalBound += FBox2D(
-			FVector2D(Location.X - BoxExtent.X, Location.Y - BoxExtent.Y),
-			FVector2D(Location.X + BoxExtent.X, Location.Y + BoxExtent.Y)
-		);
+}
+
+/** Spawns a Niagara actor displaying the cloud, with its own copy of the template system when standalone. */
+static void SpawnPointCloudActor(UWorld* World, UGaussianSplattingPointCloud* PointCloud, const FVector& Location, UNiagaraSystem* TemplateSystem, bool bUseStandaloneNiagraSystem)
+{
+	ANiagaraActor* NiagaraActor = World->SpawnActor<ANiagaraActor>(Location, FRotator());
+	UNiagaraComponent* NiagaraComponent = NiagaraActor->GetNiagaraComponent();
+	UNiagaraSystem* Niagara = nullptr;
+	if (bUseStandaloneNiagraSystem) {
+		Niagara = UGaussianSplattingEditorLibrary::CreateNiagaraSystemFromPointCloud(PointCloud, NiagaraActor->GetPackage(), NAME_None, TemplateSystem);
 	}
-	TMap<FIntPoint, TArray<TPair<UGaussianSplattingPointCloud*, FVector>>> Partition;
-	for (auto CloudPair : OldClouds) {
-		FVector BoxExtent = CloudPair.Value->CalcBounds().GetExtent();
-		FVector Location = CloudPair.Key->GetComponentLocation();
-		FBox2D Bound = FBox2D(
-			FVector2D(Location.X - BoxExtent.X, Location.Y - BoxExtent.Y),
-			FVector2D(Location.X + BoxExtent.X, Location.Y + BoxExtent.Y)
-		);
+	else {
+		UGaussianSplattingEditorLibrary::SetupPointCloudToNiagaraComponent(PointCloud, NiagaraComponent, TemplateSystem);
+	}
+	if (Niagara) {
+		Niagara->ClearFlags(RF_Public | RF_Standalone);
+		NiagaraComponent->SetAsset(Niagara);
+		NiagaraActor->Modify();
+		NiagaraActor->MarkPackageDirty();
+	}
+	NiagaraActor->SetActorLabel(PointCloud->GetName());
+}
+
+/** Bumped whenever PLY files are converted differently, so the next import converts every cloud again. */
+static constexpr uint32 PointCloudImportVersion = 1;
+
+/** Hash of what an imported cloud and its actor depend on besides the contents of its file. */
+static uint64 HashImportSettings(const FGaussianSplattingPointCloudMetaInfo& MetaInfo, const UNiagaraSystem* TemplateSystem, bool bUseStandaloneNiagraSystem)
+{
+	FString MetaString;
+	FJsonObjectConverter::UStructToJsonObjectString(MetaInfo, MetaString, 0, 0, 0, nullptr, false);
+	const FString Settings = FString::Printf(TEXT("%u|%s|%s|%d"), PointCloudImportVersion, *MetaString, TemplateSystem ? *TemplateSystem->GetPathName() : TEXT(""), bUseStandaloneNiagraSystem ? 1 : 0);
+	return FXxHash64::HashBuffer(*Settings, Settings.Len() * sizeof(TCHAR)).Hash;
+}
+
+/** Cloud saved by an earlier import, loading it unless it is already in memory. */
+static UGaussianSplattingPointCloud* LoadImportedCloud(const FString& PackageName, const FString& ObjectPath)
+{
+	UGaussianSplattingPointCloud* PointCloud = FindObject<UGaussianSplattingPointCloud>(nullptr, *ObjectPath);
+	if (PointCloud == nullptr && FPackageName::DoesPackageExist(PackageName)) {
+		PointCloud = LoadObject<UGaussianSplattingPointCloud>(nullptr, *ObjectPath);
+	}
+	return PointCloud;
+}
 
-		if (Bound.GetArea() > 0) {
-			FVector2D MinSide = (Bound.Min - TotalBound.Min) / CellSize;
-			FVector2D MaxSide = (Bound.Max - TotalBound.Min) / CellSize;
-			for (int i = std::floor(MinSide.X); i <= std::ceil(MaxSide.X); i++) {
-				for (int j = std::floor(MinSide.Y); j <= std::ceil(MaxSide.Y); j++) {
-					Partition.FindOrAdd({ i,j }).Add({ CloudPair.Value, Location });
+/**
+ * Source info of a cloud saved by an earlier import, read from the cloud when it is in memory and otherwise from the asset
+ * registry tags of its package, so unchanged clouds are not loaded to be compared. Packages saved without the tags are loaded.
+ */
+static bool FindImportedSourceInfo(const FString& PackageName, const FString& ObjectPath, FGaussianSplattingSourceInfo& OutSourceInfo)
+{
+	if (const UGaussianSplattingPointCloud* Loaded = FindObject<UGaussianSplattingPointCloud>(nullptr, *ObjectPath)) {
+		OutSourceInfo = Loaded->GetSourceInfo();
+		return true;
+	}
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
+	if (AssetData.IsValid() && UGaussianSplattingPointCloud::GetSourceInfoFromAssetData(AssetData, OutSourceInfo)) {
+		return true;
+	}
+	if (const UGaussianSplattingPointCloud* Loaded = LoadImportedCloud(PackageName, ObjectPath)) {
+		OutSourceInfo = Loaded->GetSourceInfo();
+		return true;
+	}
+	return false;
+}
+
+/** Destroys the actors placed for a reimported cloud, which is spawned again once its points are updated. */
+static void DestroyImportedCloudActors(UWorld* World, const TMap<UNiagaraComponent*, UGaussianSplattingPointCloud*>& PlacedClouds, UGaussianSplattingPointCloud* PointCloud)
+{
+	for (const TPair<UNiagaraComponent*, UGaussianSplattingPointCloud*>& PlacedCloud : PlacedClouds) {
+		if (PlacedCloud.Value == PointCloud) {
+			World->DestroyActor(PlacedCloud.Key->GetOwner());
+		}
+	}
+}
+
+FGaussianSplattingImportReport UGaussianSplattingEditorLibrary::ImportPointClouds(UWorld* World, FString SearchDir, FString SaveContentDir, UNiagaraSystem* TemplateSystem /*= nullptr*/, bool bUseStandaloneNiagraSystem /*= false */, int32 MaxInFlightMegabytes /*= 8192*/, bool bForceReimport /*= false*/)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingEditorLibrary::ImportPointClouds);
+	const double StartTime = FPlatformTime::Seconds();
+	FGaussianSplattingImportReport Report;
+	TArray<TPair<FString, FGaussianSplattingPointCloudMetaInfo>> PlyInfoList;
+	SearchPlyFileRecursive(SearchDir, PlyInfoList);
+	FScopedSlowTask SlowTask(2.0f, NSLOCTEXT("GaussianSplatting", "ImportPointClouds", "Importing point clouds"));
+	SlowTask.MakeDialog();
+
+	// Clouds of an earlier import are kept when the size and time stamp of their file and the settings match. A file whose
+	// time stamp alone changed is read and hashed again, and only parsed when its contents differ.
+	SlowTask.EnterProgressFrame(1.0f);
+	TMap<UNiagaraComponent*, UGaussianSplattingPointCloud*> PlacedClouds;
+	FString PlacedContentDir;
+	GatherPartitionedClouds(World, PlacedClouds, PlacedContentDir);
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().ScanPathsSynchronous({ SaveContentDir }, true);
+	const int32 NumPlyFiles = PlyInfoList.Num();
+	TArray<FString> PackageNames;
+	TArray<FString> ObjectPaths;
+	TArray<FGaussianSplattingSourceInfo> SourceInfos;
+	TArray<bool> Unchanged;
+	PackageNames.SetNum(NumPlyFiles);
+	ObjectPaths.SetNum(NumPlyFiles);
+	SourceInfos.SetNum(NumPlyFiles);
+	Unchanged.Init(false, NumPlyFiles);
+
+	// New clouds are created on the game thread, nothing references them until they are saved so the pipeline fills them on
+	// workers. Clouds of an earlier import may be in use, they are left out of the pipeline and updated in place once parsed.
+	TArray<FString> Files;
+	TArray<UGaussianSplattingPointCloud*> NewClouds;
+	TArray<uint64> KnownHashes;
+	TArray<int32> PlyIndices;
+	for (int32 PlyIndex = 0; PlyIndex < NumPlyFiles; PlyIndex++) {
+		const FString& PlyPath = PlyInfoList[PlyIndex].Key;
+		FString FolderPart, FileNamePart, ExtensionPart;
+		FPaths::Split(PlyPath, FolderPart, FileNamePart, ExtensionPart);
+		const FString DatasetName = GetDatasetNameName(FolderPart);
+		const FString& PackageName = PackageNames[PlyIndex] = SaveContentDir / DatasetName;
+		const FString& ObjectPath = ObjectPaths[PlyIndex] = PackageName + TEXT(".") + DatasetName;
+		const FFileStatData FileStat = IFileManager::Get().GetStatData(*PlyPath);
+		FGaussianSplattingSourceInfo& SourceInfo = SourceInfos[PlyIndex];
+		SourceInfo.FilePath = PlyPath;
+		SourceInfo.FileSize = FileStat.FileSize;
+		SourceInfo.Timestamp = FileStat.ModificationTime;
+		SourceInfo.SettingsHash = HashImportSettings(PlyInfoList[PlyIndex].Value, TemplateSystem, bUseStandaloneNiagraSystem);
+
+		FGaussianSplattingSourceInfo Previous;
+		const bool bExisting = FindImportedSourceInfo(PackageName, ObjectPath, Previous);
+		uint64 KnownHash = 0;
+		if (bExisting && !bForceReimport) {
+			if (Previous.ContentHash != 0 && Previous.SettingsHash == SourceInfo.SettingsHash && Previous.FileSize == SourceInfo.FileSize) {
+				if (Previous.Timestamp == SourceInfo.Timestamp) {
+					Unchanged[PlyIndex] = true;
+					continue;
 				}
+				KnownHash = Previous.ContentHash;
 			}
 		}
+		Files.Add(PlyPath);
+		NewClouds.Add(bExisting ? nullptr : NewObject<UGaussianSplattingPointCloud>(CreatePackage(*PackageName), *DatasetName));
+		KnownHashes.Add(KnownHash);
+		PlyIndices.Add(PlyIndex);
 	}
-	TMap<UGaussianSplattingPointCloud*, FVector> RepartitionPointClouds;
-	for (const auto& Cell : Partition) {
-		FVector CellLocation = FVector(TotalBound.Min.X + Cell.Key.X * CellSize + CellSize / 2.0f, TotalBound.Min.Y + Cell.Key.Y * CellSize + CellSize / 2.0f, 0.0f);
-		FBox2D CellBound = FBox2D(
-			FVector2D(TotalBound.Min.X + Cell.Key.X * CellSize, TotalBound.Min.Y + Cell.Key.Y * CellSize),
-			FVector2D(TotalBound.Min.X + Cell.Key.X * CellSize + CellSize, TotalBound.Min.Y + Cell.Key.Y * CellSize + CellSize)
-		);
-		TArray<FGaussianSplattingPoint> SourceWorldPoints;
-		for (auto Source : Cell.Value) {
-			TArray<FGaussianSplattingPoint> LocalPoints = Source.Key->GetPoints();
-			for (auto& Point : LocalPoints) {
-				Point.Position = FVector3f(Source.Value) + Point.Position;
+	GaussianSplattingImportPipeline::FSettings PipelineSettings;
+	PipelineSettings.MaxInFlightBytes = (int64)FMath::Max(MaxInFlightMegabytes, 1) * 1024 * 1024;
+	TArray<GaussianSplattingImportPipeline::FFileResult> Results;
+	GaussianSplattingImportPipeline::FStats PipelineStats;
+	TArray<UGaussianSplattingPointCloud*> PointClouds;
+	TArray<UGaussianSplattingPointCloud*> SpawnClouds;
+	TArray<FVector> SpawnLocations;
+	double SaveSeconds = 0.0;
+	// The payloads of new clouds are already compressed, saving a batch of finished clouds only writes them.
+	GaussianSplattingImportPipeline::Run(Files, NewClouds, KnownHashes, PipelineSettings, [&](TConstArrayView<int32> FileIndices) {
+		TArray<UGaussianSplattingPointCloud*> CreatedClouds;
+		TArray<UGaussianSplattingPointCloud*> UpdatedClouds;
+		TArray<UGaussianSplattingPointCloud*> RestampedClouds;
+		for (const int32 FileIndex : FileIndices) {
+			const int32 PlyIndex = PlyIndices[FileIndex];
+			UGaussianSplattingPointCloud* PointCloud = NewClouds[FileIndex];
+			if (Results[FileIndex].bUnchanged) {
+				// Only the time stamp of the file changed, the cloud remembers the new one so the next import does not read the file.
+				Unchanged[PlyIndex] = true;
+				if (UGaussianSplattingPointCloud* Existing = LoadImportedCloud(PackageNames[PlyIndex], ObjectPaths[PlyIndex])) {
+					SourceInfos[PlyIndex].ContentHash = Results[FileIndex].ContentHash;
+					Existing->SetSourceInfo(SourceInfos[PlyIndex]);
+					RestampedClouds.Add(Existing);
+				}
+				continue;
 			}
-			SourceWorldPoints.Append(LocalPoints);
-		}
-		TArray<FGaussianSplattingPoint> CellPoints;
-		for (auto Point : SourceWorldPoints) {
-			if (CellBound.IsInside(FVector2D(Point.Position.X, Point.Position.Y))) {
-				Point.Position = Point.Position - FVector3f(CellLocation);
-				CellPoints.Add(Point);
+			if (!Results[FileIndex].bLoaded) {
+				UE_LOG(LogTemp, Warning, TEXT("No points were read from %s, it is skipped."), *Files[FileIndex]);
+				if (PointCloud) {
+					PointCloud->MarkAsGarbage();
+				}
+				continue;
 			}
-		}
-		if (!CellPoints.IsEmpty()) {
-			FString CellName = FString::Printf(TEXT("%s_%d_%d"), *PartitionBaseName, Cell.Key.X, Cell.Key.Y);
-			UGaussianSplattingPointCloud* PointCloud = nullptr;
-			UPackage* Package = nullptr;
-			PointCloud = LoadObject<UGaussianSplattingPointCloud>(nullptr, *(SaveContentDir / CellName + "." + CellName));
 			if (PointCloud) {
-				Package = PointCloud->GetPackage();
+				CreatedClouds.Add(PointCloud);
 			}
 			else {
-				Package = CreatePackage(*(SaveContentDir / CellName));
-				PointCloud = NewObject<UGaussianSplattingPointCloud>(Package, *CellName);
+				// A reimported cloud keeps its settings and every reference to it, only its points and source change.
+				PointCloud = LoadImportedCloud(PackageNames[PlyIndex], ObjectPaths[PlyIndex]);
+				if (PointCloud == nullptr) {
+					UE_LOG(LogTemp, Warning, TEXT("Failed to load %s to reimport %s, it is skipped."), *ObjectPaths[PlyIndex], *Files[FileIndex]);
+					continue;
+				}
+				DestroyImportedCloudActors(World, PlacedClouds, PointCloud);
+				PointCloud->SetPoints(Results[FileIndex].Points);
+				Results[FileIndex].Points.Empty();
+				UpdatedClouds.Add(PointCloud);
+			}
+			SourceInfos[PlyIndex].ContentHash = Results[FileIndex].ContentHash;
+			PointCloud->SetSourceInfo(SourceInfos[PlyIndex]);
+			PointClouds.Add(PointCloud);
+			SpawnClouds.Add(PointCloud);
+			SpawnLocations.Add(PlyInfoList[PlyIndex].Value.Location);
+		}
+		const double SaveStart = FPlatformTime::Seconds();
+		SavePointCloudPackages(CreatedClouds);
+		SavePointCloudPackages(UpdatedClouds, false);
+		SavePointCloudPackages(RestampedClouds, false);
+		SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+		// Saving encoded the payloads of the updated clouds, the points past their first segment can be decoded again.
+		for (UGaussianSplattingPointCloud* UpdatedCloud : UpdatedClouds) {
+			UpdatedCloud->ReleaseSegments();
+		}
+	}, Results, PipelineStats);
+	for (int32 PlyIndex = 0; PlyIndex < NumPlyFiles; PlyIndex++) {
+		if (Unchanged[PlyIndex]) {
+			Report.NumUnchanged++;
+			UGaussianSplattingPointCloud* Existing = LoadImportedCloud(PackageNames[PlyIndex], ObjectPaths[PlyIndex]);
+			if (Existing && PlacedClouds.FindKey(Existing) == nullptr) {
+				SpawnClouds.Add(Existing);
+				SpawnLocations.Add(PlyInfoList[PlyIndex].Value.Location);
 			}
-			PointCloud->SetPoints(CellPoints);
-			PointCloud->SetFlags(RF_Public | RF_Standalone);
-			PointCloud->MarkPackageDirty();
-			FAssetRegistryModule::AssetCreated(PointCloud);
-			FPackagePath PackagePath = FPackagePath::FromPackageNameChecked(Package->GetName());
-			FString PackageLocalPath = PackagePath.GetLocalFullPath();
-			UPackage::SavePackage(Package, PointCloud, RF_Public | RF_Standalone, *PackageLocalPath, GError, nullptr, false, true, SAVE_NoError);
-			RepartitionPointClouds.Add(PointCloud, CellLocation);
 		}
 	}
+
+	SlowTask.EnterProgressFrame(1.0f);
+	for (int32 CloudIndex = 0; CloudIndex < SpawnClouds.Num(); CloudIndex++) {
+		SpawnPointCloudActor(World, SpawnClouds[CloudIndex], SpawnLocations[CloudIndex], TemplateSystem, bUseStandaloneNiagraSystem);
+	}
+	if (!SpawnClouds.IsEmpty()) {
+		SaveSpawnedActorPackages();
+	}
+
+	Report.NumFiles = NumPlyFiles;
+	Report.NumClouds = PointClouds.Num() + Report.NumUnchanged;
+	Report.NumPoints = PipelineStats.Read.NumPoints;
+	Report.ReadPointsPerSecond = PipelineStats.Read.GetPointsPerSecond();
+	Report.ReadMegabytesPerSecond = PipelineStats.Read.Seconds > 0.0 ? PipelineStats.NumBytes / (1024.0 * 1024.0) / PipelineStats.Read.Seconds : 0.0;
+	Report.DecodePointsPerSecond = PipelineStats.Decode.GetPointsPerSecond();
+	Report.SortPointsPerSecond = PipelineStats.Sort.GetPointsPerSecond();
+	Report.CompressPointsPerSecond = PipelineStats.Compress.GetPointsPerSecond();
+	Report.SavePointsPerSecond = SaveSeconds > 0.0 ? Report.NumPoints / SaveSeconds : 0.0;
+	Report.PipelinePointsPerSecond = PipelineStats.Seconds > 0.0 ? Report.NumPoints / PipelineStats.Seconds : 0.0;
+	Report.PeakInFlightMegabytes = PipelineStats.PeakInFlightBytes / (1024.0 * 1024.0);
+	Report.Seconds = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogTemp, Log, TEXT("Imported %d of %d point clouds, %d of them unchanged, %lld points in %.1f s. Points per second: read %.0f (%.1f MB/s), decode %.0f, sort %.0f, compress %.0f, save %.0f, pipeline %.0f. Peak in flight %.0f MB"),
+		Report.NumClouds, Report.NumFiles, Report.NumUnchanged, Report.NumPoints, Report.Seconds, Report.ReadPointsPerSecond, Report.ReadMegabytesPerSecond, Report.DecodePointsPerSecond,
+		Report.SortPointsPerSecond, Report.CompressPointsPerSecond, Report.SavePointsPerSecond, Report.PipelinePointsPerSecond, Report.PeakInFlightMegabytes);
+
+	const FString ReportPath = FPackageName::LongPackageNameToFilename(SaveContentDir / TEXT("ImportReport"), TEXT(".json"));
+	TSharedRef<FJsonObject> ReportObject = MakeShared<FJsonObject>();
+	FJsonObjectConverter::UStructToJsonObject(FGaussianSplattingImportReport::StaticStruct(), &Report, ReportObject, 0, 0);
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
+	if (FJsonSerializer::Serialize(ReportObject, JsonWriter) && JsonWriter->Close()) {
+		FFileHelper::SaveStringToFile(JsonString, *ReportPath);
+	}
+	return Report;
+}
+
+/** Drops the splats duplicated where the clouds overlap, Sources then views the remaining points of the clouds in OutPoints. */
+static void RemovePartitionOverlaps(TArray<GaussianSplattingBinning::FSource>& Sources, EGaussianSplattingOverlapMode OverlapMode, float OverlapCellSize, TArray<TArray<FGaussianSplattingPoint>>& OutPoints, FGaussianSplattingPartitionManifest& InOutManifest)
+{
+	GaussianSplattingBinning::FOverlapSettings Settings;
+	Settings.Mode = OverlapMode == EGaussianSplattingOverlapMode::Ownership ? GaussianSplattingBinning::EOverlapMode::Ownership
+		: OverlapMode == EGaussianSplattingOverlapMode::Similarity ? GaussianSplattingBinning::EOverlapMode::Similarity
+		: GaussianSplattingBinning::EOverlapMode::Keep;
+	Settings.CellSize = OverlapCellSize;
+	TArray<GaussianSplattingBinning::FSource> RemainingSources;
+	GaussianSplattingBinning::FOverlapStats Stats;
+	GaussianSplattingBinning::RemoveOverlaps(Sources, Settings, OutPoints, RemainingSources, &Stats);
+	Sources = MoveTemp(RemainingSources);
+	InOutManifest.NumOverlapsRemoved = Stats.NumRemoved;
+	UE_LOG(LogTemp, Log, TEXT("Removed %d of the %d points where the clouds overlap, %.1f ms"), Stats.NumRemoved, Stats.NumCandidates, Stats.Seconds * 1000.0);
+}
+
+/** Octree cells are named after their octant path from the root, one digit per level. */
+static FString GetOctreeCellName(const FString& BaseName, const GaussianSplattingBinning::FOctreeCell& Cell)
+{
+	FString Path = TEXT("R");
+	for (int32 Level = Cell.Depth - 1; Level >= 0; Level--) {
+		Path.AppendChar(TEXT('0') + ((Cell.Path >> (3 * Level)) & 7));
+	}
+	return FString::Printf(TEXT("%s_%s"), *BaseName, *Path);
+}
+
+/**
+ * Cells are put in the coarse-to-fine order of SetPoints concurrently, only the assets are touched on the game thread. They
+ * are sorted from the last one in batches of about a quarter of the binned points left, which are released after every
+ * batch, so the binned and the sorted points are never both held whole.
+ */
+static void SortPartitionCells(TConstArrayView<int32> CellStarts, TArray<FGaussianSplattingPoint>& InOutBinnedPoints, TArray<TArray<FGaussianSplattingPoint>>& OutCellPoints)
+{
+	const int32 NumCells = CellStarts.Num() - 1;
+	OutCellPoints.SetNum(FMath::Max(NumCells, 0));
+	int32 BatchEnd = NumCells;
+	while (BatchEnd > 0) {
+		const int32 MinBatchStart = CellStarts[BatchEnd] - CellStarts[BatchEnd] / 4;
+		int32 BatchStart = BatchEnd - 1;
+		while (BatchStart > 0 && CellStarts[BatchStart - 1] >= MinBatchStart) {
+			BatchStart--;
+		}
+		ParallelFor(TEXT("GaussianSplatting.RepartitionCells"), BatchEnd - BatchStart, 1, [&](int32 BatchIndex) {
+			const int32 CellIndex = BatchStart + BatchIndex;
+			OutCellPoints[CellIndex] = UGaussianSplattingPointCloud::SortPointsBySize(TConstArrayView<FGaussianSplattingPoint>(InOutBinnedPoints.GetData() + CellStarts[CellIndex], CellStarts[CellIndex + 1] - CellStarts[CellIndex]));
+		});
+		InOutBinnedPoints.SetNum(CellStarts[BatchStart]);
+		BatchEnd = BatchStart;
+	}
+	InOutBinnedPoints.Empty();
+}
+
+/** Once binned, the points of the old clouds are only needed again if the clouds are reused as cells, which reloads them. */
+static void ReleasePartitionedClouds(const TMap<UNiagaraComponent*, UGaussianSplattingPointCloud*>& OldClouds)
+{
+	for (auto CloudPair : OldClouds) {
+		CloudPair.Value->ReleaseSegments();
+	}
+}
+
+/**
+ * Saves every cell as a point cloud asset, replaces the actors of the old clouds by one actor per cell and writes the manifest
+ * of the cells next to the assets. The old clouds that are not reused as cells are deleted.
+ */
+static void ReplacePartitionedClouds(UWorld* World, const TMap<UNiagaraComponent*, UGaussianSplattingPointCloud*>& OldClouds, const FString& SaveContentDir, const FString& PartitionBaseName,
+	TArray<TArray<FGaussianSplattingPoint>>& CellPoints, TConstArrayView<FString> CellNames, TConstArrayView<FVector> CellLocations, TConstArrayView<int32> CellDepths,
+	UNiagaraSystem* TemplateSystem, bool bUseStandaloneNiagraSystem, FGaussianSplattingPartitionManifest& InOutManifest)
+{
+	TMap<UGaussianSplattingPointCloud*, FVector> RepartitionPointClouds;
+	for (int32 CellIndex = 0; CellIndex < CellPoints.Num(); CellIndex++) {
+		const FString& CellName = CellNames[CellIndex];
+		const FVector CellLocation = CellLocations[CellIndex];
+		UGaussianSplattingPointCloud* PointCloud = LoadObject<UGaussianSplattingPointCloud>(nullptr, *(SaveContentDir / CellName + "." + CellName));
+		if (!PointCloud) {
+			PointCloud = NewObject<UGaussianSplattingPointCloud>(CreatePackage(*(SaveContentDir / CellName)), *CellName);
+		}
+		FGaussianSplattingPartitionCellInfo& CellInfo = InOutManifest.Cells.AddDefaulted_GetRef();
+		CellInfo.Name = CellName;
+		CellInfo.Location = CellLocation;
+		CellInfo.Depth = CellDepths[CellIndex];
+		CellInfo.NumPoints = CellPoints[CellIndex].Num();
+		CellInfo.NumBytes = GaussianSplattingBinning::GetPointBytes(CellInfo.NumPoints);
+		CellInfo.Bounds = FBox(ForceInit);
+		for (const FGaussianSplattingPoint& Point : CellPoints[CellIndex]) {
+			CellInfo.Bounds += CellLocation + FVector(Point.Position);
+		}
+		InOutManifest.NumPoints += CellInfo.NumPoints;
+
+		PointCloud->SetPoints(CellPoints[CellIndex], false);
+		CellPoints[CellIndex].Empty();
+		RepartitionPointClouds.Add(PointCloud, CellLocation);
+	}
+	TArray<UGaussianSplattingPointCloud*> CellClouds;
+	RepartitionPointClouds.GetKeys(CellClouds);
+	SavePointCloudPackages(CellClouds);
 	for (auto OldCloudPair : OldClouds) {
 		World->DestroyActor(OldCloudPair.Key->GetOwner());
 		if (!RepartitionPointClouds.Contains(OldCloudPair.Value)) {
@@ -681,27 +1326,237 @@ void UGaussianSplattingEditorLibrary::RepartitionPointClouds(UWorld* World, FStr
 		}
 	}
 	for (auto PointCloudPair : RepartitionPointClouds) {
-		ANiagaraActor* NiagaraActor = World->SpawnActor<ANiagaraActor>(PointCloudPair.Value, FRotator());
-		UNiagaraComponent* NiagaraComponent = NiagaraActor->GetNiagaraComponent();
-		UNiagaraSystem* Niagara = nullptr;
-		if (bUseStandaloneNiagraSystem) {
-			Niagara = UGaussianSplattingEditorLibrary::CreateNiagaraSystemFromPointCloud(PointCloudPair.Key, NiagaraActor->GetPackage(), NAME_None, TemplateSystem);
+		SpawnPointCloudActor(World, PointCloudPair.Key, PointCloudPair.Value, TemplateSystem, bUseStandaloneNiagraSystem);
+	}
+	SaveSpawnedActorPackages();
+
+	const FString ManifestPath = FPackageName::LongPackageNameToFilename(SaveContentDir / PartitionBaseName + TEXT("_Manifest"), TEXT(".json"));
+	TSharedRef<FJsonObject> ManifestObject = MakeShared<FJsonObject>();
+	FJsonObjectConverter::UStructToJsonObject(FGaussianSplattingPartitionManifest::StaticStruct(), &InOutManifest, ManifestObject, 0, 0);
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
+	if (FJsonSerializer::Serialize(ManifestObject, JsonWriter) && JsonWriter->Close()) {
+		FFileHelper::SaveStringToFile(JsonString, *ManifestPath);
+	}
+}
+
+FGaussianSplattingPartitionManifest UGaussianSplattingEditorLibrary::RepartitionPointClouds(UWorld* World, FString PartitionBaseName /*= "Cell"*/, int32 CellSize /*= 51200*/, UNiagaraSystem* TemplateSystem /*= nullptr*/, bool bUseStandaloneNiagraSystem /*= false */, EGaussianSplattingOverlapMode OverlapMode, float OverlapCellSize)
+{
+	FGaussianSplattingPartitionManifest Manifest;
+	TMap<UNiagaraComponent*, UGaussianSplattingPointCloud*> OldClouds;
+	FString SaveContentDir;
+	GatherPartitionedClouds(World, OldClouds, SaveContentDir);
+	FBox2D TotalBound;
+	for (auto CloudPair : OldClouds) {
+		FVector BoxExtent = CloudPair.Value->CalcBounds().GetExtent();
+		FVector Location = CloudPair.Key->GetComponentLocation();
+		TotalBound += FBox2D(
+			FVector2D(Location.X - BoxExtent.X, Location.Y - BoxExtent.Y),
+			FVector2D(Location.X + BoxExtent.X, Location.Y + BoxExtent.Y)
+		);
+	}
+	TArray<GaussianSplattingBinning::FSource> Sources;
+	for (auto CloudPair : OldClouds) {
+		FVector BoxExtent = CloudPair.Value->CalcBounds().GetExtent();
+		if (BoxExtent.X > 0 && BoxExtent.Y > 0) {
+			CloudPair.Value->LoadAllSegments();
+			Sources.Add({ CloudPair.Value->GetPoints(), CloudPair.Key->GetComponentLocation() });
+		}
+	}
+	FScopedSlowTask SlowTask(2.0f, NSLOCTEXT("GaussianSplatting", "RepartitionPointClouds", "Repartitioning point clouds"));
+	SlowTask.MakeDialog();
+	TArray<TArray<FGaussianSplattingPoint>> RemainingPoints;
+	RemovePartitionOverlaps(Sources, OverlapMode, OverlapCellSize, RemainingPoints, Manifest);
+
+	// A single binning pass over all clouds replaces copying and testing every overlapping cloud once per cell.
+	SlowTask.EnterProgressFrame(1.0f);
+	GaussianSplattingBinning::FCells Cells;
+	GaussianSplattingBinning::FStats BinStats;
+	GaussianSplattingBinning::BinPoints(Sources, TotalBound.Min, CellSize, Cells, &BinStats);
+	Sources.Reset();
+	RemainingPoints.Empty();
+	ReleasePartitionedClouds(OldClouds);
+	UE_LOG(LogTemp, Log, TEXT("Binned %d points into %d cells, bounds %.1f ms, count %.1f ms, scatter %.1f ms"),
+		Cells.Points.Num(), Cells.Cells.Num(), BinStats.BoundsSeconds * 1000.0, BinStats.CountSeconds * 1000.0, BinStats.ScatterSeconds * 1000.0);
+
+	TArray<TArray<FGaussianSplattingPoint>> CellPoints;
+	SortPartitionCells(Cells.CellStarts, Cells.Points, CellPoints);
+
+	SlowTask.EnterProgressFrame(1.0f);
+	TArray<FString> CellNames;
+	TArray<FVector> CellLocations;
+	TArray<int32> CellDepths;
+	for (const FIntPoint& Cell : Cells.Cells) {
+		CellNames.Add(FString::Printf(TEXT("%s_%d_%d"), *PartitionBaseName, Cell.X, Cell.Y));
+		CellLocations.Add(GaussianSplattingBinning::GetCellCenter(TotalBound.Min, CellSize, Cell));
+		CellDepths.Add(0);
+	}
+	ReplacePartitionedClouds(World, OldClouds, SaveContentDir, PartitionBaseName, CellPoints, CellNames, CellLocations, CellDepths, TemplateSystem, bUseStandaloneNiagraSystem, Manifest);
+	return Manifest;
+}
+
+FGaussianSplattingPartitionManifest UGaussianSplattingEditorLibrary::RepartitionPointCloudsAdaptive(UWorld* World, FString PartitionBaseName, int32 MaxPointsPerCell, int32 MaxMegabytesPerCell, int32 MaxDepth, UNiagaraSystem* TemplateSystem, bool bUseStandaloneNiagraSystem, EGaussianSplattingOverlapMode OverlapMode, float OverlapCellSize)
+{
+	FGaussianSplattingPartitionManifest Manifest;
+	Manifest.MaxPointsPerCell = MaxPointsPerCell;
+	Manifest.MaxBytesPerCell = (int64)MaxMegabytesPerCell * 1024 * 1024;
+	TMap<UNiagaraComponent*, UGaussianSplattingPointCloud*> OldClouds;
+	FString SaveContentDir;
+	GatherPartitionedClouds(World, OldClouds, SaveContentDir);
+	TArray<GaussianSplattingBinning::FSource> Sources;
+	for (auto CloudPair : OldClouds) {
+		CloudPair.Value->LoadAllSegments();
+		Sources.Add({ CloudPair.Value->GetPoints(), CloudPair.Key->GetComponentLocation() });
+	}
+	FScopedSlowTask SlowTask(2.0f, NSLOCTEXT("GaussianSplatting", "RepartitionPointClouds", "Repartitioning point clouds"));
+	SlowTask.MakeDialog();
+	TArray<TArray<FGaussianSplattingPoint>> RemainingPoints;
+	RemovePartitionOverlaps(Sources, OverlapMode, OverlapCellSize, RemainingPoints, Manifest);
+
+	SlowTask.EnterProgressFrame(1.0f);
+	GaussianSplattingBinning::FOctreeSettings Settings;
+	Settings.MaxPointsPerCell = MaxPointsPerCell;
+	Settings.MaxBytesPerCell = Manifest.MaxBytesPerCell;
+	Settings.MaxDepth = MaxDepth;
+	GaussianSplattingBinning::FOctreeCells Cells;
+	GaussianSplattingBinning::FStats BinStats;
+	GaussianSplattingBinning::BinPointsOctree(Sources, Settings, Cells, &BinStats);
+	Sources.Reset();
+	RemainingPoints.Empty();
+	ReleasePartitionedClouds(OldClouds);
+	UE_LOG(LogTemp, Log, TEXT("Binned %d points into %d octree cells, bounds %.1f ms, sort %.1f ms, scatter %.1f ms"),
+		Cells.Points.Num(), Cells.Cells.Num(), BinStats.BoundsSeconds * 1000.0, BinStats.SortSeconds * 1000.0, BinStats.ScatterSeconds * 1000.0);
+
+	TArray<TArray<FGaussianSplattingPoint>> CellPoints;
+	SortPartitionCells(Cells.CellStarts, Cells.Points, CellPoints);
+
+	SlowTask.EnterProgressFrame(1.0f);
+	TArray<FString> CellNames;
+	TArray<FVector> CellLocations;
+	TArray<int32> CellDepths;
+	for (const GaussianSplattingBinning::FOctreeCell& Cell : Cells.Cells) {
+		CellNames.Add(GetOctreeCellName(PartitionBaseName, Cell));
+		CellLocations.Add(Cell.Bounds.GetCenter());
+		CellDepths.Add(Cell.Depth);
+	}
+	ReplacePartitionedClouds(World, OldClouds, SaveContentDir, PartitionBaseName, CellPoints, CellNames, CellLocations, CellDepths, TemplateSystem, bUseStandaloneNiagraSystem, Manifest);
+	return Manifest;
+}
+
+TArray<FGaussianSplattingStaticMeshChunk> UGaussianSplattingEditorLibrary::CreateChunkedStaticMeshesFromPointCloud(UGaussianSplattingPointCloud* PointCloud, FString SaveContentDir, FString BaseName /*= "SM_Chunk"*/, int32 MaxPointsPerChunk /*= 1048576*/, UWorld* World /*= nullptr*/)
+{
+	TArray<FGaussianSplattingStaticMeshChunk> Chunks;
+	if (PointCloud == nullptr) {
+		return Chunks;
+	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingEditorLibrary::CreateChunkedStaticMeshesFromPointCloud);
+	const double StartTime = FPlatformTime::Seconds();
+	FScopedSlowTask SlowTask(3.0f, NSLOCTEXT("GaussianSplatting", "CreateChunkedStaticMeshes", "Creating static mesh chunks"));
+	SlowTask.MakeDialog();
+
+	// The attribute textures of a chunk are as wide as the square root of its points, so the budget keeps them within the limit.
+	const int32 PreviousResidentSegments = PointCloud->GetResidentSegmentCount();
+	PointCloud->LoadAllSegments();
+	const int32 NumPoints = PointCloud->GetPointCount();
+	const int64 MaxTextureDimension = GetMax2DTextureDimension();
+	GaussianSplattingBinning::FOctreeSettings Settings;
+	Settings.MaxPointsPerCell = (int32)FMath::Clamp<int64>(MaxPointsPerChunk, 1, MaxTextureDimension * MaxTextureDimension);
+	Settings.MaxDepth = GaussianSplattingBinning::MaxOctreeDepth;
+	const GaussianSplattingBinning::FSource Source{ PointCloud->GetPoints(), FVector::ZeroVector };
+	GaussianSplattingBinning::FOctreeCells Cells;
+	GaussianSplattingBinning::BinPointsOctree(MakeArrayView(&Source, 1), Settings, Cells);
+	PointCloud->ReleaseSegments(PreviousResidentSegments);
+
+	// Meshes and their descriptions are created on the game thread, the descriptions are then filled concurrently.
+	// Cells at the maximum depth may still hold more points than the budget, those are sliced into several chunks.
+	SlowTask.EnterProgressFrame(1.0f);
+	TArray<int32> ChunkStarts;
+	TArray<UStaticMesh*> StaticMeshes;
+	TArray<FMeshDescription*> MeshDescriptions;
+	for (int32 CellIndex = 0; CellIndex < Cells.Cells.Num(); CellIndex++) {
+		const int32 NumCellPoints = Cells.CellStarts[CellIndex + 1] - Cells.CellStarts[CellIndex];
+		const int32 NumSlices = FMath::DivideAndRoundUp(NumCellPoints, Settings.MaxPointsPerCell);
+		const FString CellName = GetOctreeCellName(BaseName, Cells.Cells[CellIndex]);
+		if (NumSlices > 1) {
+			UE_LOG(LogTemp, Warning, TEXT("The octree cell %s holds %d points at the maximum depth, split into %d chunks"), *CellName, NumCellPoints, NumSlices);
+		}
+		for (int32 SliceIndex = 0; SliceIndex < NumSlices; SliceIndex++) {
+			const FString ChunkName = NumSlices > 1 ? FString::Printf(TEXT("%s_%d"), *CellName, SliceIndex) : CellName;
+			UStaticMesh* StaticMesh = NewObject<UStaticMesh>(CreatePackage(*(SaveContentDir / ChunkName)), *ChunkName);
+			const int32 SliceStart = SliceIndex * Settings.MaxPointsPerCell;
+			FGaussianSplattingStaticMeshChunk& Chunk = Chunks.AddDefaulted_GetRef();
+			Chunk.StaticMesh = StaticMesh;
+			Chunk.Location = Cells.Cells[CellIndex].Bounds.GetCenter();
+			Chunk.NumPoints = FMath::Min(NumCellPoints - SliceStart, Settings.MaxPointsPerCell);
+			ChunkStarts.Add(Cells.CellStarts[CellIndex] + SliceStart);
+			StaticMeshes.Add(StaticMesh);
+			MeshDescriptions.Add(&AddPointCloudSourceModel(StaticMesh));
+		}
+	}
+	TArray<GaussianSplattingStaticMesh::FAttributeData> AttributeData;
+	AttributeData.SetNum(Chunks.Num());
+	ParallelFor(TEXT("GaussianSplatting.StaticMeshChunks"), Chunks.Num(), 1, [&](int32 ChunkIndex) {
+		const TConstArrayView<FGaussianSplattingPoint> Points = MakeArrayView(Cells.Points).Slice(ChunkStarts[ChunkIndex], Chunks[ChunkIndex].NumPoints);
+		GaussianSplattingStaticMesh::BuildAttributeData(Points, AttributeData[ChunkIndex]);
+		GaussianSplattingStaticMesh::BuildMeshDescription(*MeshDescriptions[ChunkIndex], Points, AttributeData[ChunkIndex].TextureSize);
+		FGaussianSplattingStaticMeshChunk& Chunk = Chunks[ChunkIndex];
+		Chunk.TextureSize = AttributeData[ChunkIndex].TextureSize;
+		for (const FGaussianSplattingPoint& Point : Points) {
+			Chunk.Bounds += Chunk.Location + FVector(Point.Position);
 		}
-		else {
-			SetupPointCloudToNiagaraComponent(PointCloudPair.Key, NiagaraComponent, TemplateSystem);
+	});
+	FIntPoint MaxTextureSize = FIntPoint::ZeroValue;
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ChunkIndex++) {
+		UStaticMesh* StaticMesh = StaticMeshes[ChunkIndex];
+		StaticMesh->GetStaticMaterials().Add(FStaticMaterial(CreateStaticMeshMaterial(StaticMesh, MoveTemp(AttributeData[ChunkIndex]))));
+		StaticMesh->CommitMeshDescription(0);
+		MaxTextureSize = MaxTextureSize.ComponentMax(Chunks[ChunkIndex].TextureSize);
+		if (Chunks[ChunkIndex].TextureSize.X > MaxTextureDimension || Chunks[ChunkIndex].TextureSize.Y > MaxTextureDimension) {
+			UE_LOG(LogTemp, Warning, TEXT("The attribute textures of %s are %dx%d, above the limit of %lld"),
+				*StaticMesh->GetName(), Chunks[ChunkIndex].TextureSize.X, Chunks[ChunkIndex].TextureSize.Y, MaxTextureDimension);
 		}
-		if (Niagara) {
-			Niagara->ClearFlags(RF_Public | RF_Standalone);
-			NiagaraComponent->SetAsset(Niagara);
-			NiagaraActor->Modify();
-			NiagaraActor->MarkPackageDirty();
+	}
+	Cells.Points.Empty();
+	AttributeData.Empty();
+
+	// The chunks are built together by the asynchronous static mesh compilation.
+	SlowTask.EnterProgressFrame(1.0f);
+	UStaticMesh::BatchBuild(StaticMeshes);
+	FStaticMeshCompilingManager::Get().FinishAllCompilation();
+	SaveAssetPackages(TArray<UObject*>(StaticMeshes));
+
+	SlowTask.EnterProgressFrame(1.0f);
+	if (World) {
+		for (const FGaussianSplattingStaticMeshChunk& Chunk : Chunks) {
+			AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(Chunk.Location, FRotator());
+			Actor->GetStaticMeshComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			Actor->GetStaticMeshComponent()->SetStaticMesh(Chunk.StaticMesh);
+			Actor->SetActorLabel(Chunk.StaticMesh->GetName());
+			Actor->SetFolderPath(*BaseName);
 		}
-		NiagaraActor->SetActorLabel(PointCloudPair.Key->GetName());
-		bool bPromptUserToSave = false;
-		bool bSaveMapPackages = true;
-		bool bSaveContentPackages = true;
-		bool bFastSave = true;
-		FEditorFileUtils::SaveDirtyPackages(bPromptUserToSave, bSaveMapPackages, bSaveContentPackages, bFastSave);
+		SaveSpawnedActorPackages();
 	}
+	UE_LOG(LogTemp, Log, TEXT("Created %d static mesh chunks for the %d points of %s, attribute textures up to %dx%d, %.1f s"),
+		Chunks.Num(), NumPoints, *PointCloud->GetName(), MaxTextureSize.X, MaxTextureSize.Y, FPlatformTime::Seconds() - StartTime);
+	return Chunks;
 }
 
+int32 UGaussianSplattingEditorLibrary::CompressPointClouds(TConstArrayView<UGaussianSplattingPointCloud*> PointClouds, EGaussianSplattingCompressionMethod Method)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingEditorLibrary::CompressPointClouds);
+	FScopedSlowTask SlowTask((float)PointClouds.Num() + 1.0f, NSLOCTEXT("GaussianSplatting", "CompressPointClouds", "Compressing point clouds"));
+	SlowTask.MakeDialog();
+	TArray<UGaussianSplattingPointCloud*> Encoded;
+	for (UGaussianSplattingPointCloud* PointCloud : PointClouds) {
+		SlowTask.EnterProgressFrame(1.0f);
+		if (PointCloud == nullptr) {
+			continue;
+		}
+		// Streamed segments are read from the bulk data of the package before it is overwritten.
+		PointCloud->SetCompressionMethod(Method);
+		PointCloud->EncodePayloads();
+		Encoded.Add(PointCloud);
+	}
+	SlowTask.EnterProgressFrame(1.0f);
+	return SavePointCloudPackages(Encoded, false);
+}
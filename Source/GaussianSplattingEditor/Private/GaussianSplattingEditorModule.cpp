@@ -13,6 +13,8 @@
 #include "GaussianSplattingEditorLibrary.h"
 #include "IContentBrowserSingleton.h"
 #include "NiagaraEditorStyle.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
 
 
 #define LOCTEXT_NAMESPACE "GaussianSplatting"
@@ -61,6 +63,26 @@ void FGaussianSplattingEditorModule::RegisterMenus()
 						)
 					);
 
+					Section.AddMenuEntry(
+						"GS_Simplify",
+						LOCTEXT("GS_Simplify", "Simplify"),
+						LOCTEXT("GS_SimplifyTooltip", "Save a copy without the splats contributing the least, within 1% of the total contribution"),
+						FSlateIcon(),
+						FUIAction(
+							FExecuteAction::CreateRaw(this, &FGaussianSplattingEditorModule::SimplifyPointCloud, PointCloud)
+						)
+					);
+
+					Section.AddMenuEntry(
+						"GS_PreviewStaticMesh",
+						LOCTEXT("GS_PreviewStaticMesh", "Preview Static Mesh"),
+						LOCTEXT("GS_PreviewStaticMeshTooltip", "Bake the cloud into a static mesh in seconds and place it in the level, the mesh and its actor are transient and not saved"),
+						FSlateIcon(FAppStyle::GetAppStyleSetName(), "ClassIcon.StaticMeshActor"),
+						FUIAction(
+							FExecuteAction::CreateRaw(this, &FGaussianSplattingEditorModule::PreviewStaticMesh, PointCloud)
+						)
+					);
+
 					//Section.AddMenuEntry(
 					//	"GS_CreateStaticMesh",
 					//	LOCTEXT("GS_CreateStaticMesh", "Create Static Mesh"),
@@ -112,6 +134,28 @@ void FGaussianSplattingEditorModule::CreateStaticMesh(UGaussianSplattingPointClo
 	}
 }
 
+void FGaussianSplattingEditorModule::PreviewStaticMesh(UGaussianSplattingPointCloud* PointCloud)
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (PointCloud == nullptr || World == nullptr) {
+		return;
+	}
+
+	// The render data is filled directly, which cannot be saved, so the mesh and its actor stay out of every package.
+	const FName MeshName = MakeUniqueObjectName(GetTransientPackage(), UStaticMesh::StaticClass(), *FString::Printf(TEXT("SM_%s"), *PointCloud->GetName()));
+	UStaticMesh* StaticMesh = UGaussianSplattingEditorLibrary::CreateStaticMeshFromPointCloud(PointCloud, GetTransientPackage(), MeshName, true);
+	if (StaticMesh == nullptr) {
+		return;
+	}
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags = RF_Transient;
+	AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(SpawnParameters);
+	Actor->GetStaticMeshComponent()->SetStaticMesh(StaticMesh);
+	Actor->SetActorLabel(MeshName.ToString());
+	GEditor->SelectNone(false, true);
+	GEditor->SelectActor(Actor, true, true);
+}
+
 void FGaussianSplattingEditorModule::CreateNiagara(UGaussianSplattingPointCloud* PointCloud)
 {
 	if (PointCloud == nullptr) {
@@ -150,6 +194,56 @@ void FGaussianSplattingEditorModule::CreateNiagara(UGaussianSplattingPointCloud*
 	}
 }
 
+void FGaussianSplattingEditorModule::SimplifyPointCloud(UGaussianSplattingPointCloud* PointCloud)
+{
+	if (PointCloud == nullptr) {
+		return;
+	}
+
+	FSaveAssetDialogConfig SaveAssetDialogConfig;
+	SaveAssetDialogConfig.DefaultPath = FPackageName::GetLongPackagePath(PointCloud->GetOutermost()->GetName());
+	SaveAssetDialogConfig.DefaultAssetName = FString::Printf(TEXT("%s_Simplified"), *PointCloud->GetName());
+	SaveAssetDialogConfig.AssetClassNames.Add(UGaussianSplattingPointCloud::StaticClass()->GetClassPathName());
+	SaveAssetDialogConfig.ExistingAssetPolicy = ESaveAssetDialogExistingAssetPolicy::AllowButWarn;
+	SaveAssetDialogConfig.DialogTitleOverride = FText::FromString("Save As");
+
+	const FContentBrowserModule& ContentBrowserModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+	const FString SaveObjectPath = ContentBrowserModule.Get().CreateModalSaveAssetDialog(SaveAssetDialogConfig);
+	if (SaveObjectPath.IsEmpty()) {
+		FNotificationInfo NotifyInfo(FText::FromString("Path is empty"));
+		NotifyInfo.ExpireDuration = 5.0f;
+		FSlateNotificationManager::Get().AddNotification(NotifyInfo);
+		return;
+	}
+
+	const FString PackagePath = FPackageName::ObjectPathToPackageName(SaveObjectPath);
+	const FString AssetName = FPaths::GetBaseFilename(PackagePath, true);
+	if (AssetName.IsEmpty() || PackagePath == PointCloud->GetOutermost()->GetName()) {
+		FNotificationInfo NotifyInfo(FText::FromString("Simplification writes a new asset, choose another name"));
+		NotifyInfo.ExpireDuration = 5.0f;
+		FSlateNotificationManager::Get().AddNotification(NotifyInfo);
+		return;
+	}
+	UPackage* NewPackage = CreatePackage(*PackagePath);
+	FGaussianSplattingSimplifyReport Report;
+	UObject* NewAsset = UGaussianSplattingEditorLibrary::SimplifyPointCloud(PointCloud, NewPackage, *AssetName, FGaussianSplattingSimplifySettings(), Report);
+	if (NewAsset == nullptr) {
+		return;
+	}
+	NewAsset->SetFlags(RF_Public | RF_Standalone);
+	FAssetRegistryModule::AssetCreated(NewAsset);
+	FPackagePath NewPackagePath = FPackagePath::FromPackageNameChecked(NewPackage->GetName());
+	FString PackageLocalPath = NewPackagePath.GetLocalFullPath();
+	UPackage::SavePackage(NewPackage, NewAsset, RF_Public | RF_Standalone, *PackageLocalPath, GError, nullptr, false, true, SAVE_NoError);
+	TArray<UObject*> ObjectsToSync;
+	ObjectsToSync.Add(NewAsset);
+	GEditor->SyncBrowserToObjects(ObjectsToSync);
+
+	FNotificationInfo NotifyInfo(FText::FromString(FString::Printf(TEXT("Kept %d of %d splats, contribution loss %.2f%%, PSNR %.1f dB"), Report.NumPoints, Report.NumSourcePoints, Report.ContributionLoss * 100.0f, Report.PSNR)));
+	NotifyInfo.ExpireDuration = 5.0f;
+	FSlateNotificationManager::Get().AddNotification(NotifyInfo);
+}
+
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FGaussianSplattingEditorModule, GaussianSplattingEditor)
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "GaussianSplattingImportPipeline.h"
+#include "GaussianSplattingPointCloud.h"
+#include "HAL/FileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Tasks/Task.h"
+
+#define LOCTEXT_NAMESPACE "GaussianSplatting"
+
+namespace
+{
+	struct FFileState
+	{
+		TArray<uint8> FileData;
+
+		TArray<FGaussianSplattingPoint> Points;
+
+		int64 FileSize = 0;
+
+		int64 EstimatedBytes = 0;
+
+		int32 NumPoints = 0;
+
+		uint64 KnownHash = 0;
+
+		uint64 ContentHash = 0;
+
+		bool bUnchanged = false;
+
+		double ReadSeconds = 0.0;
+		double DecodeSeconds = 0.0;
+		double SortSeconds = 0.0;
+		double CompressSeconds = 0.0;
+
+		/** The last stage, completed once the cloud leaves the pipeline. */
+		UE::Tasks::FTask Compressed;
+	};
+}
+
+void GaussianSplattingImportPipeline::Run(TConstArrayView<FString> Files, TConstArrayView<UGaussianSplattingPointCloud*> PointClouds, TConstArrayView<uint64> KnownHashes, const FSettings& Settings,
+	TFunctionRef<void(TConstArrayView<int32> FileIndices)> SaveClouds, TArray<FFileResult>& OutResults, FStats& OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingImportPipeline::Run);
+	const double StartTime = FPlatformTime::Seconds();
+	OutStats = FStats();
+	const int32 NumFiles = Files.Num();
+	OutResults.Reset();
+	OutResults.SetNum(NumFiles);
+	FScopedSlowTask SlowTask((float)NumFiles, LOCTEXT("ImportPipeline", "Reading, sorting and compressing point clouds"));
+
+	// A raw file and its decoded points are alive together while it is parsed, which roughly doubles the file size.
+	TArray<FFileState> States;
+	States.SetNum(NumFiles);
+	for (int32 FileIndex = 0; FileIndex < NumFiles; FileIndex++) {
+		States[FileIndex].FileSize = FMath::Max(IFileManager::Get().FileSize(*Files[FileIndex]), (int64)0);
+		States[FileIndex].EstimatedBytes = States[FileIndex].FileSize * 2;
+		States[FileIndex].KnownHash = KnownHashes.IsEmpty() ? 0 : KnownHashes[FileIndex];
+	}
+	const int32 MaxInFlightClouds = Settings.MaxInFlightClouds > 0 ? Settings.MaxInFlightClouds : FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+
+	// A finished cloud keeps its share of the cap until it is saved and its points are released.
+	TArray<int32> InFlight;
+	TArray<int32> Finished;
+	int64 InFlightBytes = 0;
+	int32 NextFile = 0;
+	UE::Tasks::FTask PreviousRead;
+	while (NextFile < NumFiles || !InFlight.IsEmpty() || !Finished.IsEmpty()) {
+		while (NextFile < NumFiles && InFlight.Num() < MaxInFlightClouds && ((InFlight.IsEmpty() && Finished.IsEmpty()) || InFlightBytes + States[NextFile].EstimatedBytes <= Settings.MaxInFlightBytes)) {
+			FFileState& State = States[NextFile];
+			const FString& File = Files[NextFile];
+			UGaussianSplattingPointCloud* PointCloud = PointClouds[NextFile];
+			const UE::Tasks::FTask Read = UE::Tasks::Launch(UE_SOURCE_LOCATION, [&State, &File]() {
+				const double StageStart = FPlatformTime::Seconds();
+				if (!FFileHelper::LoadFileToArray(State.FileData, *File)) {
+					UE_LOG(LogTemp, Warning, TEXT("Unable to read %s."), *File);
+				}
+				State.ReadSeconds = FPlatformTime::Seconds() - StageStart;
+			}, UE::Tasks::Prerequisites(PreviousRead));
+			const UE::Tasks::FTask Decode = UE::Tasks::Launch(UE_SOURCE_LOCATION, [&State]() {
+				const double StageStart = FPlatformTime::Seconds();
+				if (!State.FileData.IsEmpty()) {
+					State.ContentHash = FXxHash64::HashBuffer(State.FileData.GetData(), State.FileData.Num()).Hash;
+					State.bUnchanged = State.KnownHash != 0 && State.ContentHash == State.KnownHash;
+				}
+				if (!State.FileData.IsEmpty() && !State.bUnchanged) {
+					State.Points = UGaussianSplattingPointCloud::LoadPointsFromMemory(State.FileData);
+				}
+				State.FileData.Empty();
+				State.NumPoints = State.Points.Num();
+				State.DecodeSeconds = FPlatformTime::Seconds() - StageStart;
+			}, UE::Tasks::Prerequisites(Read));
+			const UE::Tasks::FTask Sort = UE::Tasks::Launch(UE_SOURCE_LOCATION, [&State, PointCloud]() {
+				const double StageStart = FPlatformTime::Seconds();
+				if (PointCloud && !State.Points.IsEmpty()) {
+					PointCloud->SetPoints(State.Points);
+					State.Points.Empty();
+				}
+				State.SortSeconds = FPlatformTime::Seconds() - StageStart;
+			}, UE::Tasks::Prerequisites(Decode));
+			State.Compressed = UE::Tasks::Launch(UE_SOURCE_LOCATION, [&State, PointCloud]() {
+				const double StageStart = FPlatformTime::Seconds();
+				if (PointCloud && State.NumPoints > 0) {
+					PointCloud->EncodePayloads();
+				}
+				State.CompressSeconds = FPlatformTime::Seconds() - StageStart;
+			}, UE::Tasks::Prerequisites(Sort));
+			PreviousRead = Read;
+			InFlight.Add(NextFile);
+			InFlightBytes += State.EstimatedBytes;
+			OutStats.PeakInFlightBytes = FMath::Max(OutStats.PeakInFlightBytes, InFlightBytes);
+			NextFile++;
+		}
+
+		// Saving frees the cap when the next file is held back by it, or once nothing is left to wait for.
+		const bool bHeldBackByMemory = NextFile < NumFiles && InFlight.Num() < MaxInFlightClouds;
+		if (!Finished.IsEmpty() && (bHeldBackByMemory || InFlight.IsEmpty())) {
+			SaveClouds(Finished);
+			for (const int32 FileIndex : Finished) {
+				if (PointClouds[FileIndex]) {
+					PointClouds[FileIndex]->ReleaseSegments();
+				}
+				OutResults[FileIndex].Points.Empty();
+				InFlightBytes -= States[FileIndex].EstimatedBytes;
+			}
+			Finished.Reset();
+			continue;
+		}
+
+		// Clouds leave in file order, the game thread sleeps on the oldest one as nothing else can enter before it leaves.
+		const int32 FileIndex = InFlight[0];
+		States[FileIndex].Compressed.Wait();
+		InFlight.RemoveAt(0);
+		const FFileState& State = States[FileIndex];
+		OutResults[FileIndex].bLoaded = State.NumPoints > 0;
+		OutResults[FileIndex].bUnchanged = State.bUnchanged;
+		OutResults[FileIndex].ContentHash = State.ContentHash;
+		OutResults[FileIndex].Points = MoveTemp(States[FileIndex].Points);
+		Finished.Add(FileIndex);
+		SlowTask.EnterProgressFrame(1.0f);
+	}
+
+	for (int32 FileIndex = 0; FileIndex < NumFiles; FileIndex++) {
+		const FFileState& State = States[FileIndex];
+		OutStats.NumLoaded += OutResults[FileIndex].bLoaded ? 1 : 0;
+		OutStats.NumBytes += State.FileSize;
+		OutStats.Read.NumPoints += State.NumPoints;
+		OutStats.Read.Seconds += State.ReadSeconds;
+		OutStats.Decode.NumPoints += State.NumPoints;
+		OutStats.Decode.Seconds += State.DecodeSeconds;
+		OutStats.Sort.NumPoints += State.NumPoints;
+		OutStats.Sort.Seconds += State.SortSeconds;
+		OutStats.Compress.NumPoints += State.NumPoints;
+		OutStats.Compress.Seconds += State.CompressSeconds;
+	}
+	OutStats.Seconds = FPlatformTime::Seconds() - StartTime;
+}
+
+#undef LOCTEXT_NAMESPACE
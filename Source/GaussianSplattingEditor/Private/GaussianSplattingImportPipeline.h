@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GaussianSplattingPointCloud.h"
+
+/**
+ * Imports many PLY files with the read, parse, sort and compress stages overlapped on the task graph, reading one file at a
+ * time and only starting a file while the unsaved clouds stay under a memory cap.
+ */
+namespace GaussianSplattingImportPipeline
+{
+	struct FSettings
+	{
+		/**
+		 * Memory the clouds from reading until they are saved may take together, estimated from their file sizes. At least one
+		 * cloud is always in flight.
+		 */
+		int64 MaxInFlightBytes = 8ll * 1024 * 1024 * 1024;
+
+		/** Largest number of clouds in flight, 0 uses the number of worker threads. */
+		int32 MaxInFlightClouds = 0;
+	};
+
+	struct FStageStats
+	{
+		int64 NumPoints = 0;
+
+		/** Time spent in the stage summed over all clouds, overlapping the other stages. */
+		double Seconds = 0.0;
+
+		double GetPointsPerSecond() const { return Seconds > 0.0 ? NumPoints / Seconds : 0.0; }
+	};
+
+	struct FStats
+	{
+		/** Reading the files, NumBytes is what was read. */
+		FStageStats Read;
+		int64 NumBytes = 0;
+
+		/** Hashing the contents and parsing them. */
+		FStageStats Decode;
+
+		/** Sorting the points and building the chunk hierarchy and the levels of detail in SetPoints. */
+		FStageStats Sort;
+
+		FStageStats Compress;
+
+		int32 NumLoaded = 0;
+
+		int64 PeakInFlightBytes = 0;
+
+		/** Wall clock time of the whole pipeline. */
+		double Seconds = 0.0;
+	};
+
+	struct FFileResult
+	{
+		/** Whether the file held points, which were set on its cloud. */
+		bool bLoaded = false;
+
+		/** Whether the contents matched the known hash of the file, its cloud is then left untouched. */
+		bool bUnchanged = false;
+
+		/** xxHash64 of the file contents. */
+		uint64 ContentHash = 0;
+
+		/** Parsed points of a file without a cloud, only valid while SaveClouds runs. */
+		TArray<FGaussianSplattingPoint> Points;
+	};
+
+	/**
+	 * Sets the points of Files[i] on PointClouds[i], or on its result for a null cloud, unless its hash matches KnownHashes[i].
+	 * Finished clouds are handed to SaveClouds whenever the next file does not fit the memory cap, then released.
+	 */
+	void Run(TConstArrayView<FString> Files, TConstArrayView<UGaussianSplattingPointCloud*> PointClouds, TConstArrayView<uint64> KnownHashes, const FSettings& Settings,
+		TFunctionRef<void(TConstArrayView<int32> FileIndices)> SaveClouds, TArray<FFileResult>& OutResults, FStats& OutStats);
+}
@@ -0,0 +1,179 @@
+#include "GaussianSplattingMotionFit.h"
+
+namespace
+{
+	/** Polynomial of degree up to two in U = T - Origin. */
+	template<typename ValueType>
+	struct TQuadratic
+	{
+		double Origin = 0.0;
+		ValueType Coefficients[3] = { ValueType(0.0), ValueType(0.0), ValueType(0.0) };
+
+		ValueType Evaluate(double T) const
+		{
+			const double U = T - Origin;
+			return Coefficients[0] + Coefficients[1] * U + Coefficients[2] * (U * U);
+		}
+	};
+
+	/** Least squares fit over the frames [Begin, End], lowering the degree when there are too few frames to constrain it. */
+	template<typename ValueType>
+	TQuadratic<ValueType> FitQuadratic(int32 Begin, int32 End, double FrameRate, TFunctionRef<ValueType(int32 Frame)> GetValue)
+	{
+		TQuadratic<ValueType> Fit;
+		// Centering the times keeps the normal equations well conditioned.
+		Fit.Origin = 0.5 * (Begin + End) / FrameRate;
+		double S[5] = {};
+		ValueType R[3] = { ValueType(0.0), ValueType(0.0), ValueType(0.0) };
+		for (int32 Frame = Begin; Frame <= End; Frame++) {
+			const double U = Frame / FrameRate - Fit.Origin;
+			const ValueType Value = GetValue(Frame);
+			double Power = 1.0;
+			for (int32 k = 0; k < 5; k++) {
+				S[k] += Power;
+				if (k < 3) {
+					R[k] += Value * Power;
+				}
+				Power *= U;
+			}
+		}
+
+		// Cramer's rule on the normal equations, replacing one column by the right-hand side at a time.
+		const double Det2 = S[0] * (S[2] * S[4] - S[3] * S[3]) - S[1] * (S[1] * S[4] - S[3] * S[2]) + S[2] * (S[1] * S[3] - S[2] * S[2]);
+		if (End - Begin >= 2 && FMath::Abs(Det2) > 1e-9 * S[0] * S[2] * S[4]) {
+			Fit.Coefficients[0] = (R[0] * (S[2] * S[4] - S[3] * S[3]) - (R[1] * S[4] - R[2] * S[3]) * S[1] + (R[1] * S[3] - R[2] * S[2]) * S[2]) / Det2;
+			Fit.Coefficients[1] = ((R[1] * S[4] - R[2] * S[3]) * S[0] - R[0] * (S[1] * S[4] - S[3] * S[2]) + (R[2] * S[1] - R[1] * S[2]) * S[2]) / Det2;
+			Fit.Coefficients[2] = ((R[2] * S[2] - R[1] * S[3]) * S[0] - (R[2] * S[1] - R[1] * S[2]) * S[1] + R[0] * (S[1] * S[3] - S[2] * S[2])) / Det2;
+			return Fit;
+		}
+		const double Det1 = S[0] * S[2] - S[1] * S[1];
+		if (End - Begin >= 1 && FMath::Abs(Det1) > 1e-9 * S[0] * S[2]) {
+			Fit.Coefficients[0] = (R[0] * S[2] - R[1] * S[1]) / Det1;
+			Fit.Coefficients[1] = (R[1] * S[0] - R[0] * S[1]) / Det1;
+			return Fit;
+		}
+		Fit.Coefficients[0] = R[0] / FMath::Max(S[0], 1.0);
+		return Fit;
+	}
+}
+
+void GaussianSplattingMotionFit::FStats::Accumulate(const FStats& Other)
+{
+	NumSegments += Other.NumSegments;
+	NumSamples += Other.NumSamples;
+	SumSquaredPositionError += Other.SumSquaredPositionError;
+	MaxPositionError = FMath::Max(MaxPositionError, Other.MaxPositionError);
+	SumSquaredOpacityError += Other.SumSquaredOpacityError;
+}
+
+void GaussianSplattingMotionFit::FitSplat(TConstArrayView<FGaussianSplattingFrameSample> Samples, const FGaussianSplattingPoint& Appearance, const FSettings& Settings, TArray<FGaussianSplattingPoint>& OutPoints, FStats& OutStats)
+{
+	const int32 NumFrames = Samples.Num();
+	const double FrameRate = FMath::Max((double)Settings.FrameRate, UE_KINDA_SMALL_NUMBER);
+	const double ToleranceSquared = FMath::Square((double)Settings.PositionTolerance);
+	auto GetPosition = [&Samples](int32 Frame) { return FVector3d(Samples[Frame].Position); };
+	auto GetLogOpacity = [&Samples](int32 Frame) { return FMath::Loge(FMath::Max((double)Samples[Frame].Opacity, 1e-4)); };
+
+	auto FitsWithinTolerance = [&](int32 Begin, int32 End) {
+		const TQuadratic<FVector3d> Fit = FitQuadratic<FVector3d>(Begin, End, FrameRate, GetPosition);
+		for (int32 Frame = Begin; Frame <= End; Frame++) {
+			if (FVector3d::DistSquared(Fit.Evaluate(Frame / FrameRate), GetPosition(Frame)) > ToleranceSquared) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	auto EmitSegment = [&](int32 Begin, int32 End) {
+		const TQuadratic<FVector3d> PositionFit = FitQuadratic<FVector3d>(Begin, End, FrameRate, GetPosition);
+
+		// Neighbouring segments cross at half visibility on the frame boundary between them, segments touching the ends
+		// of the clip are stretched past them so they stay opaque up to the first and last frame.
+		double VisibleBegin = (Begin - 0.5) / FrameRate;
+		double VisibleEnd = (End + 0.5) / FrameRate;
+		const double Length = VisibleEnd - VisibleBegin;
+		VisibleBegin -= Begin == 0 ? Length : 0.0;
+		VisibleEnd += End == NumFrames - 1 ? Length : 0.0;
+		double Center = 0.5 * (VisibleBegin + VisibleEnd);
+		double Sigma = 0.5 * (VisibleEnd - VisibleBegin) / FMath::Sqrt(FMath::Loge(2.0));
+		double Alpha = 0.0;
+		for (int32 Frame = Begin; Frame <= End; Frame++) {
+			Alpha = FMath::Max(Alpha, (double)Samples[Frame].Opacity);
+		}
+
+		// Splats that fade in and out within the segment keep the Gaussian fitted to their log opacity instead.
+		if (End - Begin >= 2) {
+			const TQuadratic<double> OpacityFit = FitQuadratic<double>(Begin, End, FrameRate, GetLogOpacity);
+			if (OpacityFit.Coefficients[2] < 0.0) {
+				const double FittedCenter = OpacityFit.Origin - OpacityFit.Coefficients[1] / (2.0 * OpacityFit.Coefficients[2]);
+				const double FittedSigma = 1.0 / FMath::Sqrt(-OpacityFit.Coefficients[2]);
+				if (FittedCenter >= Begin / FrameRate && FittedCenter <= End / FrameRate && FittedSigma < Sigma) {
+					Center = FittedCenter;
+					Sigma = FittedSigma;
+					Alpha = FMath::Min(FMath::Exp(OpacityFit.Evaluate(FittedCenter)), 1.0);
+				}
+			}
+		}
+
+		// Moves the expansion point of the trajectory to the temporal center, which is where the runtime evaluates it from.
+		const double Offset = Center - PositionFit.Origin;
+		const FVector3d Position = PositionFit.Evaluate(Center);
+		const FVector3d Velocity = PositionFit.Coefficients[1] + 2.0 * Offset * PositionFit.Coefficients[2];
+		const FVector3d Acceleration = PositionFit.Coefficients[2];
+
+		FGaussianSplattingPoint& Point = OutPoints.Add_GetRef(Appearance);
+		Point.Position = FVector3f(Position);
+		Point.Time = FVector4f((float)Center, (float)FMath::Loge(Sigma), (float)Velocity.X, (float)Velocity.Y);
+		Point.Motion = FVector4f((float)Velocity.Z, (float)Acceleration.X, (float)Acceleration.Y, (float)Acceleration.Z);
+		Point.Color.A = (float)Alpha;
+
+		OutStats.NumSegments++;
+		for (int32 Frame = Begin; Frame <= End; Frame++) {
+			const float PositionError = (Point.GetPositionAt((float)(Frame / FrameRate)) - Samples[Frame].Position).Size();
+			const double Visibility = FMath::Exp(-FMath::Square((Frame / FrameRate - Center) / Sigma));
+			OutStats.NumSamples++;
+			OutStats.SumSquaredPositionError += FMath::Square(PositionError);
+			OutStats.MaxPositionError = FMath::Max(OutStats.MaxPositionError, PositionError);
+			OutStats.SumSquaredOpacityError += FMath::Square(Alpha * Visibility - Samples[Frame].Opacity);
+		}
+	};
+
+	for (int32 RunBegin = 0; RunBegin < NumFrames;) {
+		// Faint frames split the trajectory, so splats that disappear and come back are fitted piece by piece.
+		if (Samples[RunBegin].Opacity <= Settings.MinOpacity) {
+			RunBegin++;
+			continue;
+		}
+		int32 RunEnd = RunBegin;
+		while (RunEnd + 1 < NumFrames && Samples[RunEnd + 1].Opacity > Settings.MinOpacity) {
+			RunEnd++;
+		}
+
+		// Grows each segment by doubling, then bisects between the last length that fits and the first that does not.
+		// Three frames always fit a quadratic exactly.
+		for (int32 Begin = RunBegin; Begin <= RunEnd;) {
+			int32 Good = FMath::Min(Begin + 2, RunEnd);
+			int32 Bad = RunEnd + 1;
+			for (int32 Length = 4; Good < RunEnd; Length *= 2) {
+				const int32 Probe = FMath::Min(Begin + Length - 1, RunEnd);
+				if (!FitsWithinTolerance(Begin, Probe)) {
+					Bad = Probe;
+					break;
+				}
+				Good = Probe;
+			}
+			while (Bad - Good > 1) {
+				const int32 Mid = (Good + Bad) / 2;
+				if (FitsWithinTolerance(Begin, Mid)) {
+					Good = Mid;
+				}
+				else {
+					Bad = Mid;
+				}
+			}
+			EmitSegment(Begin, Good);
+			Begin = Good + 1;
+		}
+		RunBegin = RunEnd + 1;
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GaussianSplattingPointCloud.h"
+
+/** Center and opacity of one splat in one frame of a sequence. */
+struct FGaussianSplattingFrameSample
+{
+	FVector3f Position = FVector3f::ZeroVector;
+	float Opacity = 0.0f;
+};
+
+/**
+ * Fits the per-frame samples of corresponding splats with the motion model of the runtime, a quadratic trajectory around a
+ * temporal center with a Gaussian visibility. Trajectories that no single quadratic follows within the tolerance are split
+ * into consecutive segments, each emitted as its own point.
+ */
+namespace GaussianSplattingMotionFit
+{
+	struct FSettings
+	{
+		float FrameRate = 30.0f;
+
+		/** Largest distance between a fitted and a sampled center, in the units of the points. */
+		float PositionTolerance = 1.0f;
+
+		/** Frames where the splat is fainter than this are treated as gaps. */
+		float MinOpacity = 1.0f / 255.0f;
+	};
+
+	struct FStats
+	{
+		int64 NumSegments = 0;
+		int64 NumSamples = 0;
+		double SumSquaredPositionError = 0.0;
+		float MaxPositionError = 0.0f;
+		double SumSquaredOpacityError = 0.0;
+
+		void Accumulate(const FStats& Other);
+	};
+
+	/**
+	 * Appends the points fitted to the samples of one splat, one sample per frame starting at time zero.
+	 * Appearance gives the orientation, scale and color of the emitted points, the opacity comes from the fit.
+	 */
+	void FitSplat(TConstArrayView<FGaussianSplattingFrameSample> Samples, const FGaussianSplattingPoint& Appearance, const FSettings& Settings, TArray<FGaussianSplattingPoint>& OutPoints, FStats& OutStats);
+}
@@ -0,0 +1,232 @@
+#include "GaussianSplattingSimplify.h"
+#include "GaussianSplattingSorter.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include <algorithm>
+
+#define LOCTEXT_NAMESPACE "GaussianSplatting"
+
+namespace
+{
+	/** Cells of 21 bits per axis packed in a single key, neighbouring keys are found by offsetting the coordinates. */
+	uint64 MakeCellKey(const FIntVector& Cell)
+	{
+		return ((uint64)(Cell.X & 0x1FFFFF) << 42) | ((uint64)(Cell.Y & 0x1FFFFF) << 21) | (uint64)(Cell.Z & 0x1FFFFF);
+	}
+
+	/** Kept splats bucketed in a uniform grid, to look up the nearest kept splat of every removed one. */
+	struct FKeptGrid
+	{
+		FVector3f Origin = FVector3f::ZeroVector;
+		float CellSize = 1.0f;
+		TArray<TPair<uint64, int32>> Entries;
+
+		FIntVector GetCell(const FVector3f& Position) const
+		{
+			const FVector3f Cell = (Position - Origin) / CellSize;
+			return FIntVector(FMath::Clamp(FMath::FloorToInt32(Cell.X), 0, 0x1FFFFF), FMath::Clamp(FMath::FloorToInt32(Cell.Y), 0, 0x1FFFFF), FMath::Clamp(FMath::FloorToInt32(Cell.Z), 0, 0x1FFFFF));
+		}
+	};
+
+	/** Splats checked per cell at most, dense cells give an approximate nearest distance instead of scanning every splat. */
+	constexpr int32 MaxCandidatesPerCell = 64;
+}
+
+void GaussianSplattingSimplify::MakeSampleViews(const FBox3f& Bounds, int32 NumViews, TArray<FVector3f>& OutViewLocations)
+{
+	// Fibonacci sphere, which covers the directions evenly for any number of views.
+	const FVector3f Center = Bounds.GetCenter();
+	const float Radius = FMath::Max(Bounds.GetExtent().Size(), UE_KINDA_SMALL_NUMBER) * 2.0f;
+	const float GoldenAngle = UE_PI * (3.0f - FMath::Sqrt(5.0f));
+	NumViews = FMath::Max(NumViews, 1);
+	OutViewLocations.Reset(NumViews);
+	for (int32 ViewIndex = 0; ViewIndex < NumViews; ViewIndex++) {
+		const float Z = 1.0f - 2.0f * (ViewIndex + 0.5f) / NumViews;
+		const float Ring = FMath::Sqrt(FMath::Max(1.0f - Z * Z, 0.0f));
+		const float Angle = GoldenAngle * ViewIndex;
+		OutViewLocations.Add(Center + FVector3f(FMath::Cos(Angle) * Ring, FMath::Sin(Angle) * Ring, Z) * Radius);
+	}
+}
+
+void GaussianSplattingSimplify::ComputeContributions(TConstArrayView<FGaussianSplattingPoint> Points, TConstArrayView<FVector3f> ViewLocations, TArray<float>& OutContributions)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingSimplify::ComputeContributions);
+	const int32 NumPoints = Points.Num();
+	OutContributions.SetNumZeroed(NumPoints);
+	if (NumPoints == 0 || ViewLocations.IsEmpty()) {
+		return;
+	}
+
+	const int32 PointsPerBlock = 1 << 16;
+	const int32 NumBlocks = FMath::DivideAndRoundUp(NumPoints, PointsPerBlock);
+	FScopedSlowTask SlowTask(NumBlocks, LOCTEXT("ComputeContributions", "Measuring splat contributions"));
+	for (int32 BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex++) {
+		SlowTask.EnterProgressFrame(1.0f);
+		const int32 Begin = BlockIndex * PointsPerBlock;
+		const int32 End = FMath::Min(Begin + PointsPerBlock, NumPoints);
+		ParallelFor(TEXT("GaussianSplatting.SimplifyContributions"), End - Begin, 1024, [&](int32 Offset) {
+			const FGaussianSplattingPoint& Point = Points[Begin + Offset];
+			const FVector3f Scale = Point.Scale.GetAbs();
+			const FVector3f Axes[3] = { Point.Quat.GetAxisX(), Point.Quat.GetAxisY(), Point.Quat.GetAxisZ() };
+			// The projection of a Gaussian along D covers an area proportional to sqrt(det(Sigma) * D^T Sigma^-1 D), which
+			// expands to the products of the two scales orthogonal to each axis without dividing by a vanishing scale.
+			const float Products[3] = { Scale.Y * Scale.Z, Scale.X * Scale.Z, Scale.X * Scale.Y };
+			double Sum = 0.0;
+			for (const FVector3f& ViewLocation : ViewLocations) {
+				const FVector3f Delta = Point.Position - ViewLocation;
+				const float DepthSquared = FMath::Max(Delta.SizeSquared(), UE_KINDA_SMALL_NUMBER);
+				const FVector3f Direction = Delta * FMath::InvSqrt(DepthSquared);
+				float AreaSquared = 0.0f;
+				for (int32 k = 0; k < 3; k++) {
+					AreaSquared += FMath::Square(FVector3f::DotProduct(Direction, Axes[k]) * Products[k]);
+				}
+				Sum += FMath::Sqrt(AreaSquared) / DepthSquared;
+			}
+			OutContributions[Begin + Offset] = (float)(FMath::Clamp(Point.Color.A, 0.0f, 1.0f) * Sum / ViewLocations.Num());
+		});
+	}
+}
+
+void GaussianSplattingSimplify::Simplify(TConstArrayView<FGaussianSplattingPoint> Points, const FSettings& Settings, TArray<FGaussianSplattingPoint>& OutPoints, FStats& OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingSimplify::Simplify);
+	OutPoints.Reset();
+	OutStats = FStats();
+	const int32 NumPoints = Points.Num();
+	if (NumPoints == 0) {
+		return;
+	}
+	FScopedSlowTask SlowTask(3.0f, LOCTEXT("Simplify", "Simplifying point cloud"));
+
+	FBox3f Bounds(ForceInit);
+	for (const FGaussianSplattingPoint& Point : Points) {
+		Bounds += Point.Position;
+	}
+	SlowTask.EnterProgressFrame(1.0f);
+	TArray<float> Contributions;
+	if (Settings.Contributions.Num() == NumPoints) {
+		Contributions = Settings.Contributions;
+	}
+	else {
+		TArray<FVector3f> ViewLocations = Settings.ViewLocations;
+		if (ViewLocations.IsEmpty()) {
+			MakeSampleViews(Bounds, Settings.NumViews, ViewLocations);
+		}
+		ComputeContributions(Points, ViewLocations, Contributions);
+	}
+
+	// Contributions are positive, so their bits sort like the values.
+	SlowTask.EnterProgressFrame(1.0f);
+	TArray<uint32> Keys;
+	TArray<uint32> Order;
+	Keys.SetNumUninitialized(NumPoints);
+	Order.SetNumUninitialized(NumPoints);
+	double TotalContribution = 0.0;
+	for (int32 i = 0; i < NumPoints; i++) {
+		Keys[i] = GaussianSplattingSort::FloatToSortableKey(Contributions[i]);
+		Order[i] = i;
+		TotalContribution += Contributions[i];
+	}
+	GaussianSplattingSort::RadixSort(Keys, Order);
+	Keys.Empty();
+
+	// The cap is met first, then the error budget removes more of the weakest splats while it lasts. One splat is always kept.
+	int32 NumRemoved = Settings.TargetPointCount > 0 ? FMath::Clamp(NumPoints - Settings.TargetPointCount, 0, NumPoints - 1) : 0;
+	double RemovedContribution = 0.0;
+	for (int32 i = 0; i < NumRemoved; i++) {
+		RemovedContribution += Contributions[Order[i]];
+	}
+	if (Settings.MaxContributionLoss > 0.0f) {
+		const double MaxRemovedContribution = Settings.MaxContributionLoss * TotalContribution;
+		while (NumRemoved < NumPoints - 1 && RemovedContribution + Contributions[Order[NumRemoved]] <= MaxRemovedContribution) {
+			RemovedContribution += Contributions[Order[NumRemoved]];
+			NumRemoved++;
+		}
+	}
+
+	TBitArray<> Kept(true, NumPoints);
+	for (int32 i = 0; i < NumRemoved; i++) {
+		Kept[Order[i]] = false;
+	}
+	OutPoints.Reserve(NumPoints - NumRemoved);
+	for (int32 i = 0; i < NumPoints; i++) {
+		if (Kept[i]) {
+			OutPoints.Add(Points[i]);
+		}
+	}
+	OutStats.ContributionLoss = TotalContribution > 0.0 ? (float)(RemovedContribution / TotalContribution) : 0.0f;
+	OutStats.MaxRemovedContribution = NumRemoved > 0 && TotalContribution > 0.0 ? (float)(Contributions[Order[NumRemoved - 1]] / (TotalContribution / NumPoints)) : 0.0f;
+
+	// Holes are what removing splats costs the most, so every removed splat looks for the nearest kept one within a few typical splat sizes.
+	SlowTask.EnterProgressFrame(1.0f);
+	if (NumRemoved == 0) {
+		return;
+	}
+	TArray<float> Extents;
+	Extents.SetNumUninitialized(NumPoints);
+	for (int32 i = 0; i < NumPoints; i++) {
+		Extents[i] = Points[i].Scale.GetAbsMax();
+	}
+	const int32 MedianIndex = NumPoints / 2;
+	std::nth_element(Extents.GetData(), Extents.GetData() + MedianIndex, Extents.GetData() + Extents.Num());
+	FKeptGrid Grid;
+	Grid.Origin = Bounds.Min;
+	Grid.CellSize = FMath::Max3(Extents[MedianIndex] * 3.0f, Bounds.GetSize().GetMax() / 0x1FFFFF, UE_KINDA_SMALL_NUMBER);
+	Extents.Empty();
+	Grid.Entries.Reserve(OutPoints.Num());
+	for (int32 i = 0; i < OutPoints.Num(); i++) {
+		Grid.Entries.Emplace(MakeCellKey(Grid.GetCell(OutPoints[i].Position)), i);
+	}
+	Algo::SortBy(Grid.Entries, [](const TPair<uint64, int32>& Entry) { return Entry.Key; });
+
+	const int32 RemovedPerBlock = 4096;
+	const int32 NumBlocks = FMath::DivideAndRoundUp(NumRemoved, RemovedPerBlock);
+	TArray<double> BlockDistances;
+	TArray<double> BlockWeights;
+	TArray<int32> BlockUncovered;
+	BlockDistances.SetNumZeroed(NumBlocks);
+	BlockWeights.SetNumZeroed(NumBlocks);
+	BlockUncovered.SetNumZeroed(NumBlocks);
+	ParallelFor(TEXT("GaussianSplatting.SimplifyDistances"), NumBlocks, 1, [&](int32 BlockIndex) {
+		const int32 End = FMath::Min((BlockIndex + 1) * RemovedPerBlock, NumRemoved);
+		for (int32 RemovedIndex = BlockIndex * RemovedPerBlock; RemovedIndex < End; RemovedIndex++) {
+			const int32 PointIndex = Order[RemovedIndex];
+			const FVector3f& Position = Points[PointIndex].Position;
+			const FIntVector Cell = Grid.GetCell(Position);
+			float NearestSquared = UE_MAX_FLT;
+			for (int32 Z = -1; Z <= 1; Z++) {
+				for (int32 Y = -1; Y <= 1; Y++) {
+					for (int32 X = -1; X <= 1; X++) {
+						const FIntVector Neighbour = Cell + FIntVector(X, Y, Z);
+						if (Neighbour.GetMin() < 0 || Neighbour.GetMax() > 0x1FFFFF) {
+							continue;
+						}
+						const uint64 Key = MakeCellKey(Neighbour);
+						const int32 First = Algo::LowerBoundBy(Grid.Entries, Key, [](const TPair<uint64, int32>& Entry) { return Entry.Key; });
+						for (int32 EntryIndex = First; EntryIndex < Grid.Entries.Num() && EntryIndex < First + MaxCandidatesPerCell && Grid.Entries[EntryIndex].Key == Key; EntryIndex++) {
+							NearestSquared = FMath::Min(NearestSquared, FVector3f::DistSquared(Position, OutPoints[Grid.Entries[EntryIndex].Value].Position));
+						}
+					}
+				}
+			}
+			if (NearestSquared == UE_MAX_FLT) {
+				BlockUncovered[BlockIndex]++;
+				continue;
+			}
+			BlockDistances[BlockIndex] += NearestSquared * Contributions[PointIndex];
+			BlockWeights[BlockIndex] += Contributions[PointIndex];
+		}
+	});
+	double SumDistances = 0.0;
+	double SumWeights = 0.0;
+	for (int32 BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex++) {
+		SumDistances += BlockDistances[BlockIndex];
+		SumWeights += BlockWeights[BlockIndex];
+		OutStats.NumUncovered += BlockUncovered[BlockIndex];
+	}
+	OutStats.RMSRemovedDistance = SumWeights > 0.0 ? (float)FMath::Sqrt(SumDistances / SumWeights) : 0.0f;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GaussianSplattingPointCloud.h"
+
+/**
+ * Reduces the number of splats of a cloud by dropping the ones contributing the least to a set of sample views.
+ * The contribution of a splat is its opacity times its projected area, averaged over the views, occlusion is ignored,
+ * unless measured contributions such as the capture scores of GaussianSplattingCaptureScore are given.
+ */
+namespace GaussianSplattingSimplify
+{
+	struct FSettings
+	{
+		/** Largest number of points kept, 0 means no cap. */
+		int32 TargetPointCount = 0;
+
+		/** Fraction of the total contribution that may be removed on top of the cap, 0 disables it. */
+		float MaxContributionLoss = 0.0f;
+
+		/** Camera positions the contributions are measured from, in the units of the points. Empty places NumViews around the bounds. */
+		TArray<FVector3f> ViewLocations;
+
+		int32 NumViews = 32;
+
+		/** Measured contribution of every point, such as its summed blending weight over the capture views, used instead of the projected areas when given. */
+		TArray<float> Contributions;
+	};
+
+	struct FStats
+	{
+		/** Removed contribution divided by the total contribution. */
+		float ContributionLoss = 0.0f;
+
+		/** Largest contribution among the removed splats divided by the mean contribution of the source. */
+		float MaxRemovedContribution = 0.0f;
+
+		/** Root mean square distance from the removed splats to the nearest kept one, weighted by contribution. */
+		float RMSRemovedDistance = 0.0f;
+
+		/** Removed splats without any kept splat in their neighbourhood, which leave holes. */
+		int32 NumUncovered = 0;
+	};
+
+	/** Spreads NumViews camera positions evenly on a sphere twice as large as the bounds, looking at their center. */
+	void MakeSampleViews(const FBox3f& Bounds, int32 NumViews, TArray<FVector3f>& OutViewLocations);
+
+	/** Opacity times the mean projected area of every point over the views, run in parallel and reporting progress one view at a time. */
+	void ComputeContributions(TConstArrayView<FGaussianSplattingPoint> Points, TConstArrayView<FVector3f> ViewLocations, TArray<float>& OutContributions);
+
+	/** Keeps the points with the highest contributions, in their original order. */
+	void Simplify(TConstArrayView<FGaussianSplattingPoint> Points, const FSettings& Settings, TArray<FGaussianSplattingPoint>& OutPoints, FStats& OutStats);
+}
@@ -0,0 +1,50 @@
+#include "GaussianSplattingSimplifyCommandlet.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/SavePackage.h"
+
+int32 UGaussianSplattingSimplifyCommandlet::Main(const FString& Params)
+{
+	FString SourcePath;
+	FString DestPath;
+	if (!FParse::Value(*Params, TEXT("Source="), SourcePath) || !FParse::Value(*Params, TEXT("Dest="), DestPath)) {
+		UE_LOG(LogTemp, Error, TEXT("Usage: -run=GaussianSplattingSimplify -Source=/Game/Path/Cloud -Dest=/Game/Path/NewCloud [-TargetPoints=N] [-MaxLoss=0.01] [-Views=32]"));
+		return 1;
+	}
+	FGaussianSplattingSimplifySettings Settings;
+	FParse::Value(*Params, TEXT("TargetPoints="), Settings.TargetPointCount);
+	FParse::Value(*Params, TEXT("MaxLoss="), Settings.MaxContributionLoss);
+	FParse::Value(*Params, TEXT("Views="), Settings.NumViews);
+	FGaussianSplattingSimplifyReport Report;
+	return SimplifyToAsset(SourcePath, DestPath, Settings, Report) ? 0 : 1;
+}
+
+bool UGaussianSplattingSimplifyCommandlet::SimplifyToAsset(const FString& SourcePath, const FString& DestPath, const FGaussianSplattingSimplifySettings& Settings, FGaussianSplattingSimplifyReport& OutReport)
+{
+	UGaussianSplattingPointCloud* Source = LoadObject<UGaussianSplattingPointCloud>(nullptr, *SourcePath);
+	if (Source == nullptr) {
+		UE_LOG(LogTemp, Error, TEXT("Failed to load the point cloud %s."), *SourcePath);
+		return false;
+	}
+	const FString PackageName = FPackageName::ObjectPathToPackageName(DestPath);
+	if (PackageName.IsEmpty() || PackageName == Source->GetOutermost()->GetName()) {
+		UE_LOG(LogTemp, Error, TEXT("Simplification writes a new asset, %s must differ from the source package."), *DestPath);
+		return false;
+	}
+
+	UPackage* Package = CreatePackage(*PackageName);
+	UGaussianSplattingPointCloud* PointCloud = UGaussianSplattingEditorLibrary::SimplifyPointCloud(Source, Package, *FPackageName::GetShortName(PackageName), Settings, OutReport);
+	if (PointCloud == nullptr) {
+		return false;
+	}
+	PointCloud->SetFlags(RF_Public | RF_Standalone);
+	FAssetRegistryModule::AssetCreated(PointCloud);
+	const FString Filename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.Error = GError;
+	if (!UPackage::SavePackage(Package, PointCloud, *Filename, SaveArgs)) {
+		UE_LOG(LogTemp, Error, TEXT("Failed to save %s."), *Filename);
+		return false;
+	}
+	return true;
+}
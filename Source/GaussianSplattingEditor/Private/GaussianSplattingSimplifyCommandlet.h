@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "GaussianSplattingEditorLibrary.h"
+#include "GaussianSplattingSimplifyCommandlet.generated.h"
+
+/**
+ * Simplifies a point cloud asset into a new one from the command line, see UGaussianSplattingEditorLibrary::SimplifyPointCloud.
+ * -run=GaussianSplattingSimplify -Source=/Game/Path/Cloud -Dest=/Game/Path/Cloud_Mobile [-TargetPoints=500000] [-MaxLoss=0.01] [-Views=32]
+ */
+UCLASS()
+class UGaussianSplattingSimplifyCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+public:
+	int32 Main(const FString& Params) override;
+
+	/**
+	 * Simplifies the cloud at SourcePath into a new asset saved at DestPath, which must be another package. Also runs the
+	 * Simplify jobs of UGaussianSplattingCommandlet. Logs and returns false on failure.
+	 */
+	static bool SimplifyToAsset(const FString& SourcePath, const FString& DestPath, const FGaussianSplattingSimplifySettings& Settings, FGaussianSplattingSimplifyReport& OutReport);
+};
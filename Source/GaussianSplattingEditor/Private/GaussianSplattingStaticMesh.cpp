@@ -0,0 +1,190 @@
+#include "GaussianSplattingStaticMesh.h"
+#include "GaussianSplattingEditorLibrary.h"
+#include "Async/ParallelFor.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshAttributes.h"
+#include "StaticMeshResources.h"
+
+namespace
+{
+	/** Corners of a quad in the XZ plane, with the UVs of the triangles of the mesh description path. */
+	const FVector3f QuadCorners[4] = { FVector3f(-1.0f, 0.0f, -1.0f), FVector3f(1.0f, 0.0f, -1.0f), FVector3f(1.0f, 0.0f, 1.0f), FVector3f(-1.0f, 0.0f, 1.0f) };
+	const FVector2f QuadUVs[4] = { FVector2f(0.0f, 0.0f), FVector2f(1.0f, 0.0f), FVector2f(1.0f, 1.0f), FVector2f(0.0f, 1.0f) };
+	const uint32 QuadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+}
+
+FIntPoint GaussianSplattingStaticMesh::GetTextureSize(int32 NumPoints)
+{
+	const int32 Width = (int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::CeilToInt32(FMath::Sqrt((double)NumPoints)));
+	return FIntPoint(Width, FMath::Max(FMath::DivideAndRoundUp(NumPoints, Width), 1));
+}
+
+float GaussianSplattingStaticMesh::GetQuadSize(const FGaussianSplattingPoint& Point)
+{
+	return 4 * FMath::Max(Point.Scale.Length(), 0.00001f) * 0.001f;
+}
+
+FVector2f GaussianSplattingStaticMesh::GetTexelUV(int32 Index, FIntPoint TextureSize)
+{
+	const FVector2f InvTextureSize(1.0f / (TextureSize.X + 0.5f), 1.0f / TextureSize.Y);
+	const FVector2f Coord = FVector2f(Index % TextureSize.X, Index / TextureSize.X);
+	return (Coord + 0.5f) * InvTextureSize;
+}
+
+FLinearColor GaussianSplattingStaticMesh::GetTexelColor(int32 Index, FIntPoint TextureSize)
+{
+	const FVector2f SampleUV = GetTexelUV(Index, TextureSize);
+	return UGaussianSplattingEditorLibrary::SRGBToLinear(FLinearColor(SampleUV.X, 0.0f, 0.0f, SampleUV.Y));
+}
+
+void GaussianSplattingStaticMesh::BuildAttributeData(TConstArrayView<FGaussianSplattingPoint> Points, FAttributeData& OutData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingStaticMesh::BuildAttributeData);
+	OutData.TextureSize = GetTextureSize(Points.Num());
+	const int32 NumTexels = OutData.TextureSize.X * OutData.TextureSize.Y;
+	OutData.Scale.SetNumZeroed(NumTexels * 4);
+	OutData.Quat.SetNumZeroed(NumTexels * 4);
+	OutData.Color.SetNumZeroed(NumTexels * 4);
+	ParallelFor(TEXT("GaussianSplatting.StaticMeshAttributes"), Points.Num(), 16384, [&](int32 i) {
+		const FGaussianSplattingPoint& Point = Points[i];
+		FFloat16* Scale = &OutData.Scale[i * 4];
+		FFloat16* Quat = &OutData.Quat[i * 4];
+		FFloat16* Color = &OutData.Color[i * 4];
+		Scale[0] = Point.Scale.X;
+		Scale[1] = Point.Scale.Y;
+		Scale[2] = Point.Scale.Z;
+		Scale[3] = GetQuadSize(Point);
+		Quat[0] = Point.Quat.X;
+		Quat[1] = Point.Quat.Y;
+		Quat[2] = Point.Quat.Z;
+		Quat[3] = Point.Quat.W;
+		Color[0] = Point.Color.R;
+		Color[1] = Point.Color.G;
+		Color[2] = Point.Color.B;
+		Color[3] = Point.Color.A;
+	});
+}
+
+void GaussianSplattingStaticMesh::BuildMeshDescription(FMeshDescription& MeshDescription, TConstArrayView<FGaussianSplattingPoint> Points, FIntPoint TextureSize)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingStaticMesh::BuildMeshDescription);
+	FStaticMeshAttributes AttributeGetter = FStaticMeshAttributes(MeshDescription);
+	AttributeGetter.Register();
+	TPolygonGroupAttributesRef<FName> PolygonGroupNames = AttributeGetter.GetPolygonGroupMaterialSlotNames();
+	TVertexAttributesRef<FVector3f> VertexPositions = AttributeGetter.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector4f> Colors = AttributeGetter.GetVertexInstanceColors();
+	TVertexInstanceAttributesRef<FVector2f> UVs = AttributeGetter.GetVertexInstanceUVs();
+
+	const int32 PointCount = Points.Num();
+	MeshDescription.ReserveNewVertices(PointCount * 4);
+	MeshDescription.ReserveNewVertexInstances(PointCount * 6);
+	MeshDescription.ReserveNewTriangles(PointCount * 2);
+	MeshDescription.ReserveNewEdges(PointCount * 4);
+	UVs.SetNumChannels(1);
+	Colors.SetNumChannels(1);
+
+	const FPolygonGroupID PolygonGroup0 = MeshDescription.CreatePolygonGroup();
+	for (int32 i = 0; i < PointCount; i++) {
+		const FGaussianSplattingPoint& Point = Points[i];
+		const float QuadSize = GetQuadSize(Point);
+		const FVector4f VertexColor = GetTexelColor(i, TextureSize);
+		FVertexID VertexIDs[4];
+		for (int32 Corner = 0; Corner < 4; Corner++) {
+			VertexIDs[Corner] = MeshDescription.CreateVertex();
+			VertexPositions[VertexIDs[Corner]] = Point.Position + QuadSize * QuadCorners[Corner];
+		}
+		FVertexInstanceID VertexInstanceIDs[6];
+		for (int32 Corner = 0; Corner < 6; Corner++) {
+			VertexInstanceIDs[Corner] = MeshDescription.CreateVertexInstance(VertexIDs[QuadIndices[Corner]]);
+			UVs.Set(VertexInstanceIDs[Corner], 0, QuadUVs[QuadIndices[Corner]]);
+			Colors[VertexInstanceIDs[Corner]] = VertexColor;
+		}
+		MeshDescription.CreateTriangle(PolygonGroup0, { VertexInstanceIDs[0], VertexInstanceIDs[1], VertexInstanceIDs[2] });
+		MeshDescription.CreateTriangle(PolygonGroup0, { VertexInstanceIDs[3], VertexInstanceIDs[4], VertexInstanceIDs[5] });
+	}
+	PolygonGroupNames[PolygonGroup0] = "LOD0_Section0";
+}
+
+void GaussianSplattingStaticMesh::BuildRenderData(UStaticMesh* StaticMesh, TConstArrayView<FGaussianSplattingPoint> Points, FIntPoint TextureSize, FStats* OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingStaticMesh::BuildRenderData);
+	double StartTime = FPlatformTime::Seconds();
+	const int32 NumPoints = Points.Num();
+	const int32 NumVertices = NumPoints * 4;
+	TUniquePtr<FStaticMeshRenderData> RenderData = MakeUnique<FStaticMeshRenderData>();
+	RenderData->AllocateLODResources(1);
+	FStaticMeshLODResources& LODResources = RenderData->LODResources[0];
+	FStaticMeshVertexBuffers& VertexBuffers = LODResources.VertexBuffers;
+	VertexBuffers.PositionVertexBuffer.Init(NumVertices);
+	VertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(true);
+	VertexBuffers.StaticMeshVertexBuffer.Init(NumVertices, 1);
+	VertexBuffers.ColorVertexBuffer.Init(NumVertices);
+	TArray<uint32> Indices;
+	Indices.SetNumUninitialized(NumPoints * 6);
+
+	// Every quad lies in the XZ plane, so all vertices share one tangent frame.
+	const FVector3f TangentX(1.0f, 0.0f, 0.0f);
+	const FVector3f TangentY(0.0f, 0.0f, 1.0f);
+	const FVector3f TangentZ(0.0f, -1.0f, 0.0f);
+	ParallelFor(TEXT("GaussianSplatting.StaticMeshVertices"), NumPoints, 16384, [&](int32 i) {
+		const FGaussianSplattingPoint& Point = Points[i];
+		const float QuadSize = GetQuadSize(Point);
+		// Stored as sRGB like the mesh build does, which turns the texel color back into the texel coordinates.
+		const FColor TexelColor = GetTexelColor(i, TextureSize).ToFColor(true);
+		for (int32 Corner = 0; Corner < 4; Corner++) {
+			const uint32 Vertex = i * 4 + Corner;
+			VertexBuffers.PositionVertexBuffer.VertexPosition(Vertex) = Point.Position + QuadSize * QuadCorners[Corner];
+			VertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(Vertex, TangentX, TangentY, TangentZ);
+			VertexBuffers.StaticMeshVertexBuffer.SetVertexUV(Vertex, 0, QuadUVs[Corner]);
+			VertexBuffers.ColorVertexBuffer.VertexColor(Vertex) = TexelColor;
+		}
+		for (int32 Corner = 0; Corner < 6; Corner++) {
+			Indices[i * 6 + Corner] = i * 4 + QuadIndices[Corner];
+		}
+	});
+	FBox3f Bounds(ForceInit);
+	for (const FGaussianSplattingPoint& Point : Points) {
+		Bounds += FBox3f(Point.Position - FVector3f(GetQuadSize(Point)), Point.Position + FVector3f(GetQuadSize(Point)));
+	}
+	LODResources.IndexBuffer.SetIndices(Indices, NumVertices > MAX_uint16 ? EIndexBufferStride::Force32Bit : EIndexBufferStride::Force16Bit);
+	LODResources.bHasColorVertexData = true;
+	FStaticMeshSection& Section = LODResources.Sections.AddDefaulted_GetRef();
+	Section.MaterialIndex = 0;
+	Section.FirstIndex = 0;
+	Section.NumTriangles = NumPoints * 2;
+	Section.MinVertexIndex = 0;
+	Section.MaxVertexIndex = FMath::Max(NumVertices - 1, 0);
+	Section.bEnableCollision = false;
+	RenderData->Bounds = FBoxSphereBounds(FBox(Bounds));
+	RenderData->ScreenSize[0].Default = 1.0f;
+	if (OutStats) {
+		OutStats->VertexSeconds = FPlatformTime::Seconds() - StartTime;
+		OutStats->NumVertexBytes = (int64)NumVertices * (VertexBuffers.PositionVertexBuffer.GetStride() + VertexBuffers.ColorVertexBuffer.GetStride())
+			+ VertexBuffers.StaticMeshVertexBuffer.GetTangentSize() + VertexBuffers.StaticMeshVertexBuffer.GetTexCoordSize();
+		OutStats->NumIndexBytes = (int64)Indices.Num() * (NumVertices > MAX_uint16 ? sizeof(uint32) : sizeof(uint16));
+	}
+
+	StartTime = FPlatformTime::Seconds();
+	StaticMesh->ReleaseResources();
+	StaticMesh->SetRenderData(MoveTemp(RenderData));
+	StaticMesh->SetIsBuiltAtRuntime(true);
+	StaticMesh->CalculateExtendedBounds();
+	StaticMesh->InitResources();
+	if (OutStats) {
+		OutStats->UploadSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+}
+
+void GaussianSplattingStaticMesh::BuildInstanceData(TConstArrayView<FGaussianSplattingPoint> Points, FIntPoint TextureSize, TArray<FTransform>& OutTransforms, TArray<float>& OutCustomData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingStaticMesh::BuildInstanceData);
+	OutTransforms.SetNumUninitialized(Points.Num());
+	OutCustomData.SetNumUninitialized(Points.Num() * NumInstanceCustomDataFloats);
+	ParallelFor(TEXT("GaussianSplatting.StaticMeshInstances"), Points.Num(), 16384, [&](int32 i) {
+		const FGaussianSplattingPoint& Point = Points[i];
+		OutTransforms[i] = FTransform(FQuat::Identity, FVector(Point.Position), FVector(GetQuadSize(Point)));
+		const FVector2f SampleUV = GetTexelUV(i, TextureSize);
+		OutCustomData[i * NumInstanceCustomDataFloats] = SampleUV.X;
+		OutCustomData[i * NumInstanceCustomDataFloats + 1] = SampleUV.Y;
+	});
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GaussianSplattingPointCloud.h"
+
+class UStaticMesh;
+struct FMeshDescription;
+
+/**
+ * Geometry and attribute textures of the static mesh output: every splat is a camera facing quad whose vertex color holds
+ * the texel of the splat in the scale, rotation and color textures the material reads.
+ */
+namespace GaussianSplattingStaticMesh
+{
+	struct FAttributeData
+	{
+		/** Size of the attribute textures, a power of two wide and only as many rows high as the points fill. */
+		FIntPoint TextureSize = FIntPoint::ZeroValue;
+
+		/** RGBA float16 texels, scale with the quad size in alpha, rotation and color. */
+		TArray<FFloat16> Scale;
+		TArray<FFloat16> Quat;
+		TArray<FFloat16> Color;
+	};
+
+	struct FStats
+	{
+		double VertexSeconds = 0.0;
+
+		double UploadSeconds = 0.0;
+
+		int64 NumVertexBytes = 0;
+
+		int64 NumIndexBytes = 0;
+	};
+
+	FIntPoint GetTextureSize(int32 NumPoints);
+
+	/** Half size of the quad of a splat. */
+	float GetQuadSize(const FGaussianSplattingPoint& Point);
+
+	/** Coordinates the material samples the attribute textures of point Index at. */
+	FVector2f GetTexelUV(int32 Index, FIntPoint TextureSize);
+
+	/** Vertex color of the quads of point Index, which the mesh build stores as the sRGB texel coordinates of the point. */
+	FLinearColor GetTexelColor(int32 Index, FIntPoint TextureSize);
+
+	/** Fills the attribute textures of all points in parallel, texels past the last point are zero. */
+	void BuildAttributeData(TConstArrayView<FGaussianSplattingPoint> Points, FAttributeData& OutData);
+
+	/**
+	 * Fills the mesh description of the static mesh output with one quad of two triangles per point. Only touches the
+	 * description, so the descriptions of several meshes can be filled in parallel.
+	 */
+	void BuildMeshDescription(FMeshDescription& MeshDescription, TConstArrayView<FGaussianSplattingPoint> Points, FIntPoint TextureSize);
+
+	/**
+	 * Fills the render data of a single LOD directly: the vertex and index buffers of all quads are written in parallel without
+	 * a mesh description or a mesh build, then the resources are initialized. The mesh keeps no source model, so it renders as
+	 * built until it is reloaded in the editor, which suits meshes used within a session such as previews and captures.
+	 */
+	void BuildRenderData(UStaticMesh* StaticMesh, TConstArrayView<FGaussianSplattingPoint> Points, FIntPoint TextureSize, FStats* OutStats = nullptr);
+
+	/** Custom data floats of an instance, the texel coordinates of its point. */
+	constexpr int32 NumInstanceCustomDataFloats = 2;
+
+	/**
+	 * Fills the instances of the instanced output in parallel: the transform moves and scales the shared quad like the quads of
+	 * the static mesh, the custom data holds the texel coordinates the vertex color holds there.
+	 */
+	void BuildInstanceData(TConstArrayView<FGaussianSplattingPoint> Points, FIntPoint TextureSize, TArray<FTransform>& OutTransforms, TArray<float>& OutCustomData);
+}
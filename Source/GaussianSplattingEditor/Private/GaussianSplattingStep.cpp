@@ -1229,6 +1229,10 @@ UObject* UGaussianSplattingStep_GaussianSplatting::LoadPly(UObject* Outer, FName
 	if (Output) {
 		
 		Output->SetCompressionMethod(CompressionMethod);
+		if (bScoreByCapture) {
+			FGaussianSplattingCaptureScoreReport ScoreReport;
+			UGaussianSplattingEditorLibrary::ScorePointCloudFromCapture(Output, WorkDir, ScoreReport, ScoreMaxResolution, ScoreMaxViews);
+		}
 	}
 	return Output;
 }
@@ -323,5 +323,20 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Load")
 	float MinScreenSizeOfObservation = 0.01f;
 
+	/**
+	 * Measures how much every loaded splat shows in the capture images, which simplification and the levels of detail use.
+	 * Rendering every capture view takes a while for large clouds, so it is opt-in.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Load")
+	bool bScoreByCapture = false;
+
+	/** Cameras spread over the capture that are scored, 0 scores all of them. */
+	UPROPERTY(EditAnywhere, Config, meta = (EditCondition = "bScoreByCapture", EditConditionHides, ClampMin = 0), Category = "Load")
+	int32 ScoreMaxViews = 64;
+
+	/** Longest side in pixels the capture images are scored at. */
+	UPROPERTY(EditAnywhere, Config, meta = (EditCondition = "bScoreByCapture", EditConditionHides, ClampMin = 1), Category = "Load")
+	int32 ScoreMaxResolution = 1600;
+
 	FSimpleDelegate OnPlyLoadFinished;
 };
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "GaussianSplattingEditorLibrary.h"
+#include "GaussianSplattingBenchmarks.h"
+#include "GaussianSplattingStaticMesh.h"
+#include "Engine/StaticMesh.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGaussianSplattingStaticMeshTextureSizeTest, "GaussianSplatting.StaticMesh.TextureSize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGaussianSplattingStaticMeshTextureSizeTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("Empty"), GaussianSplattingStaticMesh::GetTextureSize(0), FIntPoint(1, 1));
+	TestEqual(TEXT("Single point"), GaussianSplattingStaticMesh::GetTextureSize(1), FIntPoint(1, 1));
+	TestEqual(TEXT("Full square"), GaussianSplattingStaticMesh::GetTextureSize(1024 * 1024), FIntPoint(1024, 1024));
+	// Only the rows the points fill are allocated.
+	TestEqual(TEXT("Partial rows"), GaussianSplattingStaticMesh::GetTextureSize(1025), FIntPoint(64, 17));
+
+	for (int32 NumPoints : { 2, 3, 5, 100, 4097, 1000000, 16384 * 16384 }) {
+		const FIntPoint TextureSize = GaussianSplattingStaticMesh::GetTextureSize(NumPoints);
+		TestTrue(FString::Printf(TEXT("Power of two width for %d points"), NumPoints), FMath::IsPowerOfTwo(TextureSize.X));
+		TestTrue(FString::Printf(TEXT("Every texel fits for %d points"), NumPoints), (int64)TextureSize.X * TextureSize.Y >= NumPoints);
+		TestTrue(FString::Printf(TEXT("No empty row for %d points"), NumPoints), (int64)TextureSize.X * (TextureSize.Y - 1) < NumPoints);
+		TestTrue(FString::Printf(TEXT("No wider than high for %d points"), NumPoints), TextureSize.X >= TextureSize.Y);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGaussianSplattingStaticMeshChunksTest, "GaussianSplatting.StaticMesh.Chunks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGaussianSplattingStaticMeshChunksTest::RunTest(const FString& Parameters)
+{
+	// Clusters spread over the octree, and coincident points the octree cannot split before its maximum depth.
+	const int32 MaxPointsPerChunk = 1000;
+	const FVector3f CoincidentPosition(100000.0f, 0.0f, 0.0f);
+	TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(8000);
+	for (int32 i = 0; i < 2500; i++) {
+		FGaussianSplattingPoint& Point = Points.Add_GetRef(Points[i]);
+		Point.Position = CoincidentPosition;
+	}
+	FBox Bounds(ForceInit);
+	for (const FGaussianSplattingPoint& Point : Points) {
+		Bounds += FVector(Point.Position);
+	}
+	UGaussianSplattingPointCloud* PointCloud = NewObject<UGaussianSplattingPointCloud>(GetTransientPackage());
+	PointCloud->SetPoints(Points);
+
+	const TArray<FGaussianSplattingStaticMeshChunk> Chunks = UGaussianSplattingEditorLibrary::CreateChunkedStaticMeshesFromPointCloud(
+		PointCloud, TEXT("/Temp/GaussianSplattingTests/StaticMeshChunks"), TEXT("SM_Chunk"), MaxPointsPerChunk);
+	TestTrue(TEXT("Chunk count"), Chunks.Num() >= FMath::DivideAndRoundUp(Points.Num(), MaxPointsPerChunk));
+
+	int32 NumPoints = 0;
+	int32 NumCoincidentChunks = 0;
+	FBox ChunkBounds(ForceInit);
+	for (const FGaussianSplattingStaticMeshChunk& Chunk : Chunks) {
+		if (Chunk.StaticMesh == nullptr) {
+			AddError(TEXT("Chunk without a static mesh"));
+			continue;
+		}
+		const FString ChunkName = Chunk.StaticMesh->GetName();
+		NumPoints += Chunk.NumPoints;
+		TestTrue(FString::Printf(TEXT("Points of %s within the budget"), *ChunkName), Chunk.NumPoints > 0 && Chunk.NumPoints <= MaxPointsPerChunk);
+		TestEqual(FString::Printf(TEXT("Texture size of %s"), *ChunkName), Chunk.TextureSize, GaussianSplattingStaticMesh::GetTextureSize(Chunk.NumPoints));
+
+		// The vertices are relative to the chunk location, only the quads around the points reach past their bounds.
+		const FBox MeshBounds = Chunk.StaticMesh->GetBoundingBox().ShiftBy(Chunk.Location);
+		TestTrue(FString::Printf(TEXT("Mesh bounds of %s"), *ChunkName), MeshBounds.Min.Equals(Chunk.Bounds.Min, 1.0) && MeshBounds.Max.Equals(Chunk.Bounds.Max, 1.0));
+		if (Chunk.Bounds.GetExtent().IsNearlyZero(0.01) && Chunk.Bounds.GetCenter().Equals(FVector(CoincidentPosition), 0.01)) {
+			NumCoincidentChunks++;
+		}
+		ChunkBounds += Chunk.Bounds;
+	}
+	TestEqual(TEXT("Every point in a chunk"), NumPoints, Points.Num());
+	TestEqual(TEXT("Coincident points sliced"), NumCoincidentChunks, FMath::DivideAndRoundUp(2500, MaxPointsPerChunk));
+	TestTrue(TEXT("Chunks cover the cloud"), ChunkBounds.Min.Equals(Bounds.Min, 0.1) && ChunkBounds.Max.Equals(Bounds.Max, 0.1));
+	return true;
+}
+
+#endif
@@ -4,8 +4,24 @@
 #include "Engine/Texture2D.h"
 #include "NiagaraSystem.h"
 #include "GaussianSplattingPointCloudDataInterface.h"
+#include "GaussianSplattingSequence.h"
 #include "GaussianSplattingEditorLibrary.generated.h"
 
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+/** How a repartition resolves the splats of neighboring clouds that overlap, such as HLOD clusters captured with padding. */
+UENUM(BlueprintType)
+enum class EGaussianSplattingOverlapMode : uint8
+{
+	/** Overlapping splats are all kept and drawn twice. */
+	Keep,
+	/** Every small cell of the overlap keeps the splats of the cloud whose center is the nearest. */
+	Ownership,
+	/** Splats are only dropped when the nearer cloud has a splat of similar color and size close to them. */
+	Similarity,
+};
+
 USTRUCT(BlueprintType)
 struct FGaussianSplattingPointCloudMetaInfo
 {
@@ -51,6 +67,265 @@ public:
 	int32 CellSize = 25600;
 };
 
+USTRUCT(BlueprintType)
+struct FGaussianSplattingSequenceImportSettings
+{
+	GENERATED_BODY()
+public:
+	/** Frames per second of the sequence, frame i is played at i / FrameRate seconds. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 1))
+	float FrameRate = 30.0f;
+
+	/** Largest distance between a fitted splat center and its source frames, in centimeters. Longer motions are split into more segments. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 0))
+	float PositionTolerance = 1.0f;
+
+	/** Frames where a splat is fainter than this are treated as gaps in its trajectory. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 0, ClampMax = 1))
+	float MinOpacity = 1.0f / 255.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FGaussianSplattingSequenceImportReport
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumFrames = 0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumSplats = 0;
+
+	/** Points in the imported cloud, one per fitted segment. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumPoints = 0;
+
+	/** Seconds covered by the frames, to be used as the clip duration of the playback. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float Duration = 0.0f;
+
+	/** Points of all source frames divided by the points of the imported cloud. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float CompressionRatio = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float RMSPositionError = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float MaxPositionError = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float RMSOpacityError = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float Seconds = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FGaussianSplattingSimplifySettings
+{
+	GENERATED_BODY()
+public:
+	/** Largest number of splats kept, 0 means no cap. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 0))
+	int32 TargetPointCount = 0;
+
+	/** Fraction of the total contribution, opacity times projected area over the views, that may be removed on top of the cap. 0 disables it. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 0, ClampMax = 1))
+	float MaxContributionLoss = 0.01f;
+
+	/** Camera positions in the space of the points. Empty places NumViews cameras around the bounds of the cloud. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting")
+	TArray<FVector> ViewLocations;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 1))
+	int32 NumViews = 32;
+
+	/** Ranks the splats by their summed blending weight over the capture views instead of the sample views when the source was scored. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting")
+	bool bUseCaptureScores = true;
+};
+
+USTRUCT(BlueprintType)
+struct FGaussianSplattingSimplifyReport
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumSourcePoints = 0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumPoints = 0;
+
+	/** Removed contribution divided by the total contribution of the source. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float ContributionLoss = 0.0f;
+
+	/** Largest contribution of a removed splat, relative to the mean contribution of the source. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float MaxRemovedContribution = 0.0f;
+
+	/** Contribution weighted distance from the removed splats to the nearest kept one, in the units of the points. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float RMSRemovedDistance = 0.0f;
+
+	/** Removed splats without any kept splat within three typical splat sizes. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumUncovered = 0;
+
+	/** Mean PSNR in decibels of software renders of the result against the source, from up to eight of the views. Capped at 100. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float PSNR = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float Seconds = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FGaussianSplattingCaptureScoreReport
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumViews = 0;
+
+	/** Splats that never reached a blending weight of 1/255 in any capture view. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumUnseen = 0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	float Seconds = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FGaussianSplattingPartitionCellInfo
+{
+	GENERATED_BODY()
+public:
+	/** Name of the point cloud asset of the cell. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	FString Name;
+
+	/** World location of the actor, the points of the cell are relative to it. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	FVector Location = FVector::ZeroVector;
+
+	/** World bounds of the splat centers of the cell. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	FBox Bounds = FBox(ForceInit);
+
+	/** Octree depth of adaptive cells, 0 for the cells of a fixed grid. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 Depth = 0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumPoints = 0;
+
+	/** Video memory of the points once the cell is streamed in. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int64 NumBytes = 0;
+};
+
+/** Throughput of ImportPointClouds, the points per second of a stage count the time spent in it summed over all clouds. */
+USTRUCT(BlueprintType)
+struct FGaussianSplattingImportReport
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumFiles = 0;
+
+	/** Clouds imported or left unchanged, files without points are skipped. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumClouds = 0;
+
+	/** Clouds whose file contents and import settings match the last import, they are neither converted nor saved again. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumUnchanged = 0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int64 NumPoints = 0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	double ReadPointsPerSecond = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	double ReadMegabytesPerSecond = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	double DecodePointsPerSecond = 0.0;
+
+	/** Sorting the points and building the chunk hierarchy and the levels of detail. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	double SortPointsPerSecond = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	double CompressPointsPerSecond = 0.0;
+
+	/** Writing the packages of all clouds, whose payloads are already compressed. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	double SavePointsPerSecond = 0.0;
+
+	/** Points over the wall clock time of the overlapped stages, at most the slowest stage times the overlap. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	double PipelinePointsPerSecond = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	double PeakInFlightMegabytes = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	double Seconds = 0.0;
+};
+
+/** Static mesh of one spatial chunk of a cloud, its vertices are relative to Location. */
+USTRUCT(BlueprintType)
+struct FGaussianSplattingStaticMeshChunk
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	TObjectPtr<UStaticMesh> StaticMesh = nullptr;
+
+	/** Center of the octree cell of the chunk, where its actor is placed. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	FVector Location = FVector::ZeroVector;
+
+	/** World bounds of the splat centers of the chunk. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	FBox Bounds = FBox(ForceInit);
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumPoints = 0;
+
+	/** Size of the attribute textures of the chunk. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	FIntPoint TextureSize = FIntPoint::ZeroValue;
+};
+
+/** Cells written by a repartition, saved as <PartitionBaseName>_Manifest.json next to the cell assets. */
+USTRUCT(BlueprintType)
+struct FGaussianSplattingPartitionManifest
+{
+	GENERATED_BODY()
+public:
+	/** Point budget of adaptive cells, 0 for a fixed grid. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 MaxPointsPerCell = 0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int64 MaxBytesPerCell = 0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumPoints = 0;
+
+	/** Splats dropped where the source clouds overlapped. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	int32 NumOverlapsRemoved = 0;
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Gaussian Splatting")
+	TArray<FGaussianSplattingPartitionCellInfo> Cells;
+};
+
 UCLASS()
 class GAUSSIANSPLATTINGEDITOR_API UGaussianSplattingEditorLibrary : public UBlueprintFunctionLibrary
 {
@@ -59,14 +334,69 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
 	static UGaussianSplattingPointCloud* LoadSplatPly(FString FileName, UObject* Outer, FName AssetName = NAME_None);
 
+	/**
+	 * Imports a directory of per-frame PLY files, whose splats correspond by index, as a single 4D cloud. The trajectory
+	 * and opacity of every splat are fitted with the quadratic motion and temporal visibility of the runtime.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	static UGaussianSplattingPointCloud* LoadSplatPlySequence(FString Directory, UObject* Outer, FName AssetName, const FGaussianSplattingSequenceImportSettings& Settings, FGaussianSplattingSequenceImportReport& OutReport);
+
+	/**
+	 * Imports a directory of per-frame PLY files as a sequence played frame by frame, for captures whose splats do not
+	 * follow smooth trajectories. Splats of consecutive frames correspond by index.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	static UGaussianSplattingSequence* LoadSplatPlySequenceAsFrames(FString Directory, UObject* Outer, FName AssetName, float FrameRate = 30.0f, int32 KeyframeInterval = 30);
+
+	/**
+	 * Writes a copy of Source with fewer splats into a new asset, keeping the splats contributing the most to the sample views,
+	 * or to the capture views when Source was scored. Source is left untouched.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	static UGaussianSplattingPointCloud* SimplifyPointCloud(UGaussianSplattingPointCloud* Source, UObject* Outer, FName AssetName, const FGaussianSplattingSimplifySettings& Settings, FGaussianSplattingSimplifyReport& OutReport);
+
+	/**
+	 * Renders the cloud from the registered cameras of the COLMAP model in WorkDir/sparse/0 and stores the largest and summed
+	 * blending weight of every splat on it, for simplification and the levels of detail. Images are scored at MaxResolution
+	 * at most, MaxViews above 0 scores only that many cameras spread over the capture.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	static bool ScorePointCloudFromCapture(UGaussianSplattingPointCloud* PointCloud, FString WorkDir, FGaussianSplattingCaptureScoreReport& OutReport, int32 MaxResolution = 1600, int32 MaxViews = 0);
+
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
 	static UNiagaraSystem* CreateNiagaraSystemFromPointCloud(UGaussianSplattingPointCloud* PointCloud, UObject* Outer, FName AssetName = NAME_None, UNiagaraSystem* Template = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
 	static void SetupPointCloudToNiagaraComponent(UGaussianSplattingPointCloud* PointCloud, UNiagaraComponent* NiagaraComponent, UNiagaraSystem* NiagaraSystem = nullptr);
 
+	/**
+	 * Bakes the cloud into a static mesh with one quad per splat and attribute textures the material reads. The mesh is built
+	 * from a mesh description by default, so it can be saved and rebuilt. bBuildRenderDataDirectly fills the vertex and index
+	 * buffers in parallel instead, skipping the mesh build, which takes seconds instead of minutes for millions of splats. In
+	 * a transient Outer the mesh description is skipped too, otherwise it is kept to rebuild the render data when the mesh is
+	 * loaded or cooked. Clouds whose attribute textures exceed the texture limit return null, see CreateChunkedStaticMeshesFromPointCloud.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	static UStaticMesh* CreateStaticMeshFromPointCloud(UGaussianSplattingPointCloud* PointCloud, UObject* Outer, FName AssetName = NAME_None, bool bBuildRenderDataDirectly = false);
+
+	/**
+	 * Draws the cloud with one shared quad instanced once per splat: the instance transform places and sizes the quad, two
+	 * custom data floats hold the texel of the splat in the attribute textures, which the PerInstanceTexel switch of the
+	 * material reads instead of the vertex color. Only the quad is built, and the instances take less than half the memory of
+	 * the quads of CreateStaticMeshFromPointCloud. The quad, its material and the textures are created in the component.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	static void SetupPointCloudToInstancedStaticMeshComponent(UGaussianSplattingPointCloud* PointCloud, UInstancedStaticMeshComponent* Component);
+
+	/**
+	 * Splits the cloud into the cells of an octree holding at most MaxPointsPerChunk points each and bakes every cell into its
+	 * own static mesh asset in SaveContentDir, named after its octant path, with attribute textures sized for its points only.
+	 * The budget is capped so no texture exceeds the texture size limit. The mesh descriptions and textures of the chunks are
+	 * filled in parallel and the meshes built as one batch. Every chunk has its own bounds, so it is culled on its own, and
+	 * with a World the chunks are placed as static mesh actors, which World Partition streams by cell.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
-	static UStaticMesh* CreateStaticMeshFromPointCloud(UGaussianSplattingPointCloud* PointCloud, UObject* Outer, FName AssetName = NAME_None);
+	static TArray<FGaussianSplattingStaticMeshChunk> CreateChunkedStaticMeshesFromPointCloud(UGaussianSplattingPointCloud* PointCloud, FString SaveContentDir, FString BaseName = "SM_Chunk", int32 MaxPointsPerChunk = 1048576, UWorld* World = nullptr);
 
 	static UTexture2D* CreateFloat16TextureFromData(UObject* Outer, FString Name, uint32 Width, uint32 Height, TArray<FFloat16> Data);
 
@@ -82,21 +412,58 @@ public:
 
 	static FVector UVtoOctahedron(FVector2D uv);
 
+	/**
+	 * Imports every trained PLY under SearchDir into SaveContentDir with an actor each, keeping at most MaxInFlightMegabytes
+	 * of clouds in memory. Unless bForceReimport is set, clouds whose file and settings did not change are skipped.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
-	static void ImportPointClouds(
+	static FGaussianSplattingImportReport ImportPointClouds(
 		UWorld* World,
 		FString SearchDir,
 		FString SaveContentDir,
 		UNiagaraSystem* TemplateSystem = nullptr,
-		bool bUseStandaloneNiagraSystem = false
+		bool bUseStandaloneNiagraSystem = false,
+		int32 MaxInFlightMegabytes = 8192,
+		bool bForceReimport = false
 	);
 
+	/**
+	 * Repartitions the point clouds of the world into a grid of CellSize. Where the clouds overlap, their duplicated splats are
+	 * resolved by OverlapMode over cells of OverlapCellSize before binning. Returns the manifest written next to the cells.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
-	static void RepartitionPointClouds(
+	static FGaussianSplattingPartitionManifest RepartitionPointClouds(
 		UWorld* World,
 		FString PartitionBaseName = "Cell",
 		int32 CellSize = 51200,
 		UNiagaraSystem* TemplateSystem = nullptr,
-		bool bUseStandaloneNiagraSystem = false
+		bool bUseStandaloneNiagraSystem = false,
+		EGaussianSplattingOverlapMode OverlapMode = EGaussianSplattingOverlapMode::Ownership,
+		float OverlapCellSize = 20.0f
+	);
+
+	/**
+	 * Repartitions the point clouds of the world into the cells of an octree over all of them, split in 3D until every cell
+	 * holds at most MaxPointsPerCell splats and, when above 0, MaxMegabytesPerCell of video memory. Dense areas get small cells
+	 * and open areas large ones, so streaming and rendering cost stay even across cells. Spawns one actor per cell and writes
+	 * the manifest of the cells next to their assets. Overlapping clouds are resolved like RepartitionPointClouds does.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	static FGaussianSplattingPartitionManifest RepartitionPointCloudsAdaptive(
+		UWorld* World,
+		FString PartitionBaseName = "Cell",
+		int32 MaxPointsPerCell = 1000000,
+		int32 MaxMegabytesPerCell = 0,
+		int32 MaxDepth = 8,
+		UNiagaraSystem* TemplateSystem = nullptr,
+		bool bUseStandaloneNiagraSystem = false,
+		EGaussianSplattingOverlapMode OverlapMode = EGaussianSplattingOverlapMode::Ownership,
+		float OverlapCellSize = 20.0f
 	);
+
+	/**
+	 * Re-encodes the payloads of existing point cloud assets with Method and saves their packages as one batch. Every cloud is
+	 * loaded and encoded on the game thread, its segments and levels in parallel. Returns the number of packages saved.
+	 */
+	static int32 CompressPointClouds(TConstArrayView<UGaussianSplattingPointCloud*> PointClouds, EGaussianSplattingCompressionMethod Method);
 };
@@ -13,5 +13,7 @@ public:
 private:
 	void RegisterMenus();
 	void CreateStaticMesh(UGaussianSplattingPointCloud* PointCloud);
+	void PreviewStaticMesh(UGaussianSplattingPointCloud* PointCloud);
 	void CreateNiagara(UGaussianSplattingPointCloud* PointCloud);
+	void SimplifyPointCloud(UGaussianSplattingPointCloud* PointCloud);
 };
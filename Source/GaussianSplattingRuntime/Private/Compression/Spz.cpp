@@ -558,7 +558,7 @@ namespace Spz {
 	}
 
 
-	bool compress(const TArray<FGaussianSplattingPoint> g, int compressionLevel,
+	bool compress(const TArray<FGaussianSplattingPoint>& g, int compressionLevel,
 		int workers, std::vector<uint8_t>& output) {
 		if (g.Num() == 0) {
 			SpzLog("[SPZ: ERROR] Parsed TArray<FGaussianSplattingPoint> is empty.");
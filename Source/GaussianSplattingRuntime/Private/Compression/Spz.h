@@ -53,8 +53,11 @@ using Half = uint16_t;
 float halfToFloat(Half h);
 Half floatToHalf(float f);
 
+// Quantizes the gaussians to their packed representation, without compressing it.
+PackedGaussians packGaussians(const TArray<FGaussianSplattingPoint>& g);
+
 GAUSSIANSPLATTINGRUNTIME_API bool compress(
-	const TArray<FGaussianSplattingPoint> g,
+	const TArray<FGaussianSplattingPoint>& g,
 	int compressionLevel,
 	int workers,
 	std::vector<uint8_t>& output);
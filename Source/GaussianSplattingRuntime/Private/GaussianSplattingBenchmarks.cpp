@@ -0,0 +1,669 @@
+#include "GaussianSplattingBenchmarks.h"
+#include "GaussianSplattingPointCloud.h"
+#include "GaussianSplattingChunkHierarchy.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "ConvexVolume.h"
+#include "GaussianSplattingSorter.h"
+#include "GaussianSplattingSequence.h"
+#include "GaussianSplattingLOD.h"
+#include "GaussianSplattingSoftwareRenderer.h"
+#include "Algo/Accumulate.h"
+#include "GaussianSplattingBinning.h"
+#include <algorithm>
+
+TArray<FGaussianSplattingPoint> GaussianSplattingBenchmarks::MakeBenchmarkPoints(int32 NumPoints)
+{
+	FRandomStream Random(NumPoints);
+	TArray<FGaussianSplattingPoint> Points;
+	Points.SetNum(NumPoints);
+	FVector3f Center = FVector3f::ZeroVector;
+	for (int32 i = 0; i < NumPoints; i++) {
+		if (i % 4096 == 0) {
+			Center = FVector3f(Random.VRand()) * Random.FRandRange(0.0f, 50000.0f);
+		}
+		FGaussianSplattingPoint& Point = Points[i];
+		Point.Position = Center + FVector3f(Random.VRand()) * Random.FRandRange(0.0f, 500.0f);
+		Point.Scale = FVector3f(Random.FRandRange(0.1f, 10.0f));
+		Point.Color = FLinearColor(Random.FRand(), Random.FRand(), Random.FRand(), 1.0f);
+	}
+	return Points;
+}
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkChunkHierarchy(
+	TEXT("GaussianSplatting.Benchmark.ChunkHierarchy"),
+	TEXT("Builds the chunk hierarchy of a synthetic cloud and logs the timings. Arguments: [NumPoints=10000000] [ChunkSize=2048]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000000;
+		const int32 ChunkSize = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : FGaussianSplattingChunkHierarchy::DefaultChunkSize;
+		const TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints);
+		const TArray<int32> SegmentEnds = { NumPoints / 20, NumPoints / 5, NumPoints };
+
+		FGaussianSplattingChunkHierarchy Hierarchy;
+		const double BuildStart = FPlatformTime::Seconds();
+		Hierarchy.Build(Points, SegmentEnds, ChunkSize);
+		const double BuildTime = FPlatformTime::Seconds() - BuildStart;
+
+		const FBox3f Bounds = Hierarchy.GetBounds(SegmentEnds.Num());
+		const FBox3f QueryBox = FBox3f::BuildAABB(Bounds.GetCenter(), Bounds.GetExtent() * 0.25f);
+		TArray<int32> QueryChunks;
+		const double QueryStart = FPlatformTime::Seconds();
+		Hierarchy.QueryBox(QueryBox, SegmentEnds.Num(), QueryChunks);
+		const double QueryTime = FPlatformTime::Seconds() - QueryStart;
+
+		UE_LOG(LogTemp, Log, TEXT("ChunkHierarchy: %d points, %d chunks, %d nodes, build %.1f ms, box query %.3f ms (%d chunks)"),
+			NumPoints, Hierarchy.GetNumChunks(), Hierarchy.GetNodes().Num(), BuildTime * 1000.0, QueryTime * 1000.0, QueryChunks.Num());
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkCulling(
+	TEXT("GaussianSplatting.Benchmark.Culling"),
+	TEXT("Culls the chunks of a synthetic cloud against a synthetic frustum, checks that no point inside the frustum was culled and logs the timings. Arguments: [NumPoints=10000000] [FOVDegrees=90]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000000;
+		const float FOV = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 90.0f;
+		const TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints);
+		const TArray<int32> SegmentEnds = { NumPoints / 20, NumPoints / 5, NumPoints };
+		FGaussianSplattingChunkHierarchy Hierarchy;
+		Hierarchy.Build(Points, SegmentEnds);
+
+		// A camera at the origin looking down +X, in the UE view convention.
+		const FMatrix ViewMatrix = FInverseRotationMatrix(FRotator::ZeroRotator) * FMatrix(FPlane(0, 0, 1, 0), FPlane(1, 0, 0, 0), FPlane(0, 1, 0, 0), FPlane(0, 0, 0, 1));
+		const FMatrix ProjectionMatrix = FReversedZPerspectiveMatrix(FMath::DegreesToRadians(FOV) * 0.5f, 16.0f, 9.0f, 10.0f);
+		TArray<FConvexVolume> Frustums;
+		GetViewFrustumBounds(Frustums.AddDefaulted_GetRef(), ViewMatrix * ProjectionMatrix, false);
+
+		TArray<int32> VisibleChunks;
+		const double CullStart = FPlatformTime::Seconds();
+		Hierarchy.Cull(Frustums, FVector3f::ZeroVector, 0.0f, SegmentEnds.Num(), VisibleChunks);
+		TArray<FUintVector4> VisibleRanges;
+		const int32 VisiblePoints = Hierarchy.BuildVisibleRanges(VisibleChunks, VisibleRanges);
+		const double CullTime = FPlatformTime::Seconds() - CullStart;
+
+		TBitArray<> ChunkVisible(false, Hierarchy.GetNumChunks());
+		for (int32 ChunkIndex : VisibleChunks) {
+			ChunkVisible[ChunkIndex] = true;
+		}
+		int32 PointsInside = 0;
+		int32 MissedPoints = 0;
+		for (int32 ChunkIndex = 0; ChunkIndex < Hierarchy.GetNumChunks(); ChunkIndex++) {
+			for (uint32 PointIndex : Hierarchy.GetChunkPointIndices(ChunkIndex)) {
+				if (Frustums[0].IntersectPoint(FVector(Points[PointIndex].Position))) {
+					PointsInside++;
+					MissedPoints += ChunkVisible[ChunkIndex] ? 0 : 1;
+				}
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Culling: %d/%d chunks visible, %d ranges, %d/%d points exposed (%d inside the frustum, %d missed), cull %.3f ms"),
+			VisibleChunks.Num(), Hierarchy.GetNumChunks(), VisibleRanges.Num(), VisiblePoints, NumPoints, PointsInside, MissedPoints, CullTime * 1000.0);
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkSortedOrders(
+	TEXT("GaussianSplatting.Benchmark.SortedOrders"),
+	TEXT("Bakes presorted chunk orders for a synthetic cloud and measures their ordering error against an exact per-view sort. Arguments: [NumPoints=1000000] [NumSortDirections=26] [NumViews=16]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000000;
+		const int32 NumSortDirections = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : FGaussianSplattingChunkHierarchy::DefaultNumSortDirections;
+		const int32 NumViews = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 16;
+		const TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints);
+		const TArray<int32> SegmentEnds = { NumPoints };
+
+		FGaussianSplattingChunkHierarchy Hierarchy;
+		const double BakeStart = FPlatformTime::Seconds();
+		Hierarchy.Build(Points, SegmentEnds, FGaussianSplattingChunkHierarchy::DefaultChunkSize, NumSortDirections);
+		const double BakeTime = FPlatformTime::Seconds() - BakeStart;
+
+		// Errors are measured per chunk: the share of adjacent pairs drawn front to back, and the mean distance between the
+		// drawn position and the exact back-to-front rank, relative to the chunk size.
+		FRandomStream Random(NumViews);
+		const FBox3f Bounds = Hierarchy.GetBounds(SegmentEnds.Num());
+		double Inversions[2] = { 0.0, 0.0 };
+		double Displacement[2] = { 0.0, 0.0 };
+		int64 NumPairs = 0;
+		int64 NumSamples = 0;
+		TArray<FUintVector4> Ranges;
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ViewIndex++) {
+			const FVector3f ViewOrigin = Bounds.GetCenter() + FVector3f(Random.VRand()) * Bounds.GetExtent().GetMax() * Random.FRandRange(0.5f, 2.0f);
+			TArray<int32> AllChunks;
+			for (int32 ChunkIndex = 0; ChunkIndex < Hierarchy.GetNumChunks(); ChunkIndex++) {
+				AllChunks.Add(ChunkIndex);
+			}
+			Hierarchy.BuildSortedRanges(AllChunks, ViewOrigin, Ranges);
+
+			for (const FUintVector4& Range : Ranges) {
+				TArray<uint32> Drawn[2];
+				for (uint32 Offset = 0; Offset < Range.Z; Offset++) {
+					Drawn[0].Add(Hierarchy.MapVisibleIndex(MakeArrayView(&Range, 1), Range.X + Offset));
+					Drawn[1].Add(Hierarchy.GetPointIndices()[Range.Y + Offset]);
+				}
+				TArray<uint32> Exact = Drawn[1];
+				Algo::Sort(Exact, [&](uint32 A, uint32 B) {
+					return FVector3f::DistSquared(Points[A].Position, ViewOrigin) > FVector3f::DistSquared(Points[B].Position, ViewOrigin);
+				});
+				TMap<uint32, int32> ExactRank;
+				for (int32 Rank = 0; Rank < Exact.Num(); Rank++) {
+					ExactRank.Add(Exact[Rank], Rank);
+				}
+				for (int32 Variant = 0; Variant < 2; Variant++) {
+					for (int32 i = 0; i < Drawn[Variant].Num(); i++) {
+						Displacement[Variant] += FMath::Abs(ExactRank[Drawn[Variant][i]] - i) / (double)Range.Z;
+						if (i > 0 && FVector3f::DistSquared(Points[Drawn[Variant][i]].Position, ViewOrigin) > FVector3f::DistSquared(Points[Drawn[Variant][i - 1]].Position, ViewOrigin)) {
+							Inversions[Variant] += 1.0;
+						}
+					}
+				}
+				NumPairs += FMath::Max<int64>(Range.Z - 1, 0);
+				NumSamples += Range.Z;
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("SortedOrders: %d points, %d directions, bake %.1f ms, %.2f MB of orders"),
+			NumPoints, Hierarchy.GetNumSortDirections(), BakeTime * 1000.0, Hierarchy.GetSortedOrders().Num() * sizeof(uint16) / (1024.0 * 1024.0));
+		UE_LOG(LogTemp, Log, TEXT("SortedOrders: presorted %.2f%% inverted pairs, %.4f mean rank error; unsorted %.2f%% inverted pairs, %.4f mean rank error"),
+			100.0 * Inversions[0] / FMath::Max<int64>(NumPairs, 1), Displacement[0] / FMath::Max<int64>(NumSamples, 1),
+			100.0 * Inversions[1] / FMath::Max<int64>(NumPairs, 1), Displacement[1] / FMath::Max<int64>(NumSamples, 1));
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkSort(
+	TEXT("GaussianSplatting.Benchmark.Sort"),
+	TEXT("Compares the parallel radix sort and the incremental depth sorter against std::sort on 1M, 5M and 10M keys, or on the given counts."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		TArray<int32> Counts = { 1000000, 5000000, 10000000 };
+		if (!Args.IsEmpty()) {
+			Counts.Reset();
+			for (const FString& Arg : Args) {
+				Counts.Add(FCString::Atoi(*Arg));
+			}
+		}
+		for (int32 Count : Counts) {
+			FRandomStream Random(Count);
+			TArray<float> Depths;
+			Depths.SetNumUninitialized(Count);
+			for (float& Depth : Depths) {
+				Depth = Random.FRandRange(-100000.0f, 100000.0f);
+			}
+
+			// Reference: indices by descending depth, ties by index, which is what the stable radix sort produces.
+			std::vector<uint32> Reference(Count);
+			for (int32 i = 0; i < Count; i++) {
+				Reference[i] = i;
+			}
+			const double StdStart = FPlatformTime::Seconds();
+			std::sort(Reference.begin(), Reference.end(), [&Depths](uint32 A, uint32 B) {
+				return Depths[A] > Depths[B] || (Depths[A] == Depths[B] && A < B);
+			});
+			const double StdTime = FPlatformTime::Seconds() - StdStart;
+
+			FGaussianSplattingDepthSorter Sorter;
+			const double RadixStart = FPlatformTime::Seconds();
+			Sorter.Sort(Depths, false);
+			const double RadixTime = FPlatformTime::Seconds() - RadixStart;
+			const bool bRadixMatches = FMemory::Memcmp(Sorter.GetOrder().GetData(), Reference.data(), Count * sizeof(uint32)) == 0;
+
+			// A small camera move: every depth drifts a little, which only swaps close neighbours.
+			for (float& Depth : Depths) {
+				Depth += Random.FRandRange(-1.0f, 1.0f);
+			}
+			std::sort(Reference.begin(), Reference.end(), [&Depths](uint32 A, uint32 B) {
+				return Depths[A] > Depths[B] || (Depths[A] == Depths[B] && A < B);
+			});
+			const double RepairStart = FPlatformTime::Seconds();
+			Sorter.Sort(Depths);
+			const double RepairTime = FPlatformTime::Seconds() - RepairStart;
+			const bool bRepairMatches = FMemory::Memcmp(Sorter.GetOrder().GetData(), Reference.data(), Count * sizeof(uint32)) == 0;
+
+			UE_LOG(LogTemp, Log, TEXT("Sort: %d keys, std::sort %.1f ms, radix %.1f ms (%.1f Mkeys/s, %s), %s %.1f ms (%s)"),
+				Count, StdTime * 1000.0, RadixTime * 1000.0, Count / FMath::Max(RadixTime, UE_SMALL_NUMBER) / 1e6, bRadixMatches ? TEXT("matches") : TEXT("MISMATCH"),
+				Sorter.WasIncremental() ? TEXT("repair") : TEXT("full resort"), RepairTime * 1000.0, bRepairMatches ? TEXT("matches") : TEXT("MISMATCH"));
+		}
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkTemporalIndex(
+	TEXT("GaussianSplatting.Benchmark.TemporalIndex"),
+	TEXT("Builds the temporal index of a synthetic 4D cloud and logs how many chunks and points stay active over the sequence, and how tight the swept bounds are. Arguments: [NumPoints=10000000] [SplatDuration=0.05] [Speed=20]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000000;
+		const float SplatDuration = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 0.05f;
+		const float Speed = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 20.0f;
+		TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints);
+		FRandomStream Random(NumPoints);
+		for (FGaussianSplattingPoint& Point : Points) {
+			const FVector3f Velocity = FVector3f(Random.GetUnitVector()) * Speed;
+			Point.Time = FVector4f(Random.FRandRange(0.0f, 5.0f), FMath::Loge(SplatDuration), Velocity.X, Velocity.Y);
+			Point.Motion = FVector4f(Velocity.Z, 0.0f, 0.0f, -0.1f * Speed);
+		}
+		const TArray<int32> SegmentEnds = { NumPoints };
+		FGaussianSplattingChunkHierarchy Hierarchy;
+		const double BuildStart = FPlatformTime::Seconds();
+		Hierarchy.Build(Points, SegmentEnds);
+		const double BuildTime = FPlatformTime::Seconds() - BuildStart;
+
+		const FBox3f ClipBounds = Hierarchy.GetBounds(SegmentEnds.Num());
+		double SlabBoundsVolume = 0.0;
+		int64 ActivePoints = 0;
+		int64 CandidateChunks = 0;
+		double CullTime = 0.0;
+		const int32 NumSamples = 50;
+		TArray<int32> VisibleChunks;
+		for (int32 Sample = 0; Sample < NumSamples; Sample++) {
+			const float Time = 5.0f * Sample / NumSamples;
+			const FVector2f TimeRange(Time, Time);
+			const double CullStart = FPlatformTime::Seconds();
+			Hierarchy.Cull({}, FVector3f::ZeroVector, 0.0f, SegmentEnds.Num(), VisibleChunks, MakeArrayView(&TimeRange, 1));
+			CullTime += FPlatformTime::Seconds() - CullStart;
+			CandidateChunks += Hierarchy.GetActiveChunkCandidates(Time).Num();
+			SlabBoundsVolume += Hierarchy.GetBounds(SegmentEnds.Num(), MakeArrayView(&TimeRange, 1)).GetVolume();
+			for (int32 ChunkIndex : VisibleChunks) {
+				ActivePoints += Hierarchy.GetChunks()[ChunkIndex].NumPoints;
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("TemporalIndex: %d points, %d chunks, build %.1f ms, on average %.1f candidate chunks and %.1f%% of the points exposed, cull %.3f ms, slab bounds %.1f%% of the clip bounds volume"),
+			NumPoints, Hierarchy.GetNumChunks(), BuildTime * 1000.0, (double)CandidateChunks / NumSamples, 100.0 * ActivePoints / NumSamples / FMath::Max(NumPoints, 1), CullTime * 1000.0 / NumSamples,
+			100.0 * SlabBoundsVolume / NumSamples / FMath::Max((double)ClipBounds.GetVolume(), UE_DOUBLE_SMALL_NUMBER));
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkSequenceDecode(
+	TEXT("GaussianSplatting.Benchmark.SequenceDecode"),
+	TEXT("Encodes a synthetic sequence of moving splats with some churn, decodes it back, checks the decoded positions and logs the decode timings against the 30 fps frame budget. Arguments: [NumPoints=500000] [NumFrames=60] [KeyframeInterval=30] [ChurnPercent=1]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 500000;
+		const int32 NumFrames = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 60;
+		const int32 KeyframeInterval = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 30;
+		const float ChurnPercent = Args.Num() > 3 ? FCString::Atof(*Args[3]) : 1.0f;
+		const double FrameBudget = 1.0 / 30.0;
+
+		// Every splat drifts at its own velocity, a few splats are replaced by new ones each frame. New splats are appended,
+		// which is where the decoder puts added splats, so the decoded frames can be compared with the source index by index.
+		FRandomStream Random(NumPoints);
+		TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints);
+		TArray<FVector3f> Velocities;
+		TArray<uint32> Ids;
+		for (int32 i = 0; i < NumPoints; i++) {
+			Velocities.Add(FVector3f(Random.GetUnitVector()) * Random.FRandRange(0.0f, 5.0f));
+			Ids.Add(i);
+		}
+		uint32 NextId = NumPoints;
+		const int32 NumChurned = FMath::RoundToInt32(NumPoints * ChurnPercent / 100.0f);
+
+		UGaussianSplattingSequence* Sequence = NewObject<UGaussianSplattingSequence>();
+		Sequence->SetKeyframeInterval(KeyframeInterval);
+		FGaussianSplattingSequenceBuilder Builder(Sequence);
+		TArray<TArray<FVector3f>> SourcePositions;
+		const double EncodeStart = FPlatformTime::Seconds();
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++) {
+			if (FrameIndex > 0) {
+				for (int32 i = 0; i < Points.Num(); i++) {
+					Points[i].Position += Velocities[i];
+				}
+				TBitArray<> Removed(false, Points.Num());
+				for (int32 Churn = 0; Churn < NumChurned && Points.Num() > 0; Churn++) {
+					Removed[Random.RandHelper(Points.Num())] = true;
+				}
+				int32 WriteIndex = 0;
+				for (int32 i = 0; i < Points.Num(); i++) {
+					if (!Removed[i]) {
+						Points[WriteIndex] = Points[i];
+						Velocities[WriteIndex] = Velocities[i];
+						Ids[WriteIndex] = Ids[i];
+						WriteIndex++;
+					}
+				}
+				Points.SetNum(WriteIndex);
+				Velocities.SetNum(WriteIndex);
+				Ids.SetNum(WriteIndex);
+				const TArray<FGaussianSplattingPoint> NewPoints = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumChurned);
+				for (const FGaussianSplattingPoint& Point : NewPoints) {
+					Points.Add(Point);
+					Velocities.Add(FVector3f(Random.GetUnitVector()) * Random.FRandRange(0.0f, 5.0f));
+					Ids.Add(NextId++);
+				}
+			}
+			Builder.AddFrame(Points, Ids);
+			TArray<FVector3f>& Positions = SourcePositions.AddDefaulted_GetRef();
+			Positions.Reserve(Points.Num());
+			for (const FGaussianSplattingPoint& Point : Points) {
+				Positions.Add(Point.Position);
+			}
+		}
+		const double EncodeTime = FPlatformTime::Seconds() - EncodeStart;
+
+		FGaussianSplattingSequenceDecoder Decoder;
+		FGaussianSplattingSequenceFrame Frame;
+		double KeyframeDecodeTime = 0.0;
+		double DeltaDecodeTime = 0.0;
+		double MaxKeyframeDecodeTime = 0.0;
+		double MaxDeltaDecodeTime = 0.0;
+		float MaxPositionError = 0.0f;
+		int32 NumMismatches = 0;
+		for (int32 FrameIndex = 0; FrameIndex < Sequence->GetNumFrames(); FrameIndex++) {
+			TArray<uint8> Payload;
+			Sequence->ReadFramePayload(FrameIndex, [&Payload](TArray<uint8>&& InPayload) { Payload = MoveTemp(InPayload); });
+			const double DecodeStart = FPlatformTime::Seconds();
+			const bool bDecoded = Decoder.DecodeFrame(FrameIndex, Payload);
+			Decoder.Pack(Frame);
+			const double DecodeTime = FPlatformTime::Seconds() - DecodeStart;
+			const bool bKeyframe = Sequence->GetFrameInfo(FrameIndex).bKeyframe;
+			(bKeyframe ? KeyframeDecodeTime : DeltaDecodeTime) += DecodeTime;
+			double& MaxDecodeTime = bKeyframe ? MaxKeyframeDecodeTime : MaxDeltaDecodeTime;
+			MaxDecodeTime = FMath::Max(MaxDecodeTime, DecodeTime);
+
+			const TArray<FVector3f>& Positions = SourcePositions[FrameIndex];
+			if (!bDecoded || Frame.NumPoints != Positions.Num()) {
+				NumMismatches++;
+				continue;
+			}
+			for (int32 i = 0; i < Positions.Num(); i++) {
+				MaxPositionError = FMath::Max(MaxPositionError, (FVector3f(Frame.PointData[i * FGaussianSplattingPoint::NumPackedVectors]) - Positions[i]).GetAbsMax());
+			}
+		}
+
+		// Decoding runs ahead of playback, so keyframe spikes are absorbed as long as the sustained rate keeps up with the frames.
+		const int32 NumKeyframes = Builder.GetNumKeyframes();
+		const int32 NumDeltas = NumFrames - NumKeyframes;
+		const double SustainedDecodeTime = (KeyframeDecodeTime + DeltaDecodeTime) / FMath::Max(NumFrames, 1);
+		UE_LOG(LogTemp, Log, TEXT("SequenceDecode: %d points, %d frames, encode %.1f ms/frame, keyframes %d x %.2f MB, deltas %d x %.2f MB"),
+			NumPoints, NumFrames, EncodeTime * 1000.0 / FMath::Max(NumFrames, 1),
+			NumKeyframes, Builder.GetKeyframeBytes() / 1048576.0 / FMath::Max(NumKeyframes, 1), NumDeltas, Builder.GetDeltaBytes() / 1048576.0 / FMath::Max(NumDeltas, 1));
+		UE_LOG(LogTemp, Log, TEXT("SequenceDecode: keyframe decode %.2f ms avg %.2f ms max, delta decode %.2f ms avg %.2f ms max, sustained %.2f ms per frame for a %.2f ms budget"),
+			KeyframeDecodeTime * 1000.0 / FMath::Max(NumKeyframes, 1), MaxKeyframeDecodeTime * 1000.0, DeltaDecodeTime * 1000.0 / FMath::Max(NumDeltas, 1), MaxDeltaDecodeTime * 1000.0,
+			SustainedDecodeTime * 1000.0, FrameBudget * 1000.0);
+		if (NumMismatches > 0 || MaxPositionError > 0.025f) {
+			UE_LOG(LogTemp, Error, TEXT("SequenceDecode: %d frames did not decode to the source, position error up to %.4f"), NumMismatches, MaxPositionError);
+		}
+		if (SustainedDecodeTime > FrameBudget || MaxDeltaDecodeTime > FrameBudget) {
+			UE_LOG(LogTemp, Warning, TEXT("SequenceDecode: decoding does not keep up with 30 fps playback"));
+		}
+		else {
+			UE_LOG(LogTemp, Log, TEXT("SequenceDecode: within the 30 fps frame budget, decoded positions within %.4f of the source"), MaxPositionError);
+		}
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkLOD(
+	TEXT("GaussianSplatting.Benchmark.LOD"),
+	TEXT("Builds the merged LOD levels of a synthetic cloud and logs the build time, size and error of every level. Arguments: [NumPoints=4000000] [ReductionRatio=8]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 4000000;
+		GaussianSplattingLOD::FSettings Settings;
+		Settings.ReductionRatio = Args.Num() > 1 ? FCString::Atof(*Args[1]) : Settings.ReductionRatio;
+		const TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints);
+
+		TArray<TArray<FGaussianSplattingPoint>> Levels;
+		TArray<FGaussianSplattingLODLevel> LevelInfos;
+		const double BuildStart = FPlatformTime::Seconds();
+		GaussianSplattingLOD::BuildLevels(Points, Settings, Levels, LevelInfos);
+		const double BuildTime = FPlatformTime::Seconds() - BuildStart;
+
+		// Merging keeps the total coverage, opacity times the area of the splats, unless merged splats saturate their opacity.
+		auto GetCoverage = [](const TArray<FGaussianSplattingPoint>& InPoints) {
+			double Coverage = 0.0;
+			for (const FGaussianSplattingPoint& Point : InPoints) {
+				Coverage += Point.Color.A * (Point.Scale.X * Point.Scale.Y + Point.Scale.Y * Point.Scale.Z + Point.Scale.Z * Point.Scale.X);
+			}
+			return Coverage;
+		};
+		const double SourceCoverage = FMath::Max(GetCoverage(Points), UE_SMALL_NUMBER);
+		const double BytesPerPoint = sizeof(FVector4f) * FGaussianSplattingPoint::NumPackedVectors;
+		UE_LOG(LogTemp, Log, TEXT("LOD: %d points, %d levels, build %.1f ms, LOD 0 %.2f MB on the GPU"),
+			NumPoints, Levels.Num(), BuildTime * 1000.0, NumPoints * BytesPerPoint / 1048576.0);
+		for (int32 LevelIndex = 0; LevelIndex < Levels.Num(); LevelIndex++) {
+			const FGaussianSplattingLODLevel& Info = LevelInfos[LevelIndex];
+			UE_LOG(LogTemp, Log, TEXT("LOD: LOD %d, %d points (%.1fx fewer), %.2f MB, error %.2f, shown from %.0f units at the default screen error, coverage %.1f%%"),
+				LevelIndex + 1, Info.NumPoints, (double)NumPoints / FMath::Max(Info.NumPoints, 1), Info.NumPoints * BytesPerPoint / 1048576.0,
+				Info.Error, Info.Error / 0.002f, GetCoverage(Levels[LevelIndex]) * 100.0 / SourceCoverage);
+		}
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkSoftwareRender(
+	TEXT("GaussianSplatting.Benchmark.SoftwareRender"),
+	TEXT("Renders a synthetic cloud with the CPU rasterizer from inside the cloud and logs the timings of every stage. Arguments: [NumPoints=1000000] [Width=1920] [Height=1080]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000000;
+		const int32 Width = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1920;
+		const int32 Height = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 1080;
+		TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints);
+		FRandomStream Random(NumPoints);
+		for (FGaussianSplattingPoint& Point : Points) {
+			Point.Color.A = Random.FRandRange(0.2f, 1.0f);
+		}
+		// From the middle of the clusters, near ones cover many tiles and far ones a few pixels, like a captured scene.
+		const FGaussianSplattingRenderView View = FGaussianSplattingRenderView::LookAt(FVector3f::ZeroVector, FVector3f::ForwardVector, Width, Height, 90.0f);
+
+		TArray<FLinearColor> Pixels;
+		TArray<FLinearColor> RepeatPixels;
+		GaussianSplattingSoftwareRenderer::FStats Stats;
+		GaussianSplattingSoftwareRenderer::Render(Points, View, Pixels);
+		const double RenderStart = FPlatformTime::Seconds();
+		GaussianSplattingSoftwareRenderer::Render(Points, View, RepeatPixels, &Stats);
+		const double RenderTime = FPlatformTime::Seconds() - RenderStart;
+
+		// Golden images need the exact same pixels on every run, whatever the scheduling of the tasks.
+		const bool bDeterministic = GaussianSplattingSoftwareRenderer::ComputePSNR(RepeatPixels, Pixels) == UE_MAX_FLT;
+		UE_LOG(LogTemp, Log, TEXT("SoftwareRender: %d points at %dx%d, %d visible, %lld tile entries, project %.1f ms, bin %.1f ms, raster %.1f ms, total %.1f ms (%.1f M splats/s)"),
+			NumPoints, Width, Height, Stats.NumVisibleSplats, Stats.NumTileEntries, Stats.ProjectSeconds * 1000.0, Stats.BinSeconds * 1000.0, Stats.RasterSeconds * 1000.0,
+			RenderTime * 1000.0, NumPoints / FMath::Max(RenderTime, UE_DOUBLE_SMALL_NUMBER) / 1000000.0);
+		if (!bDeterministic) {
+			UE_LOG(LogTemp, Error, TEXT("SoftwareRender: two renders of the same view differ"));
+		}
+		// The throughput target, see the README, for 1M splats at 1080p.
+		const double TargetSeconds = 0.5 * ((double)NumPoints / 1000000.0) * ((double)Width * Height / (1920.0 * 1080.0));
+		if (RenderTime > TargetSeconds) {
+			UE_LOG(LogTemp, Warning, TEXT("SoftwareRender: slower than the %.0f ms target for this size"), TargetSeconds * 1000.0);
+		}
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkAccumulateWeights(
+	TEXT("GaussianSplatting.Benchmark.AccumulateWeights"),
+	TEXT("Scores a synthetic cloud over a ring of views with the CPU rasterizer, checks the weights against the rendered coverage and logs the timings. Arguments: [NumPoints=1000000] [NumViews=16] [Width=1600] [Height=900]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000000;
+		const int32 NumViews = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 16, 1);
+		const int32 Width = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 1600;
+		const int32 Height = Args.Num() > 3 ? FCString::Atoi(*Args[3]) : 900;
+		TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints);
+		FRandomStream Random(NumPoints);
+		for (FGaussianSplattingPoint& Point : Points) {
+			Point.Color.A = Random.FRandRange(0.2f, 1.0f);
+		}
+
+		TArray<float> MaxWeights;
+		TArray<float> SumWeights;
+		MaxWeights.SetNumZeroed(NumPoints);
+		SumWeights.SetNumZeroed(NumPoints);
+		double ScoreTime = 0.0;
+		double WeightError = 0.0;
+		TArray<FLinearColor> Pixels;
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ViewIndex++) {
+			// Cameras inside the clusters looking outwards around the vertical axis, like a capture walking around a room.
+			const float Angle = UE_TWO_PI * ViewIndex / NumViews;
+			const FVector3f Location(FMath::Cos(Angle) * 2000.0f, FMath::Sin(Angle) * 2000.0f, 0.0f);
+			const FGaussianSplattingRenderView View = FGaussianSplattingRenderView::LookAt(Location, Location * 2.0f, Width, Height, 90.0f);
+			const double PreviousSum = Algo::Accumulate(SumWeights, 0.0);
+			const double ScoreStart = FPlatformTime::Seconds();
+			GaussianSplattingSoftwareRenderer::AccumulateWeights(Points, View, MaxWeights, SumWeights);
+			ScoreTime += FPlatformTime::Seconds() - ScoreStart;
+
+			// The weights of all splats in a pixel add up to its coverage, so the view adds the summed alpha of its image.
+			GaussianSplattingSoftwareRenderer::Render(Points, View, Pixels);
+			double Coverage = 0.0;
+			for (const FLinearColor& Pixel : Pixels) {
+				Coverage += Pixel.A;
+			}
+			const double ViewSum = Algo::Accumulate(SumWeights, 0.0) - PreviousSum;
+			WeightError = FMath::Max(WeightError, FMath::Abs(ViewSum - Coverage) / FMath::Max(Coverage, 1.0));
+		}
+
+		int32 NumUnseen = 0;
+		for (float MaxWeight : MaxWeights) {
+			NumUnseen += MaxWeight < 1.0f / 255.0f ? 1 : 0;
+		}
+		UE_LOG(LogTemp, Log, TEXT("AccumulateWeights: %d points over %d views at %dx%d, %.1f ms per view, %d points unseen (%.1f%%), largest weight to coverage error %.5f%%"),
+			NumPoints, NumViews, Width, Height, ScoreTime * 1000.0 / NumViews, NumUnseen, NumUnseen * 100.0 / FMath::Max(NumPoints, 1), WeightError * 100.0);
+		if (WeightError > 1e-3) {
+			UE_LOG(LogTemp, Error, TEXT("AccumulateWeights: the summed weights do not match the coverage of the rendered images"));
+		}
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkBinning(
+	TEXT("GaussianSplatting.Benchmark.Binning"),
+	TEXT("Repartitions a synthetic grid of placed clouds into cells with the binning pass and with a copy of every overlapping cloud per cell, checks that both agree and logs the timings. Arguments: [NumPoints=20000000] [NumCells=200] [NumSources=64]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20000000;
+		const int32 NumCellsTarget = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 200, 1);
+		const int32 NumSourcesTarget = FMath::Max(Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 64, 1);
+		// Square grids of sources and of cells over the same area, the sources do not line up with the cells.
+		const double CellSize = 51200.0;
+		const int32 CellsPerSide = FMath::CeilToInt32(FMath::Sqrt((float)NumCellsTarget));
+		const int32 SourcesPerSide = FMath::CeilToInt32(FMath::Sqrt((float)NumSourcesTarget));
+		const double SourceSize = CellSize * CellsPerSide / SourcesPerSide;
+		FRandomStream Random(NumPoints);
+		TArray<TArray<FGaussianSplattingPoint>> SourcePoints;
+		TArray<GaussianSplattingBinning::FSource> Sources;
+		SourcePoints.SetNum(SourcesPerSide * SourcesPerSide);
+		for (int32 SourceIndex = 0; SourceIndex < SourcePoints.Num(); SourceIndex++) {
+			TArray<FGaussianSplattingPoint>& Points = SourcePoints[SourceIndex];
+			Points.SetNum(NumPoints / SourcePoints.Num());
+			for (FGaussianSplattingPoint& Point : Points) {
+				Point.Position = FVector3f(Random.FRandRange(-0.5f, 0.5f), Random.FRandRange(-0.5f, 0.5f), Random.FRandRange(-0.01f, 0.01f)) * (float)SourceSize;
+				Point.Scale = FVector3f(Random.FRandRange(1.0f, 20.0f));
+			}
+			const FVector Offset(((SourceIndex % SourcesPerSide) + 0.5) * SourceSize, ((SourceIndex / SourcesPerSide) + 0.5) * SourceSize, 0.0);
+			Sources.Add({ Points, Offset });
+		}
+
+		GaussianSplattingBinning::FCells Cells;
+		GaussianSplattingBinning::FStats Stats;
+		const double BinStart = FPlatformTime::Seconds();
+		GaussianSplattingBinning::BinPoints(Sources, FVector2D::ZeroVector, CellSize, Cells, &Stats);
+		const double BinTime = FPlatformTime::Seconds() - BinStart;
+
+		// The previous repartition: every cell copies the clouds overlapping it, moves their points and tests each of them.
+		TMap<FIntPoint, int32> ReferenceCounts;
+		const double ReferenceStart = FPlatformTime::Seconds();
+		for (int32 CellY = 0; CellY < CellsPerSide; CellY++) {
+			for (int32 CellX = 0; CellX < CellsPerSide; CellX++) {
+				const FBox2D CellBounds(FVector2D(CellX, CellY) * CellSize, FVector2D(CellX + 1, CellY + 1) * CellSize);
+				int32 Count = 0;
+				for (const GaussianSplattingBinning::FSource& Source : Sources) {
+					const FBox2D SourceBounds(FVector2D(Source.Offset) - SourceSize * 0.5, FVector2D(Source.Offset) + SourceSize * 0.5);
+					if (!SourceBounds.Intersect(CellBounds)) {
+						continue;
+					}
+					TArray<FGaussianSplattingPoint> LocalPoints(Source.Points);
+					for (FGaussianSplattingPoint& Point : LocalPoints) {
+						const FVector Position = Source.Offset + FVector(Point.Position);
+						Count += FMath::FloorToInt32(Position.X * (1.0 / CellSize)) == CellX && FMath::FloorToInt32(Position.Y * (1.0 / CellSize)) == CellY ? 1 : 0;
+					}
+				}
+				if (Count > 0) {
+					ReferenceCounts.Add(FIntPoint(CellX, CellY), Count);
+				}
+			}
+		}
+		const double ReferenceTime = FPlatformTime::Seconds() - ReferenceStart;
+
+		int32 NumMismatches = ReferenceCounts.Num() != Cells.Cells.Num() ? 1 : 0;
+		for (int32 CellIndex = 0; CellIndex < Cells.Cells.Num(); CellIndex++) {
+			const int32* ReferenceCount = ReferenceCounts.Find(Cells.Cells[CellIndex]);
+			NumMismatches += ReferenceCount && *ReferenceCount == Cells.GetCellPoints(CellIndex).Num() ? 0 : 1;
+		}
+		UE_LOG(LogTemp, Log, TEXT("Binning: %d points of %d clouds into %d cells with %d blocks, bounds %.1f ms, count %.1f ms, scatter %.1f ms, total %.1f ms, per cell copies %.1f ms (%.1fx)"),
+			Cells.Points.Num(), Sources.Num(), Cells.Cells.Num(), Stats.NumBlocks, Stats.BoundsSeconds * 1000.0, Stats.CountSeconds * 1000.0, Stats.ScatterSeconds * 1000.0,
+			BinTime * 1000.0, ReferenceTime * 1000.0, ReferenceTime / FMath::Max(BinTime, UE_DOUBLE_SMALL_NUMBER));
+		if (NumMismatches > 0) {
+			UE_LOG(LogTemp, Error, TEXT("Binning: %d cells differ from the per cell reference"), NumMismatches);
+		}
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkOctreeBinning(
+	TEXT("GaussianSplatting.Benchmark.OctreeBinning"),
+	TEXT("Bins a synthetic cloud of dense clusters into an adaptive octree and into a fixed grid with as many cells, checks the budget and logs how evenly the points spread. Arguments: [NumPoints=20000000] [MaxPointsPerCell=1000000]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20000000;
+		const int32 MaxPointsPerCell = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1000000, 1);
+		const TArray<FGaussianSplattingPoint> Points = GaussianSplattingBenchmarks::MakeBenchmarkPoints(NumPoints);
+		const GaussianSplattingBinning::FSource Source{ Points, FVector::ZeroVector };
+
+		GaussianSplattingBinning::FOctreeSettings Settings;
+		Settings.MaxPointsPerCell = MaxPointsPerCell;
+		Settings.MaxDepth = GaussianSplattingBinning::MaxOctreeDepth;
+		GaussianSplattingBinning::FOctreeCells OctreeCells;
+		GaussianSplattingBinning::FStats Stats;
+		const double BinStart = FPlatformTime::Seconds();
+		GaussianSplattingBinning::BinPointsOctree(MakeArrayView(&Source, 1), Settings, OctreeCells, &Stats);
+		const double BinTime = FPlatformTime::Seconds() - BinStart;
+
+		int32 NumOverBudget = 0;
+		int32 MaxOctreeCount = 0;
+		for (int32 CellIndex = 0; CellIndex < OctreeCells.Cells.Num(); CellIndex++) {
+			const int32 Count = OctreeCells.GetCellPoints(CellIndex).Num();
+			MaxOctreeCount = FMath::Max(MaxOctreeCount, Count);
+			NumOverBudget += Count > MaxPointsPerCell && OctreeCells.Cells[CellIndex].Depth < Settings.MaxDepth ? 1 : 0;
+		}
+
+		// A fixed grid over the same area with about as many cells, like the 2D repartition.
+		FBox3f Bounds(ForceInit);
+		for (const FGaussianSplattingPoint& Point : Points) {
+			Bounds += Point.Position;
+		}
+		const double GridCellSize = FMath::Sqrt((double)Bounds.GetSize().X * Bounds.GetSize().Y / FMath::Max(OctreeCells.Cells.Num(), 1));
+		GaussianSplattingBinning::FCells GridCells;
+		GaussianSplattingBinning::BinPoints(MakeArrayView(&Source, 1), FVector2D(Bounds.Min.X, Bounds.Min.Y), GridCellSize, GridCells);
+		int32 MaxGridCount = 0;
+		for (int32 CellIndex = 0; CellIndex < GridCells.Cells.Num(); CellIndex++) {
+			MaxGridCount = FMath::Max(MaxGridCount, GridCells.GetCellPoints(CellIndex).Num());
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("OctreeBinning: %d points into %d cells, bounds %.1f ms, sort %.1f ms, scatter %.1f ms, total %.1f ms, largest cell %d points (%.1fx the mean), fixed grid of %d cells: largest %d points (%.1fx the mean)"),
+			OctreeCells.Points.Num(), OctreeCells.Cells.Num(), Stats.BoundsSeconds * 1000.0, Stats.SortSeconds * 1000.0, Stats.ScatterSeconds * 1000.0, BinTime * 1000.0,
+			MaxOctreeCount, MaxOctreeCount * (double)OctreeCells.Cells.Num() / FMath::Max(NumPoints, 1),
+			GridCells.Cells.Num(), MaxGridCount, MaxGridCount * (double)GridCells.Cells.Num() / FMath::Max(NumPoints, 1));
+		if (NumOverBudget > 0 || OctreeCells.Points.Num() != NumPoints) {
+			UE_LOG(LogTemp, Error, TEXT("OctreeBinning: %d cells above the budget, %d of %d points binned"), NumOverBudget, OctreeCells.Points.Num(), NumPoints);
+		}
+	}));
+
+static FAutoConsoleCommand GGaussianSplattingBenchmarkOverlaps(
+	TEXT("GaussianSplatting.Benchmark.Overlaps"),
+	TEXT("Captures a synthetic scene with a row of padded clusters that duplicate the splats of their neighbors with a little noise, removes the overlaps by ownership and by similarity and logs how many duplicates were left. Arguments: [NumPoints=10000000] [NumSources=16]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumPoints = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000000;
+		const int32 NumSources = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 16, 2);
+		// Clusters of 10000 wide laid along X, each capturing 20% more on both sides like CaptureDistanceScale padding does.
+		const double SourceSize = 10000.0;
+		const double Padding = SourceSize * 0.2;
+		FRandomStream Random(NumPoints);
+		TArray<TArray<FGaussianSplattingPoint>> SourcePoints;
+		SourcePoints.SetNum(NumSources);
+		for (int32 i = 0; i < NumPoints; i++) {
+			FGaussianSplattingPoint Point;
+			Point.Position = FVector3f(Random.FRandRange(0.0f, (float)(SourceSize * NumSources)), Random.FRandRange(-5000.0f, 5000.0f), Random.FRandRange(0.0f, 2000.0f));
+			Point.Scale = FVector3f(Random.FRandRange(1.0f, 20.0f));
+			Point.Color = FLinearColor(Random.FRand(), Random.FRand(), Random.FRand(), 1.0f);
+			for (int32 SourceIndex = 0; SourceIndex < NumSources; SourceIndex++) {
+				if (Point.Position.X >= SourceIndex * SourceSize - Padding && Point.Position.X < (SourceIndex + 1) * SourceSize + Padding) {
+					FGaussianSplattingPoint& Trained = SourcePoints[SourceIndex].Add_GetRef(Point);
+					Trained.Position += FVector3f(Random.VRand()) * 2.0f - FVector3f(((SourceIndex + 0.5) * SourceSize), 0.0f, 0.0f);
+					Trained.Color += FLinearColor(Random.FRandRange(-0.02f, 0.02f), Random.FRandRange(-0.02f, 0.02f), Random.FRandRange(-0.02f, 0.02f), 0.0f);
+				}
+			}
+		}
+		TArray<GaussianSplattingBinning::FSource> Sources;
+		int32 NumSourcePoints = 0;
+		for (int32 SourceIndex = 0; SourceIndex < NumSources; SourceIndex++) {
+			Sources.Add({ SourcePoints[SourceIndex], FVector((SourceIndex + 0.5) * SourceSize, 0.0, 0.0) });
+			NumSourcePoints += SourcePoints[SourceIndex].Num();
+		}
+
+		for (GaussianSplattingBinning::EOverlapMode Mode : { GaussianSplattingBinning::EOverlapMode::Ownership, GaussianSplattingBinning::EOverlapMode::Similarity }) {
+			GaussianSplattingBinning::FOverlapSettings Settings;
+			Settings.Mode = Mode;
+			TArray<TArray<FGaussianSplattingPoint>> RemainingPoints;
+			TArray<GaussianSplattingBinning::FSource> RemainingSources;
+			GaussianSplattingBinning::FOverlapStats Stats;
+			GaussianSplattingBinning::RemoveOverlaps(Sources, Settings, RemainingPoints, RemainingSources, &Stats);
+			UE_LOG(LogTemp, Log, TEXT("Overlaps (%s): %d points captured for %d scene points, %d candidates, %d removed (%.1f%% of the duplicates), %.1f ms"),
+				Mode == GaussianSplattingBinning::EOverlapMode::Ownership ? TEXT("ownership") : TEXT("similarity"),
+				NumSourcePoints, NumPoints, Stats.NumCandidates, Stats.NumRemoved, 100.0 * Stats.NumRemoved / FMath::Max(NumSourcePoints - NumPoints, 1), Stats.Seconds * 1000.0);
+		}
+	}));
@@ -0,0 +1,506 @@
+#include "GaussianSplattingBinning.h"
+#include "GaussianSplattingPointCloud.h"
+#include "GaussianSplattingSorter.h"
+#include "Async/ParallelFor.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+
+/** Dense grids beyond this many cells, or per block counters beyond this many entries, are not worth binning into. */
+static constexpr int64 MaxDenseCells = 1 << 24;
+
+/** Start of every source in the concatenation of their points, false when they hold more points than a single pass can. */
+static bool GetSourceStarts(TConstArrayView<GaussianSplattingBinning::FSource> Sources, TArray<int32>& OutSourceStarts)
+{
+	OutSourceStarts.SetNumUninitialized(Sources.Num() + 1);
+	int64 NumPoints = 0;
+	for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); SourceIndex++) {
+		OutSourceStarts[SourceIndex] = (int32)FMath::Min(NumPoints, (int64)MAX_int32);
+		NumPoints += Sources[SourceIndex].Points.Num();
+	}
+	if (NumPoints > MAX_int32) {
+		UE_LOG(LogTemp, Warning, TEXT("Binning %lld points is more than a single pass can hold."), NumPoints);
+		return false;
+	}
+	OutSourceStarts[Sources.Num()] = (int32)NumPoints;
+	return true;
+}
+
+/** Calls Func(GlobalIndex, Point, Offset) for the points of the sources within [Begin, End) of their concatenation. */
+template<typename FuncType>
+static void ForEachSourcePoint(TConstArrayView<GaussianSplattingBinning::FSource> Sources, TConstArrayView<int32> SourceStarts, int32 Begin, int32 End, FuncType&& Func)
+{
+	int32 SourceIndex = Algo::UpperBound(SourceStarts, Begin) - 1;
+	for (int32 GlobalIndex = Begin; GlobalIndex < End; SourceIndex++) {
+		const GaussianSplattingBinning::FSource& Source = Sources[SourceIndex];
+		const int32 SourceEnd = FMath::Min(SourceStarts[SourceIndex + 1], End);
+		for (; GlobalIndex < SourceEnd; GlobalIndex++) {
+			Func(GlobalIndex, Source.Points[GlobalIndex - SourceStarts[SourceIndex]], Source.Offset);
+		}
+	}
+}
+
+/** Spreads the low 10 bits of Value to every third bit. */
+static uint32 SpreadMortonBits(uint32 Value)
+{
+	Value &= 0x3FF;
+	Value = (Value | (Value << 16)) & 0x030000FF;
+	Value = (Value | (Value << 8)) & 0x0300F00F;
+	Value = (Value | (Value << 4)) & 0x030C30C3;
+	Value = (Value | (Value << 2)) & 0x09249249;
+	return Value;
+}
+
+/** Key of a cell in the spatial hash of RemoveOverlaps, cells sharing a key are told apart by their coordinates. */
+static uint32 HashOverlapCell(const FIntVector& Cell)
+{
+	return ((uint32)Cell.X * 73856093u) ^ ((uint32)Cell.Y * 19349663u) ^ ((uint32)Cell.Z * 83492791u);
+}
+
+static bool IsOverlapCellLess(const FIntVector& A, const FIntVector& B)
+{
+	return A.X != B.X ? A.X < B.X : A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z;
+}
+
+int64 GaussianSplattingBinning::GetPointBytes(int32 NumPoints)
+{
+	return (int64)NumPoints * FGaussianSplattingPoint::NumPackedVectors * sizeof(FVector4f);
+}
+
+FVector GaussianSplattingBinning::GetCellCenter(const FVector2D& Origin, double CellSize, FIntPoint Cell)
+{
+	return FVector(Origin.X + (Cell.X + 0.5) * CellSize, Origin.Y + (Cell.Y + 0.5) * CellSize, 0.0);
+}
+
+void GaussianSplattingBinning::BinPoints(TConstArrayView<FSource> Sources, const FVector2D& Origin, double CellSize, FCells& OutCells, FStats* OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingBinning::BinPoints);
+	OutCells = FCells();
+	FStats Stats;
+	TArray<int32> SourceStarts;
+	if (!GetSourceStarts(Sources, SourceStarts)) {
+		return;
+	}
+	const int64 NumPoints = SourceStarts.Last();
+	if (NumPoints == 0 || CellSize <= 0.0) {
+		return;
+	}
+	const double InvCellSize = 1.0 / CellSize;
+	auto GetCell = [&](const FGaussianSplattingPoint& Point, const FVector& Offset) {
+		return FIntPoint(
+			FMath::FloorToInt32(FMath::Clamp((Offset.X + Point.Position.X - Origin.X) * InvCellSize, -1.0e9, 1.0e9)),
+			FMath::FloorToInt32(FMath::Clamp((Offset.Y + Point.Position.Y - Origin.Y) * InvCellSize, -1.0e9, 1.0e9)));
+	};
+
+	// Range of cells actually holding points, which may reach outside of the bounds the caller placed the grid on.
+	double StageStart = FPlatformTime::Seconds();
+	const int32 NumWorkers = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	const int32 NumBoundsBlocks = FMath::Clamp((int32)FMath::DivideAndRoundUp(NumPoints, (int64)65536), 1, NumWorkers * 4);
+	const int32 PointsPerBoundsBlock = (int32)FMath::DivideAndRoundUp(NumPoints, (int64)NumBoundsBlocks);
+	TArray<FIntRect> BlockCellRanges;
+	BlockCellRanges.Init(FIntRect(FIntPoint(MAX_int32), FIntPoint(MIN_int32)), NumBoundsBlocks);
+	ParallelFor(TEXT("GaussianSplatting.BinBounds"), NumBoundsBlocks, 1, [&](int32 BlockIndex) {
+		FIntRect& Range = BlockCellRanges[BlockIndex];
+		const int32 Begin = BlockIndex * PointsPerBoundsBlock;
+		ForEachSourcePoint(Sources, SourceStarts, Begin, FMath::Min(Begin + PointsPerBoundsBlock, (int32)NumPoints), [&](int32, const FGaussianSplattingPoint& Point, const FVector& Offset) {
+			const FIntPoint Cell = GetCell(Point, Offset);
+			Range.Min = Range.Min.ComponentMin(Cell);
+			Range.Max = Range.Max.ComponentMax(Cell);
+		});
+	});
+	FIntRect CellRange = BlockCellRanges[0];
+	for (const FIntRect& Range : BlockCellRanges) {
+		CellRange.Min = CellRange.Min.ComponentMin(Range.Min);
+		CellRange.Max = CellRange.Max.ComponentMax(Range.Max);
+	}
+	const int64 NumGridCells = ((int64)CellRange.Max.X - CellRange.Min.X + 1) * ((int64)CellRange.Max.Y - CellRange.Min.Y + 1);
+	if (NumGridCells > MaxDenseCells) {
+		UE_LOG(LogTemp, Warning, TEXT("Binning points into %lld cells of size %.1f, the cells are too small for the extent of the points."), NumGridCells, CellSize);
+		return;
+	}
+	Stats.BoundsSeconds = FPlatformTime::Seconds() - StageStart;
+
+	// Every block counts its points per cell, the counters of all blocks together stay within MaxDenseCells.
+	StageStart = FPlatformTime::Seconds();
+	const int32 NumCells = (int32)NumGridCells;
+	const int32 GridWidth = CellRange.Max.X - CellRange.Min.X + 1;
+	const int32 NumBlocks = FMath::Clamp((int32)FMath::DivideAndRoundUp(NumPoints, (int64)65536), 1, FMath::Min(NumWorkers * 4, FMath::Max((int32)(MaxDenseCells / NumCells), 1)));
+	const int32 PointsPerBlock = (int32)FMath::DivideAndRoundUp(NumPoints, (int64)NumBlocks);
+	TArray<int32> Keys;
+	Keys.SetNumUninitialized((int32)NumPoints);
+	TArray<int32> BlockOffsets;
+	BlockOffsets.SetNumZeroed(NumBlocks * NumCells);
+	ParallelFor(TEXT("GaussianSplatting.BinCount"), NumBlocks, 1, [&](int32 BlockIndex) {
+		int32* Counts = &BlockOffsets[BlockIndex * NumCells];
+		const int32 Begin = BlockIndex * PointsPerBlock;
+		ForEachSourcePoint(Sources, SourceStarts, Begin, FMath::Min(Begin + PointsPerBlock, (int32)NumPoints), [&](int32 GlobalIndex, const FGaussianSplattingPoint& Point, const FVector& Offset) {
+			const FIntPoint Cell = GetCell(Point, Offset) - CellRange.Min;
+			const int32 Key = Cell.Y * GridWidth + Cell.X;
+			Keys[GlobalIndex] = Key;
+			Counts[Key]++;
+		});
+	});
+
+	// Offsets walk the blocks in order within every cell, so each cell keeps the order of the sources.
+	int32 NumEntries = 0;
+	for (int32 Key = 0; Key < NumCells; Key++) {
+		const int32 CellStart = NumEntries;
+		for (int32 BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex++) {
+			int32& Offset = BlockOffsets[BlockIndex * NumCells + Key];
+			const int32 Count = Offset;
+			Offset = NumEntries;
+			NumEntries += Count;
+		}
+		if (NumEntries > CellStart) {
+			OutCells.Cells.Add(CellRange.Min + FIntPoint(Key % GridWidth, Key / GridWidth));
+			OutCells.CellStarts.Add(CellStart);
+		}
+	}
+	OutCells.CellStarts.Add(NumEntries);
+	Stats.CountSeconds = FPlatformTime::Seconds() - StageStart;
+
+	StageStart = FPlatformTime::Seconds();
+	OutCells.Points.SetNumUninitialized(NumEntries);
+	ParallelFor(TEXT("GaussianSplatting.BinScatter"), NumBlocks, 1, [&](int32 BlockIndex) {
+		int32* Offsets = &BlockOffsets[BlockIndex * NumCells];
+		const int32 Begin = BlockIndex * PointsPerBlock;
+		ForEachSourcePoint(Sources, SourceStarts, Begin, FMath::Min(Begin + PointsPerBlock, (int32)NumPoints), [&](int32 GlobalIndex, const FGaussianSplattingPoint& Point, const FVector& Offset) {
+			const int32 Key = Keys[GlobalIndex];
+			const FVector CellCenter = GetCellCenter(Origin, CellSize, CellRange.Min + FIntPoint(Key % GridWidth, Key / GridWidth));
+			FGaussianSplattingPoint& CellPoint = OutCells.Points[Offsets[Key]++];
+			CellPoint = Point;
+			CellPoint.Position = FVector3f(Offset + FVector(Point.Position) - CellCenter);
+		});
+	});
+	Stats.ScatterSeconds = FPlatformTime::Seconds() - StageStart;
+	Stats.NumBlocks = NumBlocks;
+	if (OutStats) {
+		*OutStats = Stats;
+	}
+}
+
+void GaussianSplattingBinning::BinPointsOctree(TConstArrayView<FSource> Sources, const FOctreeSettings& Settings, FOctreeCells& OutCells, FStats* OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingBinning::BinPointsOctree);
+	OutCells = FOctreeCells();
+	FStats Stats;
+	TArray<int32> SourceStarts;
+	if (!GetSourceStarts(Sources, SourceStarts)) {
+		return;
+	}
+	const int64 NumPoints = SourceStarts.Last();
+	if (NumPoints == 0) {
+		return;
+	}
+
+	double StageStart = FPlatformTime::Seconds();
+	const int32 NumWorkers = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	const int32 NumBlocks = FMath::Clamp((int32)FMath::DivideAndRoundUp(NumPoints, (int64)65536), 1, NumWorkers * 4);
+	const int32 PointsPerBlock = (int32)FMath::DivideAndRoundUp(NumPoints, (int64)NumBlocks);
+	TArray<FBox> BlockBounds;
+	BlockBounds.Init(FBox(ForceInit), NumBlocks);
+	ParallelFor(TEXT("GaussianSplatting.OctreeBounds"), NumBlocks, 1, [&](int32 BlockIndex) {
+		const int32 Begin = BlockIndex * PointsPerBlock;
+		ForEachSourcePoint(Sources, SourceStarts, Begin, FMath::Min(Begin + PointsPerBlock, (int32)NumPoints), [&](int32, const FGaussianSplattingPoint& Point, const FVector& Offset) {
+			BlockBounds[BlockIndex] += Offset + FVector(Point.Position);
+		});
+	});
+	FBox Bounds(ForceInit);
+	for (const FBox& Box : BlockBounds) {
+		Bounds += Box;
+	}
+	// A cube slightly larger than the points, so the points on its far faces still quantize inside of it.
+	const double HalfSize = FMath::Max(Bounds.GetExtent().GetMax(), 1.0) * 1.0001;
+	const FBox Root = FBox::BuildAABB(Bounds.GetCenter(), FVector(HalfSize));
+	Stats.BoundsSeconds = FPlatformTime::Seconds() - StageStart;
+
+	// Every node of the octree is a contiguous range of the points sorted by their Morton codes.
+	StageStart = FPlatformTime::Seconds();
+	const int32 Resolution = 1 << MaxOctreeDepth;
+	const double Quantize = Resolution / (2.0 * HalfSize);
+	TArray<uint32> Keys;
+	TArray<uint32> Order;
+	Keys.SetNumUninitialized((int32)NumPoints);
+	Order.SetNumUninitialized((int32)NumPoints);
+	ParallelFor(TEXT("GaussianSplatting.OctreeKeys"), NumBlocks, 1, [&](int32 BlockIndex) {
+		const int32 Begin = BlockIndex * PointsPerBlock;
+		ForEachSourcePoint(Sources, SourceStarts, Begin, FMath::Min(Begin + PointsPerBlock, (int32)NumPoints), [&](int32 GlobalIndex, const FGaussianSplattingPoint& Point, const FVector& Offset) {
+			const FVector Cell = (Offset + FVector(Point.Position) - Root.Min) * Quantize;
+			const uint32 X = (uint32)FMath::Clamp(FMath::FloorToInt32(Cell.X), 0, Resolution - 1);
+			const uint32 Y = (uint32)FMath::Clamp(FMath::FloorToInt32(Cell.Y), 0, Resolution - 1);
+			const uint32 Z = (uint32)FMath::Clamp(FMath::FloorToInt32(Cell.Z), 0, Resolution - 1);
+			Keys[GlobalIndex] = (SpreadMortonBits(X) << 2) | (SpreadMortonBits(Y) << 1) | SpreadMortonBits(Z);
+			Order[GlobalIndex] = GlobalIndex;
+		});
+	});
+	GaussianSplattingSort::RadixSort(Keys, Order);
+	Stats.SortSeconds = FPlatformTime::Seconds() - StageStart;
+
+	// Nodes over budget are split into their octants, found by binary search in the sorted codes.
+	StageStart = FPlatformTime::Seconds();
+	const int64 BytesPerPoint = GetPointBytes(1);
+	const int32 PointBudget = FMath::Max(Settings.MaxBytesPerCell > 0 ? (int32)FMath::Min((int64)Settings.MaxPointsPerCell, Settings.MaxBytesPerCell / BytesPerPoint) : Settings.MaxPointsPerCell, 1);
+	const int32 MaxDepth = FMath::Clamp(Settings.MaxDepth, 0, MaxOctreeDepth);
+	TFunction<void(int32, int32, int32, uint32)> SplitNode = [&](int32 Begin, int32 End, int32 Depth, uint32 Path) {
+		if (End - Begin <= PointBudget || Depth == MaxDepth) {
+			FOctreeCell& Cell = OutCells.Cells.AddDefaulted_GetRef();
+			Cell.Depth = Depth;
+			Cell.Path = Path;
+			const double NodeSize = 2.0 * HalfSize / (1 << Depth);
+			FVector NodeMin = Root.Min;
+			for (int32 Level = 0; Level < Depth; Level++) {
+				const uint32 Octant = (Path >> (3 * (Depth - 1 - Level))) & 7;
+				const double LevelSize = 2.0 * HalfSize / (2 << Level);
+				NodeMin += FVector((Octant >> 2) & 1, (Octant >> 1) & 1, Octant & 1) * LevelSize;
+			}
+			Cell.Bounds = FBox(NodeMin, NodeMin + FVector(NodeSize));
+			OutCells.CellStarts.Add(Begin);
+			return;
+		}
+		const int32 Shift = 3 * (MaxOctreeDepth - 1 - Depth);
+		const TConstArrayView<uint32> NodeKeys(Keys.GetData() + Begin, End - Begin);
+		int32 ChildBegin = Begin;
+		for (uint32 Octant = 0; Octant < 8; Octant++) {
+			const uint32 ChildPrefix = ((Path << 3) | Octant) + 1;
+			const int32 ChildEnd = Octant == 7 ? End : Begin + Algo::LowerBound(NodeKeys, ChildPrefix << Shift);
+			if (ChildEnd > ChildBegin) {
+				SplitNode(ChildBegin, ChildEnd, Depth + 1, (Path << 3) | Octant);
+			}
+			ChildBegin = ChildEnd;
+		}
+	};
+	SplitNode(0, (int32)NumPoints, 0, 0);
+	OutCells.CellStarts.Add((int32)NumPoints);
+
+	OutCells.Points.SetNumUninitialized((int32)NumPoints);
+	ParallelFor(TEXT("GaussianSplatting.OctreeScatter"), NumBlocks, 1, [&](int32 BlockIndex) {
+		const int32 Begin = BlockIndex * PointsPerBlock;
+		const int32 End = FMath::Min(Begin + PointsPerBlock, (int32)NumPoints);
+		int32 CellIndex = Algo::UpperBound(OutCells.CellStarts, Begin) - 1;
+		for (int32 i = Begin; i < End; i++) {
+			while (i >= OutCells.CellStarts[CellIndex + 1]) {
+				CellIndex++;
+			}
+			const int32 GlobalIndex = (int32)Order[i];
+			const int32 SourceIndex = Algo::UpperBound(SourceStarts, GlobalIndex) - 1;
+			const FSource& Source = Sources[SourceIndex];
+			FGaussianSplattingPoint& CellPoint = OutCells.Points[i];
+			CellPoint = Source.Points[GlobalIndex - SourceStarts[SourceIndex]];
+			CellPoint.Position = FVector3f(Source.Offset + FVector(CellPoint.Position) - OutCells.Cells[CellIndex].Bounds.GetCenter());
+		}
+	});
+	Stats.ScatterSeconds = FPlatformTime::Seconds() - StageStart;
+	Stats.NumBlocks = NumBlocks;
+	if (OutStats) {
+		*OutStats = Stats;
+	}
+}
+
+void GaussianSplattingBinning::RemoveOverlaps(TConstArrayView<FSource> Sources, const FOverlapSettings& Settings, TArray<TArray<FGaussianSplattingPoint>>& OutPoints, TArray<FSource>& OutSources, FOverlapStats* OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingBinning::RemoveOverlaps);
+	const double StartTime = FPlatformTime::Seconds();
+	FOverlapStats Stats;
+	OutPoints.Reset();
+	OutPoints.SetNum(Sources.Num());
+	OutSources = TArray<FSource>(Sources);
+	TArray<int32> SourceStarts;
+	if (Settings.Mode == EOverlapMode::Keep || Settings.CellSize <= 0.0 || Sources.Num() < 2 || !GetSourceStarts(Sources, SourceStarts)) {
+		if (OutStats) {
+			*OutStats = Stats;
+		}
+		return;
+	}
+	const int64 NumPoints = SourceStarts.Last();
+
+	// Every source only competes with the sources whose bounds come within a cell of its own.
+	TArray<FBox> SourceBounds;
+	SourceBounds.Init(FBox(ForceInit), Sources.Num());
+	ParallelFor(TEXT("GaussianSplatting.OverlapBounds"), Sources.Num(), 1, [&](int32 SourceIndex) {
+		for (const FGaussianSplattingPoint& Point : Sources[SourceIndex].Points) {
+			SourceBounds[SourceIndex] += Sources[SourceIndex].Offset + FVector(Point.Position);
+		}
+	});
+	TArray<FBox> GrownBounds;
+	TArray<TArray<int32>> Neighbors;
+	Neighbors.SetNum(Sources.Num());
+	for (const FBox& Bounds : SourceBounds) {
+		GrownBounds.Add(Bounds.IsValid ? Bounds.ExpandBy(Settings.CellSize) : Bounds);
+	}
+	for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); SourceIndex++) {
+		for (int32 OtherIndex = 0; OtherIndex < Sources.Num(); OtherIndex++) {
+			if (OtherIndex != SourceIndex && GrownBounds[SourceIndex].IsValid && SourceBounds[OtherIndex].IsValid && GrownBounds[OtherIndex].Intersect(SourceBounds[SourceIndex])) {
+				Neighbors[SourceIndex].Add(OtherIndex);
+			}
+		}
+	}
+
+	// Only the points within a cell of another source can share a cell with its points, the others are never hashed.
+	const int32 NumWorkers = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	const int32 NumBlocks = FMath::Clamp((int32)FMath::DivideAndRoundUp(NumPoints, (int64)65536), 1, NumWorkers * 4);
+	const int32 PointsPerBlock = (int32)FMath::DivideAndRoundUp(NumPoints, (int64)NumBlocks);
+	TArray<TArray<int32>> BlockCandidates;
+	BlockCandidates.SetNum(NumBlocks);
+	ParallelFor(TEXT("GaussianSplatting.OverlapCandidates"), NumBlocks, 1, [&](int32 BlockIndex) {
+		const int32 Begin = BlockIndex * PointsPerBlock;
+		ForEachSourcePoint(Sources, SourceStarts, Begin, FMath::Min(Begin + PointsPerBlock, (int32)NumPoints), [&](int32 GlobalIndex, const FGaussianSplattingPoint& Point, const FVector& Offset) {
+			const int32 SourceIndex = Algo::UpperBound(SourceStarts, GlobalIndex) - 1;
+			const FVector Position = Offset + FVector(Point.Position);
+			for (int32 OtherIndex : Neighbors[SourceIndex]) {
+				if (GrownBounds[OtherIndex].IsInsideOrOn(Position)) {
+					BlockCandidates[BlockIndex].Add(GlobalIndex);
+					break;
+				}
+			}
+		});
+	});
+	TArray<int32> CandidateIndices;
+	for (const TArray<int32>& Candidates : BlockCandidates) {
+		CandidateIndices.Append(Candidates);
+	}
+	BlockCandidates.Empty();
+	const int32 NumCandidates = CandidateIndices.Num();
+
+	struct FCandidate
+	{
+		FVector Position;
+		FIntVector Cell;
+		int32 SourceIndex;
+	};
+	TArray<FCandidate> Candidates;
+	TArray<uint32> Keys;
+	TArray<uint32> Order;
+	Candidates.SetNumUninitialized(NumCandidates);
+	Keys.SetNumUninitialized(NumCandidates);
+	Order.SetNumUninitialized(NumCandidates);
+	const double InvCellSize = 1.0 / Settings.CellSize;
+	ParallelFor(TEXT("GaussianSplatting.OverlapHash"), NumCandidates, 65536, [&](int32 i) {
+		const int32 SourceIndex = Algo::UpperBound(SourceStarts, CandidateIndices[i]) - 1;
+		FCandidate& Candidate = Candidates[i];
+		Candidate.SourceIndex = SourceIndex;
+		Candidate.Position = Sources[SourceIndex].Offset + FVector(Sources[SourceIndex].Points[CandidateIndices[i] - SourceStarts[SourceIndex]].Position);
+		Candidate.Cell = FIntVector(
+			FMath::FloorToInt32(FMath::Clamp(Candidate.Position.X * InvCellSize, -1.0e9, 1.0e9)),
+			FMath::FloorToInt32(FMath::Clamp(Candidate.Position.Y * InvCellSize, -1.0e9, 1.0e9)),
+			FMath::FloorToInt32(FMath::Clamp(Candidate.Position.Z * InvCellSize, -1.0e9, 1.0e9)));
+		Keys[i] = HashOverlapCell(Candidate.Cell);
+		Order[i] = i;
+	});
+	GaussianSplattingSort::RadixSort(Keys, Order);
+
+	// Runs of equal keys are sorted by cell when their cells collide, so every cell is a contiguous group of the order.
+	TArray<int32> RunStarts;
+	for (int32 i = 0; i < NumCandidates; i++) {
+		if (i == 0 || Keys[i] != Keys[i - 1]) {
+			RunStarts.Add(i);
+		}
+	}
+	RunStarts.Add(NumCandidates);
+	ParallelFor(TEXT("GaussianSplatting.OverlapCollisions"), RunStarts.Num() - 1, 1024, [&](int32 RunIndex) {
+		const TArrayView<uint32> Run(Order.GetData() + RunStarts[RunIndex], RunStarts[RunIndex + 1] - RunStarts[RunIndex]);
+		for (uint32 Entry : Run) {
+			if (Candidates[Entry].Cell != Candidates[Run[0]].Cell) {
+				Algo::Sort(Run, [&](uint32 A, uint32 B) { return IsOverlapCellLess(Candidates[A].Cell, Candidates[B].Cell); });
+				break;
+			}
+		}
+	});
+	TArray<int32> GroupStarts;
+	TArray<uint32> GroupKeys;
+	for (int32 i = 0; i < NumCandidates; i++) {
+		if (i == 0 || Candidates[Order[i]].Cell != Candidates[Order[i - 1]].Cell) {
+			GroupStarts.Add(i);
+			GroupKeys.Add(Keys[i]);
+		}
+	}
+	GroupStarts.Add(NumCandidates);
+
+	// The source nearer to its center wins, ties go to the first source so the result does not depend on the threads.
+	auto IsOwnerOf = [&](int32 SourceIndex, int32 OtherIndex, const FVector& Position) {
+		const double Distance = FVector::DistSquared(Sources[SourceIndex].Offset, Position);
+		const double OtherDistance = FVector::DistSquared(Sources[OtherIndex].Offset, Position);
+		return Distance < OtherDistance || (Distance == OtherDistance && SourceIndex < OtherIndex);
+	};
+	TArray<uint8> Removed;
+	Removed.SetNumZeroed(NumCandidates);
+	if (Settings.Mode == EOverlapMode::Ownership) {
+		ParallelFor(TEXT("GaussianSplatting.OverlapOwnership"), GroupKeys.Num(), 1024, [&](int32 GroupIndex) {
+			const TConstArrayView<uint32> Group(Order.GetData() + GroupStarts[GroupIndex], GroupStarts[GroupIndex + 1] - GroupStarts[GroupIndex]);
+			const FVector CellCenter = (FVector(Candidates[Group[0]].Cell) + 0.5) * Settings.CellSize;
+			int32 Owner = Candidates[Group[0]].SourceIndex;
+			for (uint32 Entry : Group) {
+				Owner = IsOwnerOf(Candidates[Entry].SourceIndex, Owner, CellCenter) ? Candidates[Entry].SourceIndex : Owner;
+			}
+			for (uint32 Entry : Group) {
+				Removed[Entry] = Candidates[Entry].SourceIndex != Owner ? 1 : 0;
+			}
+		});
+	}
+	else {
+		// Pairs are owned at their midpoint, so exactly one point of every similar pair is removed.
+		const double MaxDistanceSquared = FMath::Square(Settings.CellSize);
+		ParallelFor(TEXT("GaussianSplatting.OverlapSimilarity"), NumCandidates, 1024, [&](int32 i) {
+			const FCandidate& Candidate = Candidates[i];
+			const FGaussianSplattingPoint& Point = Sources[Candidate.SourceIndex].Points[CandidateIndices[i] - SourceStarts[Candidate.SourceIndex]];
+			const float Size = Point.Scale.Length();
+			for (int32 Neighbor = 0; Neighbor < 27 && !Removed[i]; Neighbor++) {
+				const FIntVector Cell = Candidate.Cell + FIntVector(Neighbor % 3 - 1, (Neighbor / 3) % 3 - 1, Neighbor / 9 - 1);
+				const uint32 Key = HashOverlapCell(Cell);
+				for (int32 GroupIndex = Algo::LowerBound(GroupKeys, Key); GroupIndex < GroupKeys.Num() && GroupKeys[GroupIndex] == Key && !Removed[i]; GroupIndex++) {
+					if (Candidates[Order[GroupStarts[GroupIndex]]].Cell != Cell) {
+						continue;
+					}
+					for (int32 j = GroupStarts[GroupIndex]; j < GroupStarts[GroupIndex + 1]; j++) {
+						const FCandidate& Other = Candidates[Order[j]];
+						if (Other.SourceIndex == Candidate.SourceIndex || FVector::DistSquared(Other.Position, Candidate.Position) > MaxDistanceSquared) {
+							continue;
+						}
+						const FGaussianSplattingPoint& OtherPoint = Sources[Other.SourceIndex].Points[CandidateIndices[Order[j]] - SourceStarts[Other.SourceIndex]];
+						const FLinearColor ColorDelta = OtherPoint.Color - Point.Color;
+						const float OtherSize = OtherPoint.Scale.Length();
+						const bool bSimilar = FMath::Max(FMath::Max(FMath::Abs(ColorDelta.R), FMath::Abs(ColorDelta.G)), FMath::Max(FMath::Abs(ColorDelta.B), FMath::Abs(ColorDelta.A))) <= Settings.MaxColorDistance
+							&& Size * Settings.MaxScaleRatio >= OtherSize && OtherSize * Settings.MaxScaleRatio >= Size;
+						if (bSimilar && IsOwnerOf(Other.SourceIndex, Candidate.SourceIndex, (Other.Position + Candidate.Position) * 0.5)) {
+							Removed[i] = 1;
+							break;
+						}
+					}
+				}
+			}
+		});
+	}
+
+	// Candidates are in the order of the sources, so every source copies the ranges between its removed points.
+	TArray<int32> SourceRemoved;
+	SourceRemoved.SetNumZeroed(Sources.Num());
+	ParallelFor(TEXT("GaussianSplatting.OverlapCompact"), Sources.Num(), 1, [&](int32 SourceIndex) {
+		const int32 First = Algo::LowerBound(CandidateIndices, SourceStarts[SourceIndex]);
+		const int32 Last = Algo::LowerBound(CandidateIndices, SourceStarts[SourceIndex + 1]);
+		for (int32 i = First; i < Last; i++) {
+			SourceRemoved[SourceIndex] += Removed[i];
+		}
+		if (SourceRemoved[SourceIndex] == 0) {
+			return;
+		}
+		const TConstArrayView<FGaussianSplattingPoint> Points = Sources[SourceIndex].Points;
+		TArray<FGaussianSplattingPoint>& Kept = OutPoints[SourceIndex];
+		Kept.Reserve(Points.Num() - SourceRemoved[SourceIndex]);
+		int32 Next = 0;
+		for (int32 i = First; i < Last; i++) {
+			if (Removed[i]) {
+				const int32 LocalIndex = CandidateIndices[i] - SourceStarts[SourceIndex];
+				Kept.Append(Points.GetData() + Next, LocalIndex - Next);
+				Next = LocalIndex + 1;
+			}
+		}
+		Kept.Append(Points.GetData() + Next, Points.Num() - Next);
+		OutSources[SourceIndex].Points = Kept;
+	});
+	Stats.NumCandidates = NumCandidates;
+	for (int32 Count : SourceRemoved) {
+		Stats.NumRemoved += Count;
+	}
+	Stats.Seconds = FPlatformTime::Seconds() - StartTime;
+	if (OutStats) {
+		*OutStats = Stats;
+	}
+}
@@ -0,0 +1,425 @@
+#include "GaussianSplattingBudgetSubsystem.h"
+#include "GaussianSplattingPointCloudDataInterface.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "ConvexVolume.h"
+
+static TAutoConsoleVariable<int32> CVarGaussianSplattingBudgetMaxPoints(
+	TEXT("r.GaussianSplatting.Budget.MaxPoints"),
+	0,
+	TEXT("Total number of splats drawn per frame across all point cloud components in a world. 0 disables the budget."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplattingBudgetMinPointsPerComponent(
+	TEXT("r.GaussianSplatting.Budget.MinPointsPerComponent"),
+	1024,
+	TEXT("Minimum number of splats kept for every registered component, so far cells never disappear entirely."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarGaussianSplattingBudgetMaxDistance(
+	TEXT("r.GaussianSplatting.Budget.MaxDistance"),
+	0.0f,
+	TEXT("Components farther than this from every view only receive the minimum share. 0 means unlimited."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<bool> CVarGaussianSplattingStreamingEnable(
+	TEXT("r.GaussianSplatting.Streaming.Enable"),
+	true,
+	TEXT("Stream point cloud segments in and out by screen size in game worlds. Editor worlds always keep every segment resident."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarGaussianSplattingStreamingFullDetailScreenSize(
+	TEXT("r.GaussianSplatting.Streaming.FullDetailScreenSize"),
+	0.5f,
+	TEXT("Ratio between the bounding sphere radius and the view distance from which a point cloud needs all of its segments."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarGaussianSplattingStreamingHysteresis(
+	TEXT("r.GaussianSplatting.Streaming.Hysteresis"),
+	1.25f,
+	TEXT("A resident segment is only released once the wanted point count drops below its start by this factor."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<bool> CVarGaussianSplattingLODEnable(
+	TEXT("r.GaussianSplatting.LOD.Enable"),
+	true,
+	TEXT("Show the coarser levels of point clouds that have them by distance in game worlds, and stream out their full detail segments meanwhile."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarGaussianSplattingLODMaxScreenError(
+	TEXT("r.GaussianSplatting.LOD.MaxScreenError"),
+	0.002f,
+	TEXT("Ratio between the error of a level and the view distance up to which the level is shown. Coarser levels use the streaming hysteresis too."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<bool> CVarGaussianSplattingCullingEnable(
+	TEXT("r.GaussianSplatting.Culling.Enable"),
+	true,
+	TEXT("Cull point cloud chunks against the player camera frustums and only expose the visible ones to the simulation."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarGaussianSplattingCullingMaxDistance(
+	TEXT("r.GaussianSplatting.Culling.MaxDistance"),
+	0.0f,
+	TEXT("Chunks farther than this from the camera are culled. 0 means unlimited."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<bool> CVarGaussianSplattingCullingTemporal(
+	TEXT("r.GaussianSplatting.Culling.Temporal"),
+	true,
+	TEXT("Only expose the chunks of 4D point clouds that are active at the current playback time."),
+	ECVF_Scalability);
+
+void GaussianSplattingBudget::Allocate(TConstArrayView<FGaussianSplattingBudgetRequest> Requests, int64 TotalBudget, int32 MinPointsPerRequest, TArray<int32>& OutPointCounts)
+{
+	const int32 NumRequests = Requests.Num();
+	OutPointCounts.SetNumZeroed(NumRequests);
+	if (NumRequests == 0) {
+		return;
+	}
+
+	int64 TotalPoints = 0;
+	for (const FGaussianSplattingBudgetRequest& Request : Requests) {
+		TotalPoints += FMath::Max(Request.PointCount, 0);
+	}
+	if (TotalPoints <= TotalBudget) {
+		for (int32 i = 0; i < NumRequests; i++) {
+			OutPointCounts[i] = FMath::Max(Requests[i].PointCount, 0);
+		}
+		return;
+	}
+
+	int64 Remaining = FMath::Max<int64>(TotalBudget, 0);
+	const int64 MinShare = FMath::Min<int64>(FMath::Max(MinPointsPerRequest, 0), Remaining / NumRequests);
+	TArray<int32> Active;
+	Active.Reserve(NumRequests);
+	for (int32 i = 0; i < NumRequests; i++) {
+		const int32 PointCount = FMath::Max(Requests[i].PointCount, 0);
+		OutPointCounts[i] = (int32)FMath::Min<int64>(PointCount, MinShare);
+		Remaining -= OutPointCounts[i];
+		if (OutPointCounts[i] < PointCount && Requests[i].ScreenCoverage > 0.0f) {
+			Active.Add(i);
+		}
+	}
+
+	// Water filling: hand out the remaining budget proportionally to coverage, and whenever a request saturates
+	// give its surplus back to the pool and start over with the remaining requests.
+	TArray<int64> Shares;
+	TArray<double> Remainders;
+	while (Remaining > 0 && !Active.IsEmpty()) {
+		double TotalWeight = 0.0;
+		for (int32 Index : Active) {
+			TotalWeight += Requests[Index].ScreenCoverage;
+		}
+
+		// Saturating a request only grows the shares of the others, so all of them can be resolved in one pass.
+		const int64 PassRemaining = Remaining;
+		bool bSaturated = false;
+		for (int32 ActiveIndex = Active.Num() - 1; ActiveIndex >= 0; ActiveIndex--) {
+			const int32 Index = Active[ActiveIndex];
+			const double Share = PassRemaining * (Requests[Index].ScreenCoverage / TotalWeight);
+			const int64 Missing = Requests[Index].PointCount - OutPointCounts[Index];
+			if (Share >= Missing) {
+				OutPointCounts[Index] = Requests[Index].PointCount;
+				Remaining -= Missing;
+				Active.RemoveAt(ActiveIndex);
+				bSaturated = true;
+			}
+		}
+		if (bSaturated) {
+			continue;
+		}
+
+		Shares.SetNumUninitialized(Active.Num());
+		Remainders.SetNumUninitialized(Active.Num());
+		int64 Distributed = 0;
+		for (int32 ActiveIndex = 0; ActiveIndex < Active.Num(); ActiveIndex++) {
+			const double Share = Remaining * (Requests[Active[ActiveIndex]].ScreenCoverage / TotalWeight);
+			Shares[ActiveIndex] = (int64)Share;
+			Remainders[ActiveIndex] = Share - Shares[ActiveIndex];
+			Distributed += Shares[ActiveIndex];
+		}
+
+		// Largest remainder rounding, ties resolved by request order.
+		TArray<int32> Order;
+		Order.SetNumUninitialized(Active.Num());
+		for (int32 ActiveIndex = 0; ActiveIndex < Active.Num(); ActiveIndex++) {
+			Order[ActiveIndex] = ActiveIndex;
+		}
+		Algo::StableSort(Order, [&Remainders](int32 A, int32 B) {
+			return Remainders[A] > Remainders[B];
+		});
+		for (int32 i = 0; i < Order.Num() && Distributed < Remaining; i++) {
+			Shares[Order[i]]++;
+			Distributed++;
+		}
+
+		for (int32 ActiveIndex = 0; ActiveIndex < Active.Num(); ActiveIndex++) {
+			const int32 Index = Active[ActiveIndex];
+			OutPointCounts[Index] = (int32)FMath::Min<int64>(Requests[Index].PointCount, OutPointCounts[Index] + Shares[ActiveIndex]);
+		}
+		Remaining = 0;
+	}
+}
+
+void UGaussianSplattingBudgetSubsystem::Register(UNiagaraDataInterfaceGaussianSplattingPointCloud* DataInterface, USceneComponent* Component, FNiagaraSystemInstanceID InstanceID)
+{
+	Unregister(InstanceID);
+	Entries.Add({ InstanceID, DataInterface, Component });
+}
+
+void UGaussianSplattingBudgetSubsystem::Unregister(FNiagaraSystemInstanceID InstanceID)
+{
+	Entries.RemoveAll([InstanceID](const FEntry& Entry) {
+		return Entry.InstanceID == InstanceID;
+	});
+}
+
+void UGaussianSplattingBudgetSubsystem::Tick(float DeltaTime)
+{
+	Entries.RemoveAll([](const FEntry& Entry) {
+		return !Entry.DataInterface.IsValid() || !Entry.Component.IsValid();
+	});
+
+	const int32 MaxPoints = CVarGaussianSplattingBudgetMaxPoints.GetValueOnGameThread();
+	const bool bStreaming = CVarGaussianSplattingStreamingEnable.GetValueOnGameThread() && GetWorld()->IsGameWorld();
+	const TArray<FVector>& ViewLocations = GetWorld()->ViewLocationsRenderedLastFrame;
+	const float MaxDistance = CVarGaussianSplattingBudgetMaxDistance.GetValueOnGameThread();
+
+	TArray<FGaussianSplattingBudgetRequest> Requests;
+	TArray<float> ScreenRatios;
+	TArray<float> LODDistances;
+	Requests.Reserve(Entries.Num());
+	ScreenRatios.Reserve(Entries.Num());
+	LODDistances.Reserve(Entries.Num());
+	for (const FEntry& Entry : Entries) {
+		FGaussianSplattingBudgetRequest& Request = Requests.AddDefaulted_GetRef();
+		float& ScreenRatio = ScreenRatios.Add_GetRef(0.0f);
+		// Distance from the nearest view to the bounds, in the units of the points. Components out of sight get the coarsest level.
+		float& LODDistance = LODDistances.Add_GetRef(UE_MAX_FLT);
+		UGaussianSplattingPointCloud* PointCloud = Entry.DataInterface->GetPointCloud();
+		Request.PointCount = PointCloud ? PointCloud->GetTotalPointCount() : 0;
+
+		const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Entry.Component.Get());
+		if (Primitive && !Primitive->WasRecentlyRendered(0.2f)) {
+			continue;
+		}
+
+		// The projected area of the bounding sphere, up to the field of view term which cancels out in the allocation.
+		const FBoxSphereBounds& Bounds = Entry.Component->Bounds;
+		const double Radius = FMath::Max(Bounds.SphereRadius, 1.0);
+		const double Scale = FMath::Max(Entry.Component->GetComponentTransform().GetMaximumAxisScale(), UE_SMALL_NUMBER);
+		if (ViewLocations.IsEmpty()) {
+			ScreenRatio = 1.0f;
+			LODDistance = 0.0f;
+		}
+		for (const FVector& ViewLocation : ViewLocations) {
+			const double Distance = FVector::Distance(ViewLocation, Bounds.Origin);
+			LODDistance = FMath::Min(LODDistance, (float)(FMath::Max(Distance - Radius, 0.0) / Scale));
+			if (MaxDistance > 0.0f && Distance - Radius > MaxDistance) {
+				continue;
+			}
+			ScreenRatio = FMath::Max(ScreenRatio, (float)(Radius / FMath::Max(Distance, Radius)));
+		}
+		Request.ScreenCoverage = ScreenRatio * ScreenRatio;
+	}
+
+	TArray<int32> PointCounts;
+	if (MaxPoints > 0) {
+		GaussianSplattingBudget::Allocate(Requests, MaxPoints, CVarGaussianSplattingBudgetMinPointsPerComponent.GetValueOnGameThread(), PointCounts);
+	}
+	else {
+		PointCounts.SetNumUninitialized(Requests.Num());
+		for (int32 i = 0; i < Requests.Num(); i++) {
+			PointCounts[i] = Requests[i].PointCount;
+		}
+	}
+
+	// A data interface or point cloud shared by several system instances keeps the largest of their shares and the finest of their levels.
+	TMap<UNiagaraDataInterfaceGaussianSplattingPointCloud*, int32> Budgets;
+	TMap<UNiagaraDataInterfaceGaussianSplattingPointCloud*, int32> DisplayedLODs;
+	TMap<UGaussianSplattingPointCloud*, int32> RequestedLODs;
+	TMap<UGaussianSplattingPointCloud*, int32> ResidentSegments;
+	const float FullDetailScreenSize = FMath::Max(CVarGaussianSplattingStreamingFullDetailScreenSize.GetValueOnGameThread(), UE_SMALL_NUMBER);
+	const float Hysteresis = FMath::Max(CVarGaussianSplattingStreamingHysteresis.GetValueOnGameThread(), 1.0f);
+	const bool bLOD = CVarGaussianSplattingLODEnable.GetValueOnGameThread() && GetWorld()->IsGameWorld();
+	const float MaxScreenError = FMath::Max(CVarGaussianSplattingLODMaxScreenError.GetValueOnGameThread(), 0.0f);
+	for (int32 i = 0; i < Entries.Num(); i++) {
+		UNiagaraDataInterfaceGaussianSplattingPointCloud* DataInterface = Entries[i].DataInterface.Get();
+		int32& Budget = Budgets.FindOrAdd(DataInterface, 0);
+		Budget = FMath::Max(Budget, PointCounts[i]);
+
+		UGaussianSplattingPointCloud* PointCloud = DataInterface->GetPointCloud();
+		if (PointCloud == nullptr) {
+			continue;
+		}
+		int32 LOD = 0;
+		if (bLOD && PointCloud->GetNumLODs() > 1) {
+			// Only switch to a coarser level once it would still be selected closer by the hysteresis factor.
+			LOD = PointCloud->SelectLOD(LODDistances[i], MaxScreenError);
+			if (LOD > DataInterface->GetLOD()) {
+				LOD = FMath::Max(DataInterface->GetLOD(), PointCloud->SelectLOD(LODDistances[i] / Hysteresis, MaxScreenError));
+			}
+		}
+		int32& DisplayedLOD = DisplayedLODs.FindOrAdd(DataInterface, MAX_int32);
+		DisplayedLOD = FMath::Min(DisplayedLOD, LOD);
+		int32& RequestedLOD = RequestedLODs.FindOrAdd(PointCloud, MAX_int32);
+		RequestedLOD = FMath::Min(RequestedLOD, LOD);
+
+		if (PointCloud->GetNumSegments() == 0) {
+			continue;
+		}
+		int32 NumSegments = PointCloud->GetNumSegments();
+		if (bStreaming) {
+			// Detail grows with the projected area, so a cloud at half the full detail screen size needs a quarter of its points.
+			const float DetailRatio = FMath::Min(ScreenRatios[i] / FullDetailScreenSize, 1.0f);
+			const int32 WantedPoints = FMath::Min(PointCounts[i], FMath::CeilToInt32(Requests[i].PointCount * DetailRatio * DetailRatio));
+			NumSegments = PointCloud->GetSegmentCountForPoints(WantedPoints);
+			if (NumSegments < PointCloud->GetResidentSegmentCount()) {
+				NumSegments = PointCloud->GetSegmentCountForPoints(FMath::CeilToInt32(WantedPoints * Hysteresis));
+			}
+			// The full detail segments are not drawn while a coarser level is displayed and stays wanted.
+			if (LOD > 0 && DataInterface->GetLOD() > 0) {
+				NumSegments = 1;
+			}
+		}
+		int32& Segments = ResidentSegments.FindOrAdd(PointCloud, 0);
+		Segments = FMath::Max(Segments, NumSegments);
+	}
+	for (const auto& Segments : ResidentSegments) {
+		Segments.Key->RequestResidentSegments(Segments.Value);
+	}
+	for (const auto& RequestedLOD : RequestedLODs) {
+		RequestedLOD.Key->RequestLOD(RequestedLOD.Value);
+	}
+	for (const auto& DisplayedLOD : DisplayedLODs) {
+		// Returning to the full cloud waits for its segments, a coarser level waits for its points inside SetLOD.
+		UGaussianSplattingPointCloud* PointCloud = DisplayedLOD.Key->GetPointCloud();
+		const int32* Segments = ResidentSegments.Find(PointCloud);
+		if (DisplayedLOD.Value == 0 && Segments && PointCloud->GetResidentSegmentCount() < *Segments) {
+			continue;
+		}
+		DisplayedLOD.Key->SetLOD(DisplayedLOD.Value);
+	}
+	for (const auto& Budget : Budgets) {
+		Budget.Key->SetPointBudget(MaxPoints > 0 ? Budget.Value : INDEX_NONE);
+	}
+
+	UpdateVisibleRanges();
+}
+
+void UGaussianSplattingBudgetSubsystem::UpdateVisibleRanges()
+{
+	// The view origins also drive the CPU sort, which does not depend on culling.
+	const bool bCulling = CVarGaussianSplattingCullingEnable.GetValueOnGameThread();
+	TArray<FConvexVolume> Frustums;
+	TArray<FVector> ViewOrigins;
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator) {
+		const APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController == nullptr || !PlayerController->IsLocalController() || PlayerController->PlayerCameraManager == nullptr) {
+			continue;
+		}
+		const FMinimalViewInfo ViewInfo = PlayerController->PlayerCameraManager->GetCameraCacheView();
+		if (bCulling) {
+			FMatrix ViewMatrix, ProjectionMatrix, ViewProjectionMatrix;
+			UGameplayStatics::GetViewProjectionMatrix(ViewInfo, ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+			GetViewFrustumBounds(Frustums.AddDefaulted_GetRef(), ViewProjectionMatrix, false);
+		}
+		ViewOrigins.Add(ViewInfo.Location);
+	}
+
+	// Culling needs a single transform, a data interface shared by several components exposes all of its points.
+	// Its CPU sort still follows the first of them.
+	TMap<UNiagaraDataInterfaceGaussianSplattingPointCloud*, const FEntry*> CulledEntries;
+	TMap<UNiagaraDataInterfaceGaussianSplattingPointCloud*, const FEntry*> SortedEntries;
+	for (const FEntry& Entry : Entries) {
+		if (const FEntry** Existing = CulledEntries.Find(Entry.DataInterface.Get())) {
+			*Existing = nullptr;
+		}
+		else {
+			CulledEntries.Add(Entry.DataInterface.Get(), &Entry);
+			SortedEntries.Add(Entry.DataInterface.Get(), &Entry);
+		}
+	}
+	auto GetLocalViewOrigin = [&ViewOrigins](const FEntry* Entry) {
+		const USceneComponent* Component = Entry ? Entry->Component.Get() : nullptr;
+		return Component && !ViewOrigins.IsEmpty() ? TOptional<FVector3f>(FVector3f(Component->GetComponentTransform().InverseTransformPosition(ViewOrigins[0]))) : TOptional<FVector3f>();
+	};
+
+	const float MaxDistance = CVarGaussianSplattingCullingMaxDistance.GetValueOnGameThread();
+	const bool bTemporalCulling = CVarGaussianSplattingCullingTemporal.GetValueOnGameThread();
+	TArray<FConvexVolume> LocalFrustums;
+	TArray<int32> VisibleChunks;
+	TArray<FVector2f> ActiveTimeRanges;
+	for (const auto& CulledEntry : CulledEntries) {
+		UNiagaraDataInterfaceGaussianSplattingPointCloud* DataInterface = CulledEntry.Key;
+		UGaussianSplattingPointCloud* PointCloud = DataInterface->GetPointCloud();
+		const FEntry* Entry = CulledEntry.Value;
+		// Playback components also hand over the upcoming clip times, so chunks about to appear are exposed before they are needed.
+		DataInterface->GetActiveTimeRanges(ActiveTimeRanges);
+		const bool bTemporal = bTemporalCulling && PointCloud && PointCloud->GetChunkHierarchy().HasTemporalIndex() && !ActiveTimeRanges.IsEmpty();
+		// Coarser levels are small whole clouds without chunks, they are drawn entirely.
+		if (Entry == nullptr || PointCloud == nullptr || DataInterface->GetLOD() > 0 || PointCloud->GetChunkHierarchy().IsEmpty() || (Frustums.IsEmpty() && !bTemporal)) {
+			DataInterface->SetVisibleRanges({}, INDEX_NONE);
+			const TOptional<FVector3f> LocalViewOrigin = GetLocalViewOrigin(SortedEntries.FindRef(DataInterface));
+			DataInterface->UpdateCPUSortOrder(LocalViewOrigin.GetPtrOrNull());
+			continue;
+		}
+
+		// Move the frustums into the space of the points instead of moving every chunk into world space.
+		const FTransform& ComponentTransform = Entry->Component->GetComponentTransform();
+		const FMatrix WorldToLocal = ComponentTransform.ToInverseMatrixWithScale();
+		LocalFrustums.Reset();
+		for (const FConvexVolume& Frustum : Frustums) {
+			FConvexVolume& LocalFrustum = LocalFrustums.AddDefaulted_GetRef();
+			for (const FPlane& Plane : Frustum.Planes) {
+				LocalFrustum.Planes.Add(Plane.TransformBy(WorldToLocal));
+			}
+			LocalFrustum.Init();
+		}
+
+		// Distance culling only supports the first view, split screen keeps the frustum test.
+		const TOptional<FVector3f> LocalViewOrigin = GetLocalViewOrigin(Entry);
+		float LocalMaxDistance = 0.0f;
+		if (LocalViewOrigin.IsSet() && bCulling) {
+			LocalMaxDistance = ViewOrigins.Num() == 1 && MaxDistance > 0.0f ? MaxDistance / FMath::Max(ComponentTransform.GetMaximumAxisScale(), UE_SMALL_NUMBER) : 0.0f;
+		}
+
+		const FGaussianSplattingChunkHierarchy& Hierarchy = PointCloud->GetChunkHierarchy();
+		Hierarchy.Cull(LocalFrustums, LocalViewOrigin.Get(FVector3f::ZeroVector), LocalMaxDistance, PointCloud->GetResidentSegmentCount(), VisibleChunks, bTemporal ? TConstArrayView<FVector2f>(ActiveTimeRanges) : TConstArrayView<FVector2f>());
+
+		// The budget keeps whole chunks in coarse-to-fine order before they are sorted, so it never drops the nearest ones.
+		const int32 PointBudget = DataInterface->GetPointBudget();
+		if (PointBudget != INDEX_NONE) {
+			int32 BudgetedPoints = 0;
+			int32 NumBudgetedChunks = 0;
+			for (; NumBudgetedChunks < VisibleChunks.Num(); NumBudgetedChunks++) {
+				BudgetedPoints += Hierarchy.GetChunks()[VisibleChunks[NumBudgetedChunks]].NumPoints;
+				if (BudgetedPoints > PointBudget) {
+					break;
+				}
+			}
+			VisibleChunks.SetNum(NumBudgetedChunks);
+		}
+		TArray<FUintVector4> VisibleRanges;
+		const int32 VisiblePointCount = LocalViewOrigin.IsSet() ? Hierarchy.BuildSortedRanges(VisibleChunks, LocalViewOrigin.GetValue(), VisibleRanges) : Hierarchy.BuildVisibleRanges(VisibleChunks, VisibleRanges);
+		if (VisibleRanges.IsEmpty()) {
+			// Keep the indirection active with an empty range so nothing is drawn.
+			VisibleRanges.Add(FUintVector4(0, 0, 1, 0));
+		}
+		DataInterface->SetVisibleRanges(MoveTemp(VisibleRanges), VisiblePointCount);
+		DataInterface->UpdateCPUSortOrder(LocalViewOrigin.GetPtrOrNull());
+	}
+}
+
+TStatId UGaussianSplattingBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGaussianSplattingBudgetSubsystem, STATGROUP_Tickables);
+}
+
+bool UGaussianSplattingBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE || WorldType == EWorldType::Editor;
+}
@@ -0,0 +1,548 @@
+#include "GaussianSplattingChunkHierarchy.h"
+#include "GaussianSplattingPointCloud.h"
+#include "Async/ParallelFor.h"
+#include "ConvexVolume.h"
+#include "GaussianSplattingSorter.h"
+
+static uint32 ExpandMortonBits(uint32 Value)
+{
+	Value &= 0x3FF;
+	Value = (Value | (Value << 16)) & 0x030000FF;
+	Value = (Value | (Value << 8)) & 0x0300F00F;
+	Value = (Value | (Value << 4)) & 0x030C30C3;
+	Value = (Value | (Value << 2)) & 0x09249249;
+	return Value;
+}
+
+static uint32 EncodeMorton(const FVector3f& Position, const FBox3f& Bounds)
+{
+	const FVector3f Size = Bounds.GetSize();
+	const FVector3f Normalized = (Position - Bounds.Min) / FVector3f::Max(Size, FVector3f(UE_SMALL_NUMBER));
+	const uint32 X = (uint32)FMath::Clamp(Normalized.X * 1024.0f, 0.0f, 1023.0f);
+	const uint32 Y = (uint32)FMath::Clamp(Normalized.Y * 1024.0f, 0.0f, 1023.0f);
+	const uint32 Z = (uint32)FMath::Clamp(Normalized.Z * 1024.0f, 0.0f, 1023.0f);
+	return (ExpandMortonBits(X) << 2) | (ExpandMortonBits(Y) << 1) | ExpandMortonBits(Z);
+}
+
+static void GetActiveInterval(const FGaussianSplattingPoint& Point, float& OutBegin, float& OutEnd)
+{
+	// Matches the visibility term of the data interface HLSL, exp(-((t - Time.x) / exp(Time.y))^2).
+	const float HalfWidth = FGaussianSplattingChunkHierarchy::TemporalCutoff * FMath::Exp(Point.Time.Y);
+	OutBegin = Point.Time.X - HalfWidth;
+	OutEnd = Point.Time.X + HalfWidth;
+}
+
+static TArray<FVector3f> MakeSortDirections(int32 NumDirections)
+{
+	// Fibonacci points on the upper hemisphere, the lower one is covered by reading the orders backwards.
+	TArray<FVector3f> Directions;
+	Directions.SetNumUninitialized(NumDirections);
+	const float GoldenAngle = UE_PI * (3.0f - FMath::Sqrt(5.0f));
+	for (int32 i = 0; i < NumDirections; i++) {
+		const float Z = 1.0f - (i + 0.5f) / NumDirections;
+		const float Radius = FMath::Sqrt(1.0f - Z * Z);
+		Directions[i] = FVector3f(Radius * FMath::Cos(GoldenAngle * i), Radius * FMath::Sin(GoldenAngle * i), Z);
+	}
+	return Directions;
+}
+
+void FGaussianSplattingChunkHierarchy::Build(TConstArrayView<FGaussianSplattingPoint> Points, TConstArrayView<int32> SegmentEnds, int32 ChunkSize /*= DefaultChunkSize*/, int32 NumSortDirections /*= DefaultNumSortDirections*/)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGaussianSplattingChunkHierarchy::Build);
+	Reset();
+	const int32 NumPoints = SegmentEnds.IsEmpty() ? 0 : SegmentEnds.Last();
+	check(NumPoints <= Points.Num());
+	// Baked orders store chunk-local offsets on 16 bits.
+	ChunkSize = FMath::Clamp(ChunkSize, 1, (int32)MAX_uint16 + 1);
+
+	PointIndices.SetNumUninitialized(NumPoints);
+	TArray<uint32> Keys;
+	Keys.SetNumUninitialized(NumPoints);
+
+	const int32 BlockSize = 64 * 1024;
+
+	// Static clouds keep all-zero time and motion, only 4D clouds get a temporal index.
+	const int32 NumPointBlocks = FMath::DivideAndRoundUp(NumPoints, BlockSize);
+	TArray<FVector2f> BlockTimeRanges;
+	BlockTimeRanges.Init(FVector2f(UE_MAX_FLT, -UE_MAX_FLT), NumPointBlocks);
+	TArray<bool> BlockTemporal;
+	BlockTemporal.Init(false, NumPointBlocks);
+	ParallelFor(NumPointBlocks, [&](int32 BlockIndex) {
+		const int32 End = FMath::Min((BlockIndex + 1) * BlockSize, NumPoints);
+		for (int32 i = BlockIndex * BlockSize; i < End; i++) {
+			BlockTemporal[BlockIndex] |= Points[i].Time != FVector4f::Zero() || Points[i].Motion != FVector4f::Zero();
+			BlockTimeRanges[BlockIndex].X = FMath::Min(BlockTimeRanges[BlockIndex].X, Points[i].Time.X);
+			BlockTimeRanges[BlockIndex].Y = FMath::Max(BlockTimeRanges[BlockIndex].Y, Points[i].Time.X);
+		}
+	});
+	const bool bTemporal = BlockTemporal.Contains(true);
+	if (bTemporal) {
+		FVector2f TimeRange(UE_MAX_FLT, -UE_MAX_FLT);
+		for (const FVector2f& BlockTimeRange : BlockTimeRanges) {
+			TimeRange.X = FMath::Min(TimeRange.X, BlockTimeRange.X);
+			TimeRange.Y = FMath::Max(TimeRange.Y, BlockTimeRange.Y);
+		}
+		SlabStart = TimeRange.X;
+		SlabDuration = FMath::Max((TimeRange.Y - TimeRange.X) / NumTimeSlabs, UE_KINDA_SMALL_NUMBER);
+		// Playback starts at zero and the last splat center ends the clip, the motion polynomials are only swept over that window.
+		SweptTimeRange = FVector2f(FMath::Min(0.0f, TimeRange.X), TimeRange.Y);
+	}
+	// Splats only move while they are visible, so sweeping over the active interval is enough.
+	auto GetSweptInterval = [this](const FGaussianSplattingPoint& Point, float& OutBegin, float& OutEnd) {
+		GetActiveInterval(Point, OutBegin, OutEnd);
+		OutBegin = FMath::Clamp(OutBegin, SweptTimeRange.X, SweptTimeRange.Y);
+		OutEnd = FMath::Clamp(OutEnd, SweptTimeRange.X, SweptTimeRange.Y);
+	};
+
+	int32 SegmentBegin = 0;
+	for (int32 SegmentIndex = 0; SegmentIndex < SegmentEnds.Num(); SegmentIndex++) {
+		const int32 SegmentEnd = SegmentEnds[SegmentIndex];
+		const int32 SegmentCount = SegmentEnd - SegmentBegin;
+
+		const int32 NumBlocks = FMath::DivideAndRoundUp(SegmentCount, BlockSize);
+		TArray<FBox3f> BlockBounds;
+		BlockBounds.Init(FBox3f(ForceInit), NumBlocks);
+		ParallelFor(NumBlocks, [&](int32 BlockIndex) {
+			const int32 Begin = SegmentBegin + BlockIndex * BlockSize;
+			const int32 End = FMath::Min(Begin + BlockSize, SegmentEnd);
+			for (int32 i = Begin; i < End; i++) {
+				BlockBounds[BlockIndex] += Points[i].Position;
+			}
+		});
+		FBox3f SegmentBounds(ForceInit);
+		for (const FBox3f& Bounds : BlockBounds) {
+			SegmentBounds += Bounds;
+		}
+
+		// The radix sort is stable, so points with equal keys keep their coarse-to-fine order.
+		// 4D clouds put the time slab of the splat center above a coarser Morton code.
+		ParallelFor(SegmentCount, [&](int32 i) {
+			const int32 PointIndex = SegmentBegin + i;
+			const uint32 Morton = EncodeMorton(Points[PointIndex].Position, SegmentBounds);
+			Keys[PointIndex] = bTemporal ? ((uint32)GetTimeSlab(Points[PointIndex].Time.X) << 24) | (Morton >> 6) : Morton;
+			PointIndices[PointIndex] = PointIndex;
+		});
+		GaussianSplattingSort::RadixSort(MakeArrayView(Keys.GetData() + SegmentBegin, SegmentCount), MakeArrayView(PointIndices.GetData() + SegmentBegin, SegmentCount));
+
+		const int32 FirstChunk = Chunks.Num();
+		const int32 NumSegmentChunks = FMath::DivideAndRoundUp(SegmentCount, ChunkSize);
+		Chunks.AddDefaulted(NumSegmentChunks);
+		ParallelFor(NumSegmentChunks, [&](int32 i) {
+			FGaussianSplattingChunk& Chunk = Chunks[FirstChunk + i];
+			Chunk.FirstIndex = SegmentBegin + i * ChunkSize;
+			Chunk.NumPoints = FMath::Min(ChunkSize, SegmentEnd - Chunk.FirstIndex);
+			Chunk.Segment = SegmentIndex;
+			if (bTemporal) {
+				Chunk.ActiveBegin = UE_MAX_FLT;
+				Chunk.ActiveEnd = -UE_MAX_FLT;
+			}
+			for (uint32 PointIndex : GetChunkPointIndices(FirstChunk + i)) {
+				const FGaussianSplattingPoint& Point = Points[PointIndex];
+				if (bTemporal) {
+					float ActiveBegin, ActiveEnd;
+					GetActiveInterval(Point, ActiveBegin, ActiveEnd);
+					Chunk.ActiveBegin = FMath::Min(Chunk.ActiveBegin, ActiveBegin);
+					Chunk.ActiveEnd = FMath::Max(Chunk.ActiveEnd, ActiveEnd);
+					float SweptBegin, SweptEnd;
+					GetSweptInterval(Point, SweptBegin, SweptEnd);
+					Chunk.Bounds += Point.GetSweptBounds(SweptBegin, SweptEnd);
+				}
+				else {
+					const FVector3f Extent(3.0f * Point.Scale.GetAbsMax());
+					Chunk.Bounds += FBox3f(Point.Position - Extent, Point.Position + Extent);
+				}
+			}
+		});
+
+		SegmentChunkEnds.Add(Chunks.Num());
+		SegmentRoots.Add(NumSegmentChunks > 0 ? BuildNodes(FirstChunk, Chunks.Num()) : INDEX_NONE);
+		SegmentBegin = SegmentEnd;
+	}
+
+	if (bTemporal) {
+		SlabChunkOffsets.Init(0, NumTimeSlabs + 1);
+		for (const FGaussianSplattingChunk& Chunk : Chunks) {
+			for (int32 Slab = GetTimeSlab(Chunk.ActiveBegin); Slab <= GetTimeSlab(Chunk.ActiveEnd); Slab++) {
+				SlabChunkOffsets[Slab + 1]++;
+			}
+		}
+		for (int32 Slab = 0; Slab < NumTimeSlabs; Slab++) {
+			SlabChunkOffsets[Slab + 1] += SlabChunkOffsets[Slab];
+		}
+		SlabChunks.SetNumUninitialized(SlabChunkOffsets.Last());
+		TArray<int32> SlabFill(SlabChunkOffsets.GetData(), NumTimeSlabs);
+		// Entries of every chunk in the slab lists, for chunk i starting at ChunkEntries[ChunkEntryOffsets[i]] with its first slab.
+		TArray<int32> ChunkEntryOffsets;
+		TArray<int32> ChunkEntries;
+		ChunkEntryOffsets.SetNumUninitialized(Chunks.Num());
+		ChunkEntries.Reserve(SlabChunks.Num());
+		for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ChunkIndex++) {
+			ChunkEntryOffsets[ChunkIndex] = ChunkEntries.Num();
+			for (int32 Slab = GetTimeSlab(Chunks[ChunkIndex].ActiveBegin); Slab <= GetTimeSlab(Chunks[ChunkIndex].ActiveEnd); Slab++) {
+				ChunkEntries.Add(SlabFill[Slab]);
+				SlabChunks[SlabFill[Slab]++] = ChunkIndex;
+			}
+		}
+
+		SlabChunkBounds.Init(FBox3f(ForceInit), SlabChunks.Num());
+		ParallelFor(Chunks.Num(), [&](int32 ChunkIndex) {
+			const int32 FirstSlab = GetTimeSlab(Chunks[ChunkIndex].ActiveBegin);
+			for (uint32 PointIndex : GetChunkPointIndices(ChunkIndex)) {
+				const FGaussianSplattingPoint& Point = Points[PointIndex];
+				float SweptBegin, SweptEnd;
+				GetSweptInterval(Point, SweptBegin, SweptEnd);
+				for (int32 Slab = GetTimeSlab(SweptBegin); Slab <= GetTimeSlab(SweptEnd); Slab++) {
+					// The outer slabs also hold the times before the first and after the last splat center.
+					const float SlabBegin = Slab == 0 ? SweptTimeRange.X : SlabStart + Slab * SlabDuration;
+					const float SlabEnd = Slab == NumTimeSlabs - 1 ? SweptTimeRange.Y : SlabStart + (Slab + 1) * SlabDuration;
+					const float Begin = FMath::Max(SweptBegin, SlabBegin);
+					const float End = FMath::Max(FMath::Min(SweptEnd, SlabEnd), Begin);
+					SlabChunkBounds[ChunkEntries[ChunkEntryOffsets[ChunkIndex] + Slab - FirstSlab]] += Point.GetSweptBounds(Begin, End);
+				}
+			}
+		});
+	}
+
+	SortDirections = MakeSortDirections(FMath::Max(NumSortDirections, 0) / 2);
+	const int32 NumStoredDirections = SortDirections.Num();
+	SortedOrders.SetNumUninitialized(NumStoredDirections * NumPoints);
+	ParallelFor(TEXT("GaussianSplatting.BakeSortedOrders"), Chunks.Num() * NumStoredDirections, 1, [&](int32 JobIndex) {
+		const int32 ChunkIndex = JobIndex / NumStoredDirections;
+		const int32 DirectionIndex = JobIndex % NumStoredDirections;
+		const FVector3f& Direction = SortDirections[DirectionIndex];
+		const TConstArrayView<uint32> ChunkPoints = GetChunkPointIndices(ChunkIndex);
+
+		TArray<float, TInlineAllocator<DefaultChunkSize>> Depths;
+		TArray<uint16, TInlineAllocator<DefaultChunkSize>> Order;
+		Depths.SetNumUninitialized(ChunkPoints.Num());
+		Order.SetNumUninitialized(ChunkPoints.Num());
+		for (int32 i = 0; i < ChunkPoints.Num(); i++) {
+			Depths[i] = Direction | Points[ChunkPoints[i]].Position;
+			Order[i] = (uint16)i;
+		}
+		// Farthest along the view direction first, ties keep the coarse-to-fine order so the bake is deterministic.
+		Algo::Sort(Order, [&Depths](uint16 A, uint16 B) {
+			return Depths[A] > Depths[B] || (Depths[A] == Depths[B] && A < B);
+		});
+		FMemory::Memcpy(&SortedOrders[DirectionIndex * NumPoints + Chunks[ChunkIndex].FirstIndex], Order.GetData(), Order.Num() * sizeof(uint16));
+	});
+}
+
+int32 FGaussianSplattingChunkHierarchy::BuildNodes(int32 ChunkBegin, int32 ChunkEnd)
+{
+	// Chunks are already in Morton order, so halving the range gives a balanced hierarchy of coherent nodes.
+	const int32 NodeIndex = Nodes.AddDefaulted();
+	Nodes[NodeIndex].ChunkBegin = ChunkBegin;
+	Nodes[NodeIndex].ChunkEnd = ChunkEnd;
+	if (ChunkEnd - ChunkBegin == 1) {
+		Nodes[NodeIndex].Bounds = Chunks[ChunkBegin].Bounds;
+		return NodeIndex;
+	}
+	const int32 ChunkMid = (ChunkBegin + ChunkEnd) / 2;
+	const int32 Left = BuildNodes(ChunkBegin, ChunkMid);
+	const int32 Right = BuildNodes(ChunkMid, ChunkEnd);
+	FGaussianSplattingChunkNode& Node = Nodes[NodeIndex];
+	Node.Children[0] = Left;
+	Node.Children[1] = Right;
+	Node.Bounds = Nodes[Left].Bounds + Nodes[Right].Bounds;
+	return NodeIndex;
+}
+
+void FGaussianSplattingChunkHierarchy::Reset()
+{
+	Chunks.Reset();
+	Nodes.Reset();
+	SegmentChunkEnds.Reset();
+	SegmentRoots.Reset();
+	PointIndices.Reset();
+	SortDirections.Reset();
+	SortedOrders.Reset();
+	SlabStart = 0.0f;
+	SlabDuration = 0.0f;
+	SlabChunkOffsets.Reset();
+	SlabChunks.Reset();
+	SlabChunkBounds.Reset();
+	SweptTimeRange = FVector2f::ZeroVector;
+}
+
+int32 FGaussianSplattingChunkHierarchy::GetTimeSlab(float Time) const
+{
+	// Intervals reaching past the sequence fall into the first or last slab.
+	const float Slab = (Time - SlabStart) / FMath::Max(SlabDuration, UE_KINDA_SMALL_NUMBER);
+	return FMath::Clamp((int32)FMath::Clamp(Slab, 0.0f, (float)NumTimeSlabs), 0, NumTimeSlabs - 1);
+}
+
+TConstArrayView<int32> FGaussianSplattingChunkHierarchy::GetActiveChunkCandidates(float PlaybackTime) const
+{
+	if (!HasTemporalIndex()) {
+		return {};
+	}
+	const int32 Slab = GetTimeSlab(PlaybackTime);
+	return TConstArrayView<int32>(SlabChunks.GetData() + SlabChunkOffsets[Slab], SlabChunkOffsets[Slab + 1] - SlabChunkOffsets[Slab]);
+}
+
+void FGaussianSplattingChunkHierarchy::GetActiveChunkCandidates(TConstArrayView<FVector2f> TimeRanges, TArray<int32>& OutChunks, TArray<FBox3f>* OutBounds /*= nullptr*/) const
+{
+	OutChunks.Reset();
+	if (OutBounds) {
+		OutBounds->Reset();
+	}
+	if (!HasTemporalIndex()) {
+		return;
+	}
+	// Hierarchies saved before the per-slab bounds fall back to the bounds of the whole chunk.
+	const bool bSlabBounds = SlabChunkBounds.Num() == SlabChunks.Num();
+	auto GetEntryBounds = [this, bSlabBounds](int32 SlabChunk) -> const FBox3f& {
+		return bSlabBounds ? SlabChunkBounds[SlabChunk] : Chunks[SlabChunks[SlabChunk]].Bounds;
+	};
+	if (TimeRanges.Num() == 1 && GetTimeSlab(TimeRanges[0].X) == GetTimeSlab(TimeRanges[0].Y)) {
+		const int32 Slab = GetTimeSlab(TimeRanges[0].X);
+		OutChunks.Append(GetActiveChunkCandidates(TimeRanges[0].X));
+		if (OutBounds) {
+			for (int32 SlabChunk = SlabChunkOffsets[Slab]; SlabChunk < SlabChunkOffsets[Slab + 1]; SlabChunk++) {
+				OutBounds->Add(GetEntryBounds(SlabChunk));
+			}
+		}
+		return;
+	}
+
+	// Chunks spanning several slabs are listed in each of them.
+	TBitArray<> bCandidate(false, Chunks.Num());
+	TMap<int32, FBox3f> CandidateBounds;
+	for (const FVector2f& Range : TimeRanges) {
+		const int32 LastSlab = GetTimeSlab(FMath::Max(Range.X, Range.Y));
+		for (int32 Slab = GetTimeSlab(FMath::Min(Range.X, Range.Y)); Slab <= LastSlab; Slab++) {
+			for (int32 SlabChunk = SlabChunkOffsets[Slab]; SlabChunk < SlabChunkOffsets[Slab + 1]; SlabChunk++) {
+				bCandidate[SlabChunks[SlabChunk]] = true;
+				if (OutBounds) {
+					CandidateBounds.FindOrAdd(SlabChunks[SlabChunk], FBox3f(ForceInit)) += GetEntryBounds(SlabChunk);
+				}
+			}
+		}
+	}
+	for (TConstSetBitIterator<> It(bCandidate); It; ++It) {
+		OutChunks.Add(It.GetIndex());
+		if (OutBounds) {
+			OutBounds->Add(CandidateBounds.FindChecked(It.GetIndex()));
+		}
+	}
+}
+
+int32 FGaussianSplattingChunkHierarchy::GetNumChunksForSegments(int32 NumSegments) const
+{
+	NumSegments = FMath::Min(NumSegments, SegmentChunkEnds.Num());
+	return NumSegments > 0 ? SegmentChunkEnds[NumSegments - 1] : 0;
+}
+
+TConstArrayView<uint32> FGaussianSplattingChunkHierarchy::GetChunkPointIndices(int32 ChunkIndex) const
+{
+	const FGaussianSplattingChunk& Chunk = Chunks[ChunkIndex];
+	return TConstArrayView<uint32>(PointIndices.GetData() + Chunk.FirstIndex, Chunk.NumPoints);
+}
+
+FBox3f FGaussianSplattingChunkHierarchy::GetBounds(int32 NumSegments) const
+{
+	FBox3f Bounds(ForceInit);
+	for (int32 SegmentIndex = 0; SegmentIndex < FMath::Min(NumSegments, SegmentRoots.Num()); SegmentIndex++) {
+		if (SegmentRoots[SegmentIndex] != INDEX_NONE) {
+			Bounds += Nodes[SegmentRoots[SegmentIndex]].Bounds;
+		}
+	}
+	return Bounds;
+}
+
+FBox3f FGaussianSplattingChunkHierarchy::GetBounds(int32 NumSegments, TConstArrayView<FVector2f> TimeRanges) const
+{
+	if (!HasTemporalIndex() || TimeRanges.IsEmpty()) {
+		return GetBounds(NumSegments);
+	}
+	const int32 NumChunks = GetNumChunksForSegments(NumSegments);
+	TArray<int32> Candidates;
+	TArray<FBox3f> CandidateBounds;
+	GetActiveChunkCandidates(TimeRanges, Candidates, &CandidateBounds);
+	FBox3f Bounds(ForceInit);
+	for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); CandidateIndex++) {
+		if (Candidates[CandidateIndex] < NumChunks) {
+			Bounds += CandidateBounds[CandidateIndex];
+		}
+	}
+	return Bounds;
+}
+
+void FGaussianSplattingChunkHierarchy::Traverse(int32 NumSegments, TFunctionRef<EGaussianSplattingChunkTest(const FBox3f&)> TestBounds, TFunctionRef<void(int32 ChunkIndex, bool bFullyInside)> Visit) const
+{
+	TArray<int32, TInlineAllocator<64>> Stack;
+	for (int32 SegmentIndex = 0; SegmentIndex < FMath::Min(NumSegments, SegmentRoots.Num()); SegmentIndex++) {
+		if (SegmentRoots[SegmentIndex] == INDEX_NONE) {
+			continue;
+		}
+		Stack.Add(SegmentRoots[SegmentIndex]);
+		while (!Stack.IsEmpty()) {
+			const FGaussianSplattingChunkNode& Node = Nodes[Stack.Pop()];
+			const EGaussianSplattingChunkTest Result = TestBounds(Node.Bounds);
+			if (Result == EGaussianSplattingChunkTest::Outside) {
+				continue;
+			}
+			if (Result == EGaussianSplattingChunkTest::Inside || Node.IsLeaf()) {
+				for (int32 ChunkIndex = Node.ChunkBegin; ChunkIndex < Node.ChunkEnd; ChunkIndex++) {
+					Visit(ChunkIndex, Result == EGaussianSplattingChunkTest::Inside);
+				}
+				continue;
+			}
+			// Right first so the left child is popped next and chunks come out in Morton order.
+			Stack.Add(Node.Children[1]);
+			Stack.Add(Node.Children[0]);
+		}
+	}
+}
+
+void FGaussianSplattingChunkHierarchy::QueryBox(const FBox3f& Box, int32 NumSegments, TArray<int32>& OutChunks) const
+{
+	Traverse(NumSegments, [&Box](const FBox3f& Bounds) {
+		if (!Box.Intersect(Bounds)) {
+			return EGaussianSplattingChunkTest::Outside;
+		}
+		return Box.IsInside(Bounds) ? EGaussianSplattingChunkTest::Inside : EGaussianSplattingChunkTest::Intersects;
+	}, [&OutChunks](int32 ChunkIndex, bool bFullyInside) {
+		OutChunks.Add(ChunkIndex);
+	});
+}
+
+void FGaussianSplattingChunkHierarchy::Cull(TConstArrayView<FConvexVolume> Frustums, const FVector3f& ViewOrigin, float MaxDistance, int32 NumSegments, TArray<int32>& OutVisibleChunks, TConstArrayView<FVector2f> ActiveTimeRanges /*= {}*/) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGaussianSplattingChunkHierarchy::Cull);
+	const int32 NumChunks = GetNumChunksForSegments(NumSegments);
+	const float MaxDistanceSquared = MaxDistance > 0.0f ? MaxDistance * MaxDistance : UE_MAX_FLT;
+
+	// With a temporal index only the chunks of the overlapped time slabs are candidates, so long sequences cost what is active.
+	// Their bounds only cover the motion within the overlapped slabs, which keeps fast moving splats from inflating every test.
+	TArray<int32> Candidates;
+	TArray<FBox3f> CandidateBounds;
+	const bool bTemporal = !ActiveTimeRanges.IsEmpty() && HasTemporalIndex();
+	if (bTemporal) {
+		GetActiveChunkCandidates(ActiveTimeRanges, Candidates, &CandidateBounds);
+	}
+	else {
+		Candidates.SetNumUninitialized(NumChunks);
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++) {
+			Candidates[ChunkIndex] = ChunkIndex;
+		}
+	}
+
+	// Chunks are tested flat rather than through the hierarchy, a few thousand SIMD box tests spread over workers beat a serial walk.
+	TArray<uint8> Visible;
+	Visible.SetNumUninitialized(Candidates.Num());
+	ParallelFor(TEXT("GaussianSplatting.CullChunks"), Candidates.Num(), 256, [&](int32 CandidateIndex) {
+		const FGaussianSplattingChunk& Chunk = Chunks[Candidates[CandidateIndex]];
+		const FBox3f& Bounds = bTemporal ? CandidateBounds[CandidateIndex] : Chunk.Bounds;
+		bool bVisible = Candidates[CandidateIndex] < NumChunks && Bounds.ComputeSquaredDistanceToPoint(ViewOrigin) <= MaxDistanceSquared;
+		if (bVisible && bTemporal) {
+			bVisible = false;
+			for (const FVector2f& Range : ActiveTimeRanges) {
+				if (FMath::Max(Range.X, Range.Y) >= Chunk.ActiveBegin && FMath::Min(Range.X, Range.Y) <= Chunk.ActiveEnd) {
+					bVisible = true;
+					break;
+				}
+			}
+		}
+		if (bVisible && !Frustums.IsEmpty()) {
+			const FVector Origin(Bounds.GetCenter());
+			const FVector Extent(Bounds.GetExtent());
+			bVisible = false;
+			for (const FConvexVolume& Frustum : Frustums) {
+				if (Frustum.IntersectBox(Origin, Extent)) {
+					bVisible = true;
+					break;
+				}
+			}
+		}
+		Visible[CandidateIndex] = bVisible;
+	});
+
+	OutVisibleChunks.Reset();
+	for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); CandidateIndex++) {
+		if (Visible[CandidateIndex]) {
+			OutVisibleChunks.Add(Candidates[CandidateIndex]);
+		}
+	}
+}
+
+int32 FGaussianSplattingChunkHierarchy::BuildVisibleRanges(TConstArrayView<int32> VisibleChunks, TArray<FUintVector4>& OutRanges) const
+{
+	OutRanges.Reset();
+	uint32 NumVisiblePoints = 0;
+	for (int32 ChunkIndex : VisibleChunks) {
+		const FGaussianSplattingChunk& Chunk = Chunks[ChunkIndex];
+		if (!OutRanges.IsEmpty() && OutRanges.Last().Y + OutRanges.Last().Z == (uint32)Chunk.FirstIndex) {
+			OutRanges.Last().Z += Chunk.NumPoints;
+		}
+		else {
+			OutRanges.Add(FUintVector4(NumVisiblePoints, Chunk.FirstIndex, Chunk.NumPoints, 0));
+		}
+		NumVisiblePoints += Chunk.NumPoints;
+	}
+	return NumVisiblePoints;
+}
+
+uint32 FGaussianSplattingChunkHierarchy::FindSortOrder(const FVector3f& ViewDirection) const
+{
+	if (SortDirections.IsEmpty()) {
+		return 0;
+	}
+	int32 BestDirection = 0;
+	float BestDot = 0.0f;
+	for (int32 DirectionIndex = 0; DirectionIndex < SortDirections.Num(); DirectionIndex++) {
+		const float Dot = SortDirections[DirectionIndex] | ViewDirection;
+		if (FMath::Abs(Dot) > FMath::Abs(BestDot)) {
+			BestDirection = DirectionIndex;
+			BestDot = Dot;
+		}
+	}
+	return (BestDirection * 2 + (BestDot < 0.0f ? 1 : 0)) + 1;
+}
+
+int32 FGaussianSplattingChunkHierarchy::BuildSortedRanges(TConstArrayView<int32> VisibleChunks, const FVector3f& ViewOrigin, TArray<FUintVector4>& OutRanges) const
+{
+	if (SortDirections.IsEmpty()) {
+		return BuildVisibleRanges(VisibleChunks, OutRanges);
+	}
+
+	TArray<TPair<float, int32>> ChunkDistances;
+	ChunkDistances.Reserve(VisibleChunks.Num());
+	for (int32 ChunkIndex : VisibleChunks) {
+		ChunkDistances.Emplace(FVector3f::DistSquared(Chunks[ChunkIndex].Bounds.GetCenter(), ViewOrigin), ChunkIndex);
+	}
+	Algo::Sort(ChunkDistances, [](const TPair<float, int32>& A, const TPair<float, int32>& B) {
+		return A.Key > B.Key || (A.Key == B.Key && A.Value < B.Value);
+	});
+
+	OutRanges.Reset(ChunkDistances.Num());
+	uint32 NumVisiblePoints = 0;
+	for (const TPair<float, int32>& ChunkDistance : ChunkDistances) {
+		const FGaussianSplattingChunk& Chunk = Chunks[ChunkDistance.Value];
+		const FVector3f ViewDirection = (Chunk.Bounds.GetCenter() - ViewOrigin).GetSafeNormal();
+		OutRanges.Add(FUintVector4(NumVisiblePoints, Chunk.FirstIndex, Chunk.NumPoints, FindSortOrder(ViewDirection)));
+		NumVisiblePoints += Chunk.NumPoints;
+	}
+	return NumVisiblePoints;
+}
+
+uint32 FGaussianSplattingChunkHierarchy::MapVisibleIndex(TConstArrayView<FUintVector4> Ranges, uint32 Index) const
+{
+	if (Ranges.IsEmpty()) {
+		return Index;
+	}
+	const int32 RangeIndex = FMath::Max(Algo::UpperBoundBy(Ranges, Index, [](const FUintVector4& Range) { return Range.X; }) - 1, 0);
+	const FUintVector4& Range = Ranges[RangeIndex];
+	uint32 Offset = FMath::Min(Index - Range.X, Range.Z - 1);
+	if (Range.W > 0) {
+		const uint32 DirectionIndex = (Range.W - 1) >> 1;
+		if ((Range.W - 1) & 1) {
+			Offset = Range.Z - 1 - Offset;
+		}
+		const uint32 OrderEntry = DirectionIndex * PointIndices.Num() + Range.Y + Offset;
+		Offset = OrderEntry < (uint32)SortedOrders.Num() ? SortedOrders[OrderEntry] : Offset;
+	}
+	const uint32 Entry = Range.Y + Offset;
+	return Entry < (uint32)PointIndices.Num() ? PointIndices[Entry] : Index;
+}
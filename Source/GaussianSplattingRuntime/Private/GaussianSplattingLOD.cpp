@@ -0,0 +1,263 @@
+#include "GaussianSplattingLOD.h"
+#include "GaussianSplattingPointCloud.h"
+#include "GaussianSplattingSorter.h"
+#include "Async/ParallelFor.h"
+
+/** Merged Gaussian, with everything needed to merge it again into a coarser one. */
+struct FGaussianSplattingLODNode
+{
+	/** Coverage, opacity times the area of the splat, which also weights its moments. */
+	double Weight = 0.0;
+
+	FVector3d Mean = FVector3d::ZeroVector;
+
+	/** Second central moment as XX, XY, XZ, YY, YZ, ZZ, which includes the covariances of the merged splats. */
+	double Covariance[6] = {};
+
+	FVector3d Color = FVector3d::ZeroVector;
+
+	/** Largest distance between the mean and the center of an original splat below the node. */
+	double Deviation = 0.0;
+};
+
+static uint64 ExpandMortonBits64(uint64 Value)
+{
+	Value &= 0x1FFFFF;
+	Value = (Value | (Value << 32)) & 0x001F00000000FFFFull;
+	Value = (Value | (Value << 16)) & 0x001F0000FF0000FFull;
+	Value = (Value | (Value << 8)) & 0x100F00F00F00F00Full;
+	Value = (Value | (Value << 4)) & 0x10C30C30C30C30C3ull;
+	Value = (Value | (Value << 2)) & 0x1249249249249249ull;
+	return Value;
+}
+
+/** Ellipsoid area up to a constant, which cancels out between the coverage of the children and the one of the merged splat. */
+static double GetSplatArea(const FVector3d& Scale)
+{
+	return Scale.X * Scale.Y + Scale.Y * Scale.Z + Scale.Z * Scale.X;
+}
+
+static FGaussianSplattingLODNode MakeNode(const FGaussianSplattingPoint& Point)
+{
+	FGaussianSplattingLODNode Node;
+	const FVector3d Scale(Point.Scale);
+	Node.Weight = FMath::Max(Point.Color.A * GetSplatArea(Scale), UE_DOUBLE_SMALL_NUMBER);
+	Node.Mean = FVector3d(Point.Position);
+	Node.Color = FVector3d(Point.Color.R, Point.Color.G, Point.Color.B);
+	// Sum over the axes of the rotation of Scale^2 * Axis * Axis^T.
+	const FVector3d Axes[3] = { FVector3d(Point.Quat.GetAxisX()), FVector3d(Point.Quat.GetAxisY()), FVector3d(Point.Quat.GetAxisZ()) };
+	for (int32 k = 0; k < 3; k++) {
+		const double Variance = FMath::Square(Scale[k]);
+		Node.Covariance[0] += Variance * Axes[k].X * Axes[k].X;
+		Node.Covariance[1] += Variance * Axes[k].X * Axes[k].Y;
+		Node.Covariance[2] += Variance * Axes[k].X * Axes[k].Z;
+		Node.Covariance[3] += Variance * Axes[k].Y * Axes[k].Y;
+		Node.Covariance[4] += Variance * Axes[k].Y * Axes[k].Z;
+		Node.Covariance[5] += Variance * Axes[k].Z * Axes[k].Z;
+	}
+	return Node;
+}
+
+static FGaussianSplattingLODNode MergeNodes(TConstArrayView<FGaussianSplattingLODNode> Children)
+{
+	FGaussianSplattingLODNode Node;
+	for (const FGaussianSplattingLODNode& Child : Children) {
+		Node.Weight += Child.Weight;
+		Node.Mean += Child.Mean * Child.Weight;
+		Node.Color += Child.Color * Child.Weight;
+	}
+	Node.Mean /= Node.Weight;
+	Node.Color /= Node.Weight;
+	for (const FGaussianSplattingLODNode& Child : Children) {
+		const FVector3d D = Child.Mean - Node.Mean;
+		const double Spread[6] = { D.X * D.X, D.X * D.Y, D.X * D.Z, D.Y * D.Y, D.Y * D.Z, D.Z * D.Z };
+		for (int32 k = 0; k < 6; k++) {
+			Node.Covariance[k] += (Child.Covariance[k] + Spread[k]) * Child.Weight;
+		}
+		Node.Deviation = FMath::Max(Node.Deviation, Child.Deviation + D.Size());
+	}
+	for (int32 k = 0; k < 6; k++) {
+		Node.Covariance[k] /= Node.Weight;
+	}
+	return Node;
+}
+
+/** Cyclic Jacobi rotations, eigenvectors come out as the columns of Vectors. */
+static void SolveSymmetricEigen(const double Covariance[6], double OutValues[3], double Vectors[3][3])
+{
+	double A[3][3] = {
+		{ Covariance[0], Covariance[1], Covariance[2] },
+		{ Covariance[1], Covariance[3], Covariance[4] },
+		{ Covariance[2], Covariance[4], Covariance[5] },
+	};
+	for (int32 Row = 0; Row < 3; Row++) {
+		for (int32 Column = 0; Column < 3; Column++) {
+			Vectors[Row][Column] = Row == Column ? 1.0 : 0.0;
+		}
+	}
+	const double Scale = FMath::Square(A[0][0]) + FMath::Square(A[1][1]) + FMath::Square(A[2][2]);
+	for (int32 Sweep = 0; Sweep < 32; Sweep++) {
+		const double OffDiagonal = FMath::Square(A[0][1]) + FMath::Square(A[0][2]) + FMath::Square(A[1][2]);
+		if (OffDiagonal <= 1e-24 * Scale) {
+			break;
+		}
+		for (int32 p = 0; p < 2; p++) {
+			for (int32 q = p + 1; q < 3; q++) {
+				if (A[p][q] == 0.0) {
+					continue;
+				}
+				const double Theta = (A[q][q] - A[p][p]) / (2.0 * A[p][q]);
+				const double T = (Theta >= 0.0 ? 1.0 : -1.0) / (FMath::Abs(Theta) + FMath::Sqrt(Theta * Theta + 1.0));
+				const double C = 1.0 / FMath::Sqrt(T * T + 1.0);
+				const double S = T * C;
+				for (int32 k = 0; k < 3; k++) {
+					const double Akp = A[k][p];
+					const double Akq = A[k][q];
+					A[k][p] = C * Akp - S * Akq;
+					A[k][q] = S * Akp + C * Akq;
+				}
+				for (int32 k = 0; k < 3; k++) {
+					const double Apk = A[p][k];
+					const double Aqk = A[q][k];
+					A[p][k] = C * Apk - S * Aqk;
+					A[q][k] = S * Apk + C * Aqk;
+				}
+				for (int32 k = 0; k < 3; k++) {
+					const double Vkp = Vectors[k][p];
+					const double Vkq = Vectors[k][q];
+					Vectors[k][p] = C * Vkp - S * Vkq;
+					Vectors[k][q] = S * Vkp + C * Vkq;
+				}
+			}
+		}
+	}
+	for (int32 k = 0; k < 3; k++) {
+		OutValues[k] = A[k][k];
+	}
+}
+
+static FGaussianSplattingPoint MakePoint(const FGaussianSplattingLODNode& Node)
+{
+	double Values[3];
+	double Vectors[3][3];
+	SolveSymmetricEigen(Node.Covariance, Values, Vectors);
+	FVector3d Axes[3];
+	for (int32 k = 0; k < 3; k++) {
+		Axes[k] = FVector3d(Vectors[0][k], Vectors[1][k], Vectors[2][k]).GetSafeNormal();
+	}
+	// The rotation of the splat must be proper, a reflection flips the last axis, which leaves the covariance unchanged.
+	if (FVector3d::DotProduct(FVector3d::CrossProduct(Axes[0], Axes[1]), Axes[2]) < 0.0) {
+		Axes[2] = -Axes[2];
+	}
+	const FVector3d Scale(FMath::Sqrt(FMath::Max(Values[0], 0.0)), FMath::Sqrt(FMath::Max(Values[1], 0.0)), FMath::Sqrt(FMath::Max(Values[2], 0.0)));
+
+	// Rows of the matrix are the images of the unit axes, which is what FQuat4f::RotateVector reproduces.
+	FGaussianSplattingPoint Point;
+	Point.Position = FVector3f(Node.Mean);
+	Point.Quat = FQuat4f(FMatrix44f(FVector3f(Axes[0]), FVector3f(Axes[1]), FVector3f(Axes[2]), FVector3f::ZeroVector)).GetNormalized();
+	Point.Scale = FVector3f(Scale);
+	// The merged splat keeps the coverage of its children, the opacity saturates when they overlap more than it can cover.
+	const double Opacity = FMath::Min(Node.Weight / FMath::Max(GetSplatArea(Scale), UE_DOUBLE_SMALL_NUMBER), 1.0);
+	Point.Color = FLinearColor((float)Node.Color.X, (float)Node.Color.Y, (float)Node.Color.Z, (float)Opacity);
+	return Point;
+}
+
+void GaussianSplattingLOD::BuildLevels(TConstArrayView<FGaussianSplattingPoint> Points, const FSettings& Settings, TArray<TArray<FGaussianSplattingPoint>>& OutLevels, TArray<FGaussianSplattingLODLevel>& OutLevelInfos)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingLOD::BuildLevels);
+	const int32 NumPoints = Points.Num();
+	if (NumPoints <= Settings.MinPoints || Settings.MaxLevels <= 0) {
+		return;
+	}
+
+	// Cell coordinates on 21 bits per axis, a cell at a coarser level is a prefix of the Morton codes of the cells it contains.
+	FBox3f Bounds(ForceInit);
+	for (const FGaussianSplattingPoint& Point : Points) {
+		Bounds += Point.Position;
+	}
+	const FVector3f CellScale = FVector3f((1 << 21) - 1) / FVector3f::Max(Bounds.GetSize(), FVector3f(UE_SMALL_NUMBER));
+	TArray<uint64> Codes;
+	TArray<uint32> LowKeys;
+	TArray<uint32> Order;
+	Codes.SetNumUninitialized(NumPoints);
+	LowKeys.SetNumUninitialized(NumPoints);
+	Order.SetNumUninitialized(NumPoints);
+	ParallelFor(TEXT("GaussianSplatting.LODCodes"), NumPoints, 4096, [&](int32 i) {
+		const FVector3f Cell = (Points[i].Position - Bounds.Min) * CellScale;
+		Codes[i] = (ExpandMortonBits64((uint64)Cell.X) << 2) | (ExpandMortonBits64((uint64)Cell.Y) << 1) | ExpandMortonBits64((uint64)Cell.Z);
+		LowKeys[i] = (uint32)Codes[i];
+		Order[i] = i;
+	});
+
+	// Two passes of the stable 32-bit radix sort order the points by the full 63-bit codes.
+	GaussianSplattingSort::RadixSort(LowKeys, Order);
+	TArray<uint32> HighKeys;
+	HighKeys.SetNumUninitialized(NumPoints);
+	ParallelFor(TEXT("GaussianSplatting.LODCodes"), NumPoints, 4096, [&](int32 i) {
+		HighKeys[i] = (uint32)(Codes[Order[i]] >> 32);
+	});
+	GaussianSplattingSort::RadixSort(HighKeys, Order);
+	LowKeys.Empty();
+	HighKeys.Empty();
+
+	TArray<FGaussianSplattingLODNode> Nodes;
+	TArray<uint64> NodeCodes;
+	Nodes.SetNumUninitialized(NumPoints);
+	NodeCodes.SetNumUninitialized(NumPoints);
+	ParallelFor(TEXT("GaussianSplatting.LODNodes"), NumPoints, 4096, [&](int32 i) {
+		Nodes[i] = MakeNode(Points[Order[i]]);
+		NodeCodes[i] = Codes[Order[i]];
+	});
+	Codes.Empty();
+	Order.Empty();
+
+	double Error = 0.0;
+	int32 Shift = 0;
+	TArray<int32> RunStarts;
+	for (int32 Level = 0; Level < Settings.MaxLevels && Nodes.Num() > Settings.MinPoints; Level++) {
+		// Climbs the octree one depth at a time until the cells merge enough nodes.
+		const int32 TargetNodes = FMath::Max(FMath::FloorToInt32(Nodes.Num() / FMath::Max(Settings.ReductionRatio, 1.0f)), 1);
+		for (Shift += 3; Shift < 63; Shift += 3) {
+			int32 NumRuns = 1;
+			for (int32 i = 1; i < NodeCodes.Num() && NumRuns <= TargetNodes; i++) {
+				NumRuns += (NodeCodes[i] >> Shift) != (NodeCodes[i - 1] >> Shift) ? 1 : 0;
+			}
+			if (NumRuns <= TargetNodes) {
+				break;
+			}
+		}
+		if (Shift >= 63) {
+			break;
+		}
+		RunStarts.Reset();
+		for (int32 i = 0; i < NodeCodes.Num(); i++) {
+			if (i == 0 || (NodeCodes[i] >> Shift) != (NodeCodes[i - 1] >> Shift)) {
+				RunStarts.Add(i);
+			}
+		}
+		RunStarts.Add(NodeCodes.Num());
+
+		const int32 NumRuns = RunStarts.Num() - 1;
+		TArray<FGaussianSplattingLODNode> MergedNodes;
+		TArray<uint64> MergedCodes;
+		TArray<FGaussianSplattingPoint>& LevelPoints = OutLevels.AddDefaulted_GetRef();
+		MergedNodes.SetNumUninitialized(NumRuns);
+		MergedCodes.SetNumUninitialized(NumRuns);
+		LevelPoints.SetNumUninitialized(NumRuns);
+		ParallelFor(TEXT("GaussianSplatting.LODMerge"), NumRuns, 256, [&](int32 Run) {
+			const int32 Begin = RunStarts[Run];
+			MergedNodes[Run] = MergeNodes(MakeArrayView(Nodes.GetData() + Begin, RunStarts[Run + 1] - Begin));
+			MergedCodes[Run] = NodeCodes[Begin];
+			LevelPoints[Run] = MakePoint(MergedNodes[Run]);
+		});
+		Nodes = MoveTemp(MergedNodes);
+		NodeCodes = MoveTemp(MergedCodes);
+
+		for (const FGaussianSplattingLODNode& Node : Nodes) {
+			Error = FMath::Max(Error, Node.Deviation);
+		}
+		FGaussianSplattingLODLevel& Info = OutLevelInfos.AddDefaulted_GetRef();
+		Info.Error = (float)Error;
+		Info.NumPoints = NumRuns;
+	}
+}
@@ -0,0 +1,218 @@
+#include "GaussianSplattingPlaybackComponent.h"
+#include "GaussianSplattingPointCloudDataInterface.h"
+#include "GaussianSplattingPointCloud.h"
+#include "GaussianSplattingSequence.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+
+UGaussianSplattingPlaybackComponent::UGaussianSplattingPlaybackComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+	bTickInEditor = true;
+}
+
+float UGaussianSplattingPlaybackComponent::EvaluateTime(float RawTime, float Duration, EGaussianSplattingLoopMode LoopMode)
+{
+	if (Duration <= 0.0f || !FMath::IsFinite(RawTime)) {
+		return 0.0f;
+	}
+	switch (LoopMode) {
+	case EGaussianSplattingLoopMode::Loop:
+		return FMath::Clamp(RawTime - Duration * FMath::FloorToFloat(RawTime / Duration), 0.0f, Duration);
+	case EGaussianSplattingLoopMode::PingPong: {
+		const float Period = 2.0f * Duration;
+		const float Phase = FMath::Clamp(RawTime - Period * FMath::FloorToFloat(RawTime / Period), 0.0f, Period);
+		return Phase <= Duration ? Phase : Period - Phase;
+	}
+	default:
+		return FMath::Clamp(RawTime, 0.0f, Duration);
+	}
+}
+
+void UGaussianSplattingPlaybackComponent::Play()
+{
+	bPlaying = true;
+}
+
+void UGaussianSplattingPlaybackComponent::Pause()
+{
+	bPlaying = false;
+	PushPlaybackTime();
+}
+
+void UGaussianSplattingPlaybackComponent::SetTime(float RawTime)
+{
+	// Scrubbing hands the new time over right away instead of waiting for the next tick.
+	Time = RawTime;
+	PushPlaybackTime();
+}
+
+float UGaussianSplattingPlaybackComponent::GetPlaybackTime() const
+{
+	return EvaluateTime(Time, GetDuration(), LoopMode);
+}
+
+float UGaussianSplattingPlaybackComponent::GetDuration() const
+{
+	return Sequence ? Sequence->GetDuration() : Duration;
+}
+
+void UGaussianSplattingPlaybackComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	const bool bGameWorld = GetWorld() && GetWorld()->IsGameWorld();
+	if (bPlaying && bGameWorld) {
+		Time += DeltaTime * PlayRate;
+		if (LoopMode == EGaussianSplattingLoopMode::Once && (PlayRate > 0.0f ? Time >= GetDuration() : Time <= 0.0f)) {
+			Time = FMath::Clamp(Time, 0.0f, GetDuration());
+			bPlaying = false;
+		}
+	}
+	PushPlaybackTime();
+}
+
+void UGaussianSplattingPlaybackComponent::OnUnregister()
+{
+	ReleaseSequence();
+	// The clouds go back to wrapping the system age instead of staying frozen at the last pushed time.
+	if (const AActor* Owner = GetOwner()) {
+		TArray<UNiagaraComponent*> NiagaraComponents;
+		Owner->GetComponents(NiagaraComponents);
+		for (UNiagaraComponent* NiagaraComponent : NiagaraComponents) {
+			if (UNiagaraDataInterfaceGaussianSplattingPointCloud* DI = UNiagaraFunctionLibrary::GetDataInterface<UNiagaraDataInterfaceGaussianSplattingPointCloud>(NiagaraComponent, "PointCloud")) {
+				DI->ClearPlaybackTime();
+			}
+		}
+	}
+	FixedBounds.Reset();
+	Super::OnUnregister();
+}
+
+void UGaussianSplattingPlaybackComponent::SetFixedBounds(UNiagaraComponent* NiagaraComponent, const FBox& Bounds)
+{
+	FBox& LastBounds = FixedBounds.FindOrAdd(NiagaraComponent, FBox(ForceInit));
+	if (LastBounds != Bounds) {
+		LastBounds = Bounds;
+		NiagaraComponent->SetSystemFixedBounds(Bounds);
+	}
+}
+
+void UGaussianSplattingPlaybackComponent::PushPlaybackTime()
+{
+	const AActor* Owner = GetOwner();
+	if (Owner == nullptr) {
+		return;
+	}
+	TArray<UNiagaraComponent*> NiagaraComponents;
+	Owner->GetComponents(NiagaraComponents);
+	if (Sequence) {
+		PushSequenceFrames(NiagaraComponents);
+		return;
+	}
+	ReleaseSequence();
+
+	// The clip times covered between now and the prefetch horizon, split where a loop wraps around.
+	TArray<FVector2f, TInlineAllocator<2>> ActiveRanges;
+	const float Lookahead = bPlaying ? PrefetchTime * PlayRate : 0.0f;
+	const float RawBegin = FMath::Min(Time, Time + Lookahead);
+	const float RawEnd = FMath::Max(Time, Time + Lookahead);
+	if (Duration > 0.0f && RawEnd - RawBegin >= Duration) {
+		ActiveRanges.Add(FVector2f(0.0f, Duration));
+	}
+	else if (LoopMode == EGaussianSplattingLoopMode::Loop) {
+		const float Begin = EvaluateTime(RawBegin, Duration, LoopMode);
+		const float End = Begin + (RawEnd - RawBegin);
+		ActiveRanges.Add(FVector2f(Begin, FMath::Min(End, Duration)));
+		if (End > Duration) {
+			ActiveRanges.Add(FVector2f(0.0f, End - Duration));
+		}
+	}
+	else {
+		float Begin = EvaluateTime(RawBegin, Duration, LoopMode);
+		float End = EvaluateTime(RawEnd, Duration, LoopMode);
+		if (LoopMode == EGaussianSplattingLoopMode::PingPong && Duration > 0.0f && FMath::FloorToInt(RawBegin / Duration) != FMath::FloorToInt(RawEnd / Duration)) {
+			const float Turn = EvaluateTime(Duration * FMath::FloorToFloat(RawEnd / Duration), Duration, LoopMode);
+			Begin = FMath::Min(Begin, Turn);
+			End = FMath::Max(End, Turn);
+		}
+		ActiveRanges.Add(FVector2f(FMath::Min(Begin, End), FMath::Max(Begin, End)));
+	}
+
+	const float PlaybackTime = GetPlaybackTime();
+	for (UNiagaraComponent* NiagaraComponent : NiagaraComponents) {
+		if (UNiagaraDataInterfaceGaussianSplattingPointCloud* DI = UNiagaraFunctionLibrary::GetDataInterface<UNiagaraDataInterfaceGaussianSplattingPointCloud>(NiagaraComponent, "PointCloud")) {
+			DI->SetPlaybackTime(PlaybackTime, ActiveRanges);
+			const UGaussianSplattingPointCloud* PointCloud = DI->GetPointCloud();
+			if (bFitBoundsToPlayback && PointCloud && PointCloud->GetChunkHierarchy().HasTemporalIndex()) {
+				const FGaussianSplattingChunkHierarchy& Hierarchy = PointCloud->GetChunkHierarchy();
+				const FBox3f Bounds = Hierarchy.GetBounds(Hierarchy.GetNumSegments(), ActiveRanges);
+				if (Bounds.IsValid) {
+					SetFixedBounds(NiagaraComponent, FBox(Bounds));
+				}
+			}
+		}
+	}
+}
+
+void UGaussianSplattingPlaybackComponent::PushSequenceFrames(TConstArrayView<UNiagaraComponent*> NiagaraComponents)
+{
+	if (!SequenceStreamer || SequenceStreamer->GetSequence() != Sequence) {
+		SequenceStreamer = MakeShared<FGaussianSplattingSequenceStreamer>(Sequence);
+		DisplayedFrame.Reset();
+	}
+
+	// The frame at the playback position comes first, then the frames the next ticks will show in the play direction.
+	TArray<int32, TInlineAllocator<4>> WantedFrames;
+	WantedFrames.Add(Sequence->GetFrameAtTime(GetPlaybackTime()));
+	if (WantedFrames[0] == INDEX_NONE) {
+		return;
+	}
+	if (bPlaying) {
+		const float FrameStep = (PlayRate < 0.0f ? -1.0f : 1.0f) * FMath::Max(FMath::Abs(PlayRate), 1.0f) / Sequence->GetFrameRate();
+		for (int32 Ahead = 1; Ahead <= FMath::Clamp(DecodeAheadFrames, 1, 3); Ahead++) {
+			WantedFrames.AddUnique(Sequence->GetFrameAtTime(EvaluateTime(Time + Ahead * FrameStep, GetDuration(), LoopMode)));
+		}
+	}
+	SequenceStreamer->Update(WantedFrames);
+
+	if (TSharedPtr<const FGaussianSplattingSequenceFrame> Frame = SequenceStreamer->GetFrame(WantedFrames[0])) {
+		DisplayedFrame = Frame;
+	}
+	TArray<TSharedPtr<const FGaussianSplattingSequenceFrame>, TInlineAllocator<4>> UpcomingFrames;
+	for (int32 i = 1; i < WantedFrames.Num(); i++) {
+		if (TSharedPtr<const FGaussianSplattingSequenceFrame> Frame = SequenceStreamer->GetFrame(WantedFrames[i])) {
+			UpcomingFrames.Add(Frame);
+		}
+	}
+
+	for (UNiagaraComponent* NiagaraComponent : NiagaraComponents) {
+		if (UNiagaraDataInterfaceGaussianSplattingPointCloud* DI = UNiagaraFunctionLibrary::GetDataInterface<UNiagaraDataInterfaceGaussianSplattingPointCloud>(NiagaraComponent, "PointCloud")) {
+			DI->SetSequenceFrames(DisplayedFrame, UpcomingFrames);
+			if (bFitBoundsToPlayback && DisplayedFrame) {
+				const FBox3f Bounds = Sequence->GetFrameInfo(DisplayedFrame->FrameIndex).Bounds;
+				if (Bounds.IsValid) {
+					SetFixedBounds(NiagaraComponent, FBox(Bounds));
+				}
+			}
+		}
+	}
+}
+
+void UGaussianSplattingPlaybackComponent::ReleaseSequence()
+{
+	if (!SequenceStreamer) {
+		return;
+	}
+	SequenceStreamer.Reset();
+	DisplayedFrame.Reset();
+	if (const AActor* Owner = GetOwner()) {
+		TArray<UNiagaraComponent*> NiagaraComponents;
+		Owner->GetComponents(NiagaraComponents);
+		for (UNiagaraComponent* NiagaraComponent : NiagaraComponents) {
+			if (UNiagaraDataInterfaceGaussianSplattingPointCloud* DI = UNiagaraFunctionLibrary::GetDataInterface<UNiagaraDataInterfaceGaussianSplattingPointCloud>(NiagaraComponent, "PointCloud")) {
+				DI->ClearSequenceFrames();
+			}
+		}
+	}
+}
@@ -1,5 +1,13 @@
 ﻿#include "GaussianSplattingPointCloud.h"
 #include "Compression/Spz.h"
+#include "GaussianSplattingCustomVersion.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "GaussianSplattingSorter.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/AssetRegistryTagsContext.h"
 #include <zlib.h>
 #include <algorithm>
 #include <cmath>
@@ -30,6 +38,53 @@ FGaussianSplattingPoint::FGaussianSplattingPoint(
 
 }
 
+FVector3f FGaussianSplattingPoint::GetPositionAt(float InTime) const
+{
+	const float Delta = InTime - Time.X;
+	const FVector3f Velocity(Time.Z, Time.W, Motion.X);
+	const FVector3f Acceleration(Motion.Y, Motion.Z, Motion.W);
+	return Position + Velocity * Delta + Acceleration * (Delta * Delta);
+}
+
+FBox3f FGaussianSplattingPoint::GetSweptBounds(float TimeBegin, float TimeEnd) const
+{
+	// Each axis is a quadratic in time, so its extremes are at the interval ends or at the vertex of the parabola.
+	FBox3f Bounds(GetPositionAt(TimeBegin), GetPositionAt(TimeBegin));
+	Bounds += GetPositionAt(TimeEnd);
+	const FVector3f Velocity(Time.Z, Time.W, Motion.X);
+	const FVector3f Acceleration(Motion.Y, Motion.Z, Motion.W);
+	for (int32 Axis = 0; Axis < 3; Axis++) {
+		if (Acceleration[Axis] != 0.0f) {
+			const float VertexTime = Time.X - Velocity[Axis] / (2.0f * Acceleration[Axis]);
+			if (VertexTime > TimeBegin && VertexTime < TimeEnd) {
+				Bounds += GetPositionAt(VertexTime);
+			}
+		}
+	}
+	return Bounds.ExpandBy(3.0f * Scale.GetAbsMax());
+}
+
+void FGaussianSplattingPoint::Pack(FVector4f* OutVectors) const
+{
+	OutVectors[0] = FVector4f(Position, 1.0f);
+	OutVectors[1] = FVector4f(Quat.X, Quat.Y, Quat.Z, Quat.W);
+	OutVectors[2] = FVector4f(Scale, 1.0f);
+	OutVectors[3] = FVector4f(Color.R, Color.G, Color.B, Color.A);
+	OutVectors[4] = Time;
+	OutVectors[5] = Motion;
+}
+
+FGaussianSplattingPoint FGaussianSplattingPoint::Unpack(const FVector4f* InVectors)
+{
+	return FGaussianSplattingPoint(
+		FVector3f(InVectors[0]),
+		FQuat4f(InVectors[1].X, InVectors[1].Y, InVectors[1].Z, InVectors[1].W),
+		FVector3f(InVectors[2]),
+		FLinearColor(InVectors[3].X, InVectors[3].Y, InVectors[3].Z, InVectors[3].W),
+		InVectors[4],
+		InVectors[5]);
+}
+
 bool FGaussianSplattingPoint::operator<(const FGaussianSplattingPoint& Other) const
 {
 	return Position.X < Other.Position.X;
@@ -64,28 +119,75 @@ FRichCurve UGaussianSplattingPointCloud::CalcFeatureCurve()
 
 FBox UGaussianSplattingPointCloud::CalcBounds()
 {
-	FBox Bounds;
-	Bounds.Min = FVector(FLT_MAX);
-	Bounds.Max = FVector(FLT_MIN);
-
-	for (const auto& Point : Points) {
-		Bounds.Max = FVector::Max(Bounds.Max, FVector(Point.Position));
-		Bounds.Min = FVector::Min(Bounds.Min, FVector(Point.Position));
+	// The hierarchy covers every segment even while some are streamed out, and its chunks already carry the swept bounds.
+	if (!ChunkHierarchy.IsEmpty()) {
+		return FBox(ChunkHierarchy.GetBounds(ChunkHierarchy.GetNumSegments()));
+	}
+	FBox3f Bounds(ForceInit);
+	for (const FGaussianSplattingPoint& Point : Points) {
+		Bounds += Point.GetSweptBounds(Point.Time.X, Point.Time.X);
 	}
-	return Bounds.ExpandBy(FVector(Points[0].Scale.Length()));
+	return FBox(Bounds);
 }
 
 void UGaussianSplattingPointCloud::SetPoints(const TArray<FGaussianSplattingPoint>& InPoints, bool bReorder /*= true*/)
 {
-	Points = InPoints;
+	if (PendingRequest) {
+		PendingRequest->Cancel();
+		PendingRequest->WaitCompletion();
+		delete PendingRequest;
+		PendingRequest = nullptr;
+	}
+	bPayloadsEncoded = false;
 	if (bReorder) {
-		Algo::Sort(Points, [](const FGaussianSplattingPoint& ItemA, const FGaussianSplattingPoint& ItemB) {
-			return ItemA.Scale.Length() > ItemB.Scale.Length();
-		});
+		Points = SortPointsBySize(InPoints);
 	}
+	else {
+		Points = InPoints;
+	}
+	UpdateSegments();
+	BuildChunkHierarchy();
+	SegmentPayloads.Reset();
+	ResidentSegmentCount = RequestedSegmentCount = SegmentEnds.Num();
+#if WITH_EDITORONLY_DATA
+	ContributionScores.Reset();
+#endif
+	BuildLODLevels();
 	OnPointsChanged.Broadcast();
 }
 
+TArray<FGaussianSplattingPoint> UGaussianSplattingPointCloud::SortPointsBySize(TConstArrayView<FGaussianSplattingPoint> InPoints)
+{
+	// Imports and repartitions sort clouds of millions of points, hence the radix sort.
+	TArray<uint32> Keys;
+	TArray<uint32> Order;
+	Keys.SetNumUninitialized(InPoints.Num());
+	Order.SetNumUninitialized(InPoints.Num());
+	for (int32 i = 0; i < InPoints.Num(); i++) {
+		Keys[i] = ~GaussianSplattingSort::FloatToSortableKey(InPoints[i].Scale.Length());
+		Order[i] = i;
+	}
+	GaussianSplattingSort::RadixSort(Keys, Order);
+	TArray<FGaussianSplattingPoint> SortedPoints;
+	SortedPoints.SetNumUninitialized(InPoints.Num());
+	for (int32 i = 0; i < InPoints.Num(); i++) {
+		SortedPoints[i] = InPoints[Order[i]];
+	}
+	return SortedPoints;
+}
+
+#if WITH_EDITORONLY_DATA
+void UGaussianSplattingPointCloud::SetContributionScores(TArray<FGaussianSplattingContributionScore> InScores)
+{
+	if (!InScores.IsEmpty() && InScores.Num() != GetTotalPointCount()) {
+		UE_LOG(LogTemp, Warning, TEXT("%s has %d points but %d contribution scores were given, they are ignored."), *GetPathName(), GetTotalPointCount(), InScores.Num());
+		return;
+	}
+	ContributionScores = MoveTemp(InScores);
+	BuildLODLevels();
+}
+#endif
+
 const TArray<FGaussianSplattingPoint>& UGaussianSplattingPointCloud::GetPoints() const
 {
 	return Points;
@@ -96,6 +198,425 @@ int32 UGaussianSplattingPointCloud::GetPointCount() const
 	return Points.Num();
 }
 
+int32 UGaussianSplattingPointCloud::GetTotalPointCount() const
+{
+	return SegmentEnds.IsEmpty() ? Points.Num() : SegmentEnds.Last();
+}
+
+int32 UGaussianSplattingPointCloud::GetSegmentCountForPoints(int32 InPointCount) const
+{
+	for (int32 SegmentIndex = 0; SegmentIndex < SegmentEnds.Num(); SegmentIndex++) {
+		if (SegmentEnds[SegmentIndex] >= InPointCount) {
+			return SegmentIndex + 1;
+		}
+	}
+	return SegmentEnds.Num();
+}
+
+void UGaussianSplattingPointCloud::RequestResidentSegments(int32 NumSegments)
+{
+	check(IsInGameThread());
+	if (SegmentEnds.IsEmpty()) {
+		return;
+	}
+	RequestedSegmentCount = FMath::Clamp(NumSegments, 1, SegmentEnds.Num());
+	if (RequestedSegmentCount < ResidentSegmentCount) {
+		// Editor and PIE worlds share the asset loaded whole for editing, only cooked games evict its segments.
+		if (!GIsEditor) {
+			EvictSegments();
+		}
+	}
+	else {
+		StreamNextSegment();
+	}
+}
+
+void UGaussianSplattingPointCloud::LoadAllSegments()
+{
+	LoadSegments(SegmentEnds.Num());
+}
+
+void UGaussianSplattingPointCloud::ReleaseSegments(int32 NumSegments /*= 1*/)
+{
+	check(IsInGameThread());
+	if (SegmentEnds.IsEmpty()) {
+		return;
+	}
+	RequestedSegmentCount = FMath::Clamp(NumSegments, 1, SegmentEnds.Num());
+	EvictSegments();
+}
+
+void UGaussianSplattingPointCloud::EvictSegments()
+{
+	if (RequestedSegmentCount >= ResidentSegmentCount) {
+		return;
+	}
+	for (int32 SegmentIndex = RequestedSegmentCount; SegmentIndex < ResidentSegmentCount; SegmentIndex++) {
+		if (!SegmentPayloads.IsValidIndex(SegmentIndex) || (!SegmentPayloads[SegmentIndex].IsBulkDataLoaded() && !SegmentPayloads[SegmentIndex].CanLoadFromDisk())) {
+			return;
+		}
+	}
+	ResidentSegmentCount = RequestedSegmentCount;
+	Points.SetNum(SegmentEnds[ResidentSegmentCount - 1]);
+	Points.Shrink();
+	OnPointsChanged.Broadcast();
+}
+
+int32 UGaussianSplattingPointCloud::SelectLOD(float Distance, float MaxScreenError) const
+{
+	// Errors grow with every level, so the first one above the threshold ends the search.
+	int32 LOD = 0;
+	while (LOD < LODLevels.Num() && LODLevels[LOD].Error <= Distance * MaxScreenError) {
+		LOD++;
+	}
+	return LOD;
+}
+
+TSharedPtr<const TArray<FGaussianSplattingPoint>> UGaussianSplattingPointCloud::GetLODPoints(int32 LOD) const
+{
+	return LODPoints.IsValidIndex(LOD - 1) ? LODPoints[LOD - 1] : nullptr;
+}
+
+void UGaussianSplattingPointCloud::RequestLOD(int32 LOD)
+{
+	check(IsInGameThread());
+	RequestedLOD = FMath::Clamp(LOD, 0, LODLevels.Num());
+	// The coarsest level is excluded, it is loaded with the asset as the fallback of distant clouds and stays resident.
+	for (int32 LevelIndex = 0; LevelIndex < LODPoints.Num() - 1; LevelIndex++) {
+		if (LevelIndex != RequestedLOD - 1 && LODPayloads.IsValidIndex(LevelIndex) && LODPayloads[LevelIndex].CanLoadFromDisk()) {
+			LODPoints[LevelIndex].Reset();
+		}
+	}
+	StreamRequestedLOD();
+}
+
+void UGaussianSplattingPointCloud::BuildLODLevels()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingPointCloud::BuildLODLevels);
+	if (PendingLODRequest) {
+		PendingLODRequest->Cancel();
+		PendingLODRequest->WaitCompletion();
+		delete PendingLODRequest;
+		PendingLODRequest = nullptr;
+	}
+	LODLevels.Reset();
+	LODPayloads.Reset();
+	LODPoints.Reset();
+	FailedLODLevels.Reset();
+	RequestedLOD = 0;
+	bPayloadsEncoded = false;
+	if (MaxLODLevels <= 0) {
+		return;
+	}
+	// Merged splats carry no motion, 4D clouds only have their full detail.
+	LoadAllSegments();
+	if (ChunkHierarchy.HasTemporalIndex()) {
+		UE_LOG(LogTemp, Warning, TEXT("%s has temporal data, its levels of detail are not built."), *GetPathName());
+		return;
+	}
+	GaussianSplattingLOD::FSettings Settings;
+	Settings.MaxLevels = MaxLODLevels;
+	Settings.ReductionRatio = LODReductionRatio;
+	TArray<TArray<FGaussianSplattingPoint>> Levels;
+	TConstArrayView<FGaussianSplattingPoint> LevelSource = Points;
+#if WITH_EDITORONLY_DATA
+	// Splats that never showed in a capture image are floaters or hidden inside surfaces, merging them would only blur the levels.
+	TArray<FGaussianSplattingPoint> SeenPoints;
+	if (ContributionScores.Num() == Points.Num()) {
+		SeenPoints.Reserve(Points.Num());
+		for (int32 i = 0; i < Points.Num(); i++) {
+			if (ContributionScores[i].MaxWeight >= 1.0f / 255.0f) {
+				SeenPoints.Add(Points[i]);
+			}
+		}
+		if (!SeenPoints.IsEmpty()) {
+			LevelSource = SeenPoints;
+		}
+	}
+#endif
+	GaussianSplattingLOD::BuildLevels(LevelSource, Settings, Levels, LODLevels);
+	for (TArray<FGaussianSplattingPoint>& Level : Levels) {
+		LODPoints.Add(MakeShared<const TArray<FGaussianSplattingPoint>>(MoveTemp(Level)));
+	}
+}
+
+void UGaussianSplattingPointCloud::LoadAllLODs()
+{
+	if (PendingLODRequest) {
+		PendingLODRequest->WaitCompletion();
+		delete PendingLODRequest;
+		PendingLODRequest = nullptr;
+	}
+	for (int32 LevelIndex = 0; LevelIndex < LODPoints.Num(); LevelIndex++) {
+		LoadLOD(LevelIndex);
+	}
+}
+
+void UGaussianSplattingPointCloud::LoadLOD(int32 LevelIndex)
+{
+	if (LODPoints[LevelIndex] || !LODPayloads.IsValidIndex(LevelIndex)) {
+		return;
+	}
+	void* Payload = nullptr;
+	LODPayloads[LevelIndex].GetCopy(&Payload, false);
+	TArray<FGaussianSplattingPoint> LevelPoints;
+	if (DecodeSegment(static_cast<const uint8*>(Payload), LODPayloads[LevelIndex].GetBulkDataSize(), LevelPoints) && LevelPoints.Num() == LODLevels[LevelIndex].NumPoints) {
+		LODPoints[LevelIndex] = MakeShared<const TArray<FGaussianSplattingPoint>>(MoveTemp(LevelPoints));
+	}
+	FMemory::Free(Payload);
+}
+
+void UGaussianSplattingPointCloud::StreamRequestedLOD()
+{
+	const int32 LevelIndex = RequestedLOD - 1;
+	if (PendingLODRequest || !LODPoints.IsValidIndex(LevelIndex) || LODPoints[LevelIndex] || !LODPayloads.IsValidIndex(LevelIndex) || FailedLODLevels.Contains(LevelIndex)) {
+		return;
+	}
+	TWeakObjectPtr<UGaussianSplattingPointCloud> WeakThis(this);
+	const int32 NumPoints = LODLevels[LevelIndex].NumPoints;
+	const uint32 Serial = ++PendingLODRequestSerial;
+	FBulkDataIORequestCallBack Callback = [WeakThis, LevelIndex, NumPoints, Serial](bool bWasCancelled, IBulkDataIORequest* Request) {
+		uint8* Payload = bWasCancelled ? nullptr : Request->GetReadResults();
+		const int64 PayloadSize = Request->GetSize();
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, LevelIndex, NumPoints, Serial, Payload, PayloadSize]() {
+			TArray<FGaussianSplattingPoint> LevelPoints;
+			const bool bDecoded = DecodeSegment(Payload, PayloadSize, LevelPoints) && LevelPoints.Num() == NumPoints;
+			FMemory::Free(Payload);
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, LevelIndex, Serial, bDecoded, LevelPoints = MoveTemp(LevelPoints)]() mutable {
+				UGaussianSplattingPointCloud* PointCloud = WeakThis.Get();
+				// A request dropped by BuildLODLevels or LoadAllLODs may complete after a newer one was issued.
+				if (PointCloud == nullptr || PointCloud->PendingLODRequest == nullptr || PointCloud->PendingLODRequestSerial != Serial) {
+					return;
+				}
+				PointCloud->PendingLODRequest->WaitCompletion();
+				delete PointCloud->PendingLODRequest;
+				PointCloud->PendingLODRequest = nullptr;
+				// The levels may have been rebuilt while the payload was in flight.
+				if (bDecoded && PointCloud->LODPoints.IsValidIndex(LevelIndex) && PointCloud->LODLevels[LevelIndex].NumPoints == LevelPoints.Num()) {
+					PointCloud->LODPoints[LevelIndex] = MakeShared<const TArray<FGaussianSplattingPoint>>(MoveTemp(LevelPoints));
+				}
+				else if (!bDecoded) {
+					UE_LOG(LogTemp, Warning, TEXT("Failed to decode LOD %d of %s, it is no longer streamed."), LevelIndex + 1, *PointCloud->GetPathName());
+					PointCloud->FailedLODLevels.Add(LevelIndex);
+				}
+				PointCloud->StreamRequestedLOD();
+			});
+		});
+	};
+	PendingLODRequest = LODPayloads[LevelIndex].CreateStreamingRequest(AIOP_BelowNormal, &Callback, nullptr);
+}
+
+void UGaussianSplattingPointCloud::LoadSegments(int32 NumSegments)
+{
+	if (PendingRequest) {
+		PendingRequest->WaitCompletion();
+		delete PendingRequest;
+		PendingRequest = nullptr;
+	}
+	const int32 FirstMissingSegment = ResidentSegmentCount;
+	for (int32 SegmentIndex = FirstMissingSegment; SegmentIndex < FMath::Min(NumSegments, SegmentEnds.Num()) && SegmentPayloads.IsValidIndex(SegmentIndex); SegmentIndex++) {
+		void* Payload = nullptr;
+		SegmentPayloads[SegmentIndex].GetCopy(&Payload, false);
+		TArray<FGaussianSplattingPoint> SegmentPoints;
+		const bool bDecoded = DecodeSegment(static_cast<const uint8*>(Payload), SegmentPayloads[SegmentIndex].GetBulkDataSize(), SegmentPoints);
+		FMemory::Free(Payload);
+		if (!bDecoded) {
+			break;
+		}
+		Points.Append(MoveTemp(SegmentPoints));
+		ResidentSegmentCount = SegmentIndex + 1;
+	}
+	RequestedSegmentCount = FMath::Max(RequestedSegmentCount, ResidentSegmentCount);
+	if (ResidentSegmentCount != FirstMissingSegment) {
+		OnPointsChanged.Broadcast();
+	}
+}
+
+void UGaussianSplattingPointCloud::BuildChunkHierarchy()
+{
+	ChunkHierarchy.Build(Points, SegmentEnds, FGaussianSplattingChunkHierarchy::DefaultChunkSize, NumSortDirections);
+}
+
+void UGaussianSplattingPointCloud::UpdateSegments()
+{
+	SegmentEnds.Reset();
+	const int32 PointCount = Points.Num();
+	if (PointCount == 0) {
+		return;
+	}
+	for (float Fraction : SegmentFractions) {
+		const int32 SegmentEnd = FMath::Clamp(FMath::CeilToInt32(Fraction * PointCount), 0, PointCount);
+		if (SegmentEnd > (SegmentEnds.IsEmpty() ? 0 : SegmentEnds.Last())) {
+			SegmentEnds.Add(SegmentEnd);
+		}
+	}
+	if (SegmentEnds.IsEmpty() || SegmentEnds.Last() != PointCount) {
+		SegmentEnds.Add(PointCount);
+	}
+}
+
+void UGaussianSplattingPointCloud::EncodeSegment(int32 SegmentIndex, TArray<uint8>& OutPayload) const
+{
+	const int32 SegmentBegin = SegmentIndex > 0 ? SegmentEnds[SegmentIndex - 1] : 0;
+	const TArray<FGaussianSplattingPoint> SegmentPoints(Points.GetData() + SegmentBegin, SegmentEnds[SegmentIndex] - SegmentBegin);
+	EncodePoints(SegmentPoints, CompressionMethod, OutPayload);
+}
+
+void UGaussianSplattingPointCloud::EncodePoints(const TArray<FGaussianSplattingPoint>& InPoints, EGaussianSplattingCompressionMethod Method, TArray<uint8>& OutPayload)
+{
+	FMemoryWriter Writer(OutPayload);
+	uint8 MethodValue = (uint8)Method;
+	Writer << MethodValue;
+	if (Method == EGaussianSplattingCompressionMethod::None) {
+		Writer << const_cast<TArray<FGaussianSplattingPoint>&>(InPoints);
+	}
+	else if (Method == EGaussianSplattingCompressionMethod::Zlib) {
+		std::vector<uint8_t> CompressedData;
+		Spz::compress(InPoints, 3, 1, CompressedData);
+		int32 CompressedDataSize = CompressedData.size();
+		Writer << CompressedDataSize;
+		Writer.Serialize(CompressedData.data(), CompressedData.size() * sizeof(uint8_t));
+
+		// SPZ only packs the static attributes, 4D clouds keep their time and motion at full precision.
+		bool bHasMotion = InPoints.ContainsByPredicate([](const FGaussianSplattingPoint& Point) {
+			return Point.Time != FVector4f::Zero() || Point.Motion != FVector4f::Zero();
+		});
+		Writer << bHasMotion;
+		if (bHasMotion) {
+			TArray<FVector4f> Times;
+			TArray<FVector4f> Motions;
+			Times.Reserve(InPoints.Num());
+			Motions.Reserve(InPoints.Num());
+			for (const FGaussianSplattingPoint& Point : InPoints) {
+				Times.Add(Point.Time);
+				Motions.Add(Point.Motion);
+			}
+			Writer << Times;
+			Writer << Motions;
+		}
+	}
+}
+
+bool UGaussianSplattingPointCloud::DecodeSegment(const uint8* Payload, int64 PayloadSize, TArray<FGaussianSplattingPoint>& OutPoints)
+{
+	if (Payload == nullptr || PayloadSize <= 0) {
+		return false;
+	}
+	FMemoryReaderView Reader(MakeArrayView(Payload, PayloadSize));
+	uint8 Method = 0;
+	Reader << Method;
+	if (Method == (uint8)EGaussianSplattingCompressionMethod::None) {
+		Reader << OutPoints;
+	}
+	else if (Method == (uint8)EGaussianSplattingCompressionMethod::Zlib) {
+		int32 CompressedDataSize = 0;
+		Reader << CompressedDataSize;
+		if (CompressedDataSize <= 0 || Reader.Tell() + CompressedDataSize > PayloadSize) {
+			return false;
+		}
+		if (!Spz::decompress(std::span<const uint8_t>(Payload + Reader.Tell(), CompressedDataSize), OutPoints)) {
+			return false;
+		}
+		Reader.Seek(Reader.Tell() + CompressedDataSize);
+		bool bHasMotion = false;
+		Reader << bHasMotion;
+		if (bHasMotion) {
+			TArray<FVector4f> Times;
+			TArray<FVector4f> Motions;
+			Reader << Times;
+			Reader << Motions;
+			if (Times.Num() != OutPoints.Num() || Motions.Num() != OutPoints.Num()) {
+				return false;
+			}
+			for (int32 i = 0; i < OutPoints.Num(); i++) {
+				OutPoints[i].Time = Times[i];
+				OutPoints[i].Motion = Motions[i];
+			}
+		}
+	}
+	return !Reader.IsError();
+}
+
+void UGaussianSplattingPointCloud::StreamNextSegment()
+{
+	if (PendingRequest || ResidentSegmentCount >= RequestedSegmentCount || !SegmentPayloads.IsValidIndex(ResidentSegmentCount)) {
+		return;
+	}
+	const int32 SegmentIndex = ResidentSegmentCount;
+	// Payloads held in memory, such as those encoded and saved in this session, have no file to stream from.
+	if (SegmentPayloads[SegmentIndex].IsBulkDataLoaded() && !SegmentPayloads[SegmentIndex].CanLoadFromDisk()) {
+		LoadSegments(RequestedSegmentCount);
+		return;
+	}
+	TWeakObjectPtr<UGaussianSplattingPointCloud> WeakThis(this);
+	const uint32 Serial = ++PendingRequestSerial;
+	FBulkDataIORequestCallBack Callback = [WeakThis, SegmentIndex, Serial](bool bWasCancelled, IBulkDataIORequest* Request) {
+		uint8* Payload = bWasCancelled ? nullptr : Request->GetReadResults();
+		const int64 PayloadSize = Request->GetSize();
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, SegmentIndex, Serial, Payload, PayloadSize]() {
+			TArray<FGaussianSplattingPoint> SegmentPoints;
+			const bool bDecoded = DecodeSegment(Payload, PayloadSize, SegmentPoints);
+			FMemory::Free(Payload);
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, SegmentIndex, Serial, bDecoded, SegmentPoints = MoveTemp(SegmentPoints)]() mutable {
+				UGaussianSplattingPointCloud* PointCloud = WeakThis.Get();
+				// SetPoints and LoadSegments drop the request in flight and may issue a newer one, which this result must not consume.
+				if (PointCloud == nullptr || PointCloud->PendingRequest == nullptr || PointCloud->PendingRequestSerial != Serial) {
+					return;
+				}
+				PointCloud->PendingRequest->WaitCompletion();
+				delete PointCloud->PendingRequest;
+				PointCloud->PendingRequest = nullptr;
+				if (bDecoded) {
+					PointCloud->AppendSegment(SegmentIndex, MoveTemp(SegmentPoints));
+				}
+			});
+		});
+	};
+	PendingRequest = SegmentPayloads[SegmentIndex].CreateStreamingRequest(AIOP_BelowNormal, &Callback, nullptr);
+}
+
+void UGaussianSplattingPointCloud::AppendSegment(int32 SegmentIndex, TArray<FGaussianSplattingPoint>&& SegmentPoints)
+{
+	// The segment may have been released or replaced while it was in flight.
+	if (SegmentIndex != ResidentSegmentCount || SegmentIndex >= RequestedSegmentCount || Points.Num() != (SegmentIndex > 0 ? SegmentEnds[SegmentIndex - 1] : 0)) {
+		StreamNextSegment();
+		return;
+	}
+	Points.Append(MoveTemp(SegmentPoints));
+	ResidentSegmentCount++;
+	OnPointsChanged.Broadcast();
+	StreamNextSegment();
+}
+
+void UGaussianSplattingPointCloud::BeginDestroy()
+{
+	if (PendingRequest) {
+		PendingRequest->Cancel();
+		PendingRequest->WaitCompletion();
+		delete PendingRequest;
+		PendingRequest = nullptr;
+	}
+	if (PendingLODRequest) {
+		PendingLODRequest->Cancel();
+		PendingLODRequest->WaitCompletion();
+		delete PendingLODRequest;
+		PendingLODRequest = nullptr;
+	}
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UGaussianSplattingPointCloud::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	bPayloadsEncoded = false;
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplattingPointCloud, MaxLODLevels) || PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplattingPointCloud, LODReductionRatio)) {
+		BuildLODLevels();
+	}
+}
+#endif
+
 FLinearColor SRGBToLinear(const FLinearColor& Color)
 {
 	auto SRGBToLinearFloat = [](const float Color) -> float
@@ -176,6 +697,12 @@ TArray<FGaussianSplattingPoint> ParseSplatFromStream(std::istream& in)
 		return itr->second;
 		};
 
+	// Like index, for fields that plain 3D splats do not have.
+	const auto optionalIndex = [&fields](const std::string& name) {
+		const auto& itr = fields.find(name);
+		return itr == fields.end() ? -1 : itr->second;
+		};
+
 	const std::vector<int> positionIdx = { index("x"), index("y"), index("z") };
 	const std::vector<int> scaleIdx = { index("scale_0"), index("scale_1"),
 									   index("scale_2") };
@@ -185,10 +712,10 @@ TArray<FGaussianSplattingPoint> ParseSplatFromStream(std::istream& in)
 	const std::vector<int> colorIdx = { index("f_dc_0"), index("f_dc_1"),
 									   index("f_dc_2") };
 
-	const std::vector<int> stgsIdx = { index("trbf_center"), index("trbf_scale"),
-								index("motion_0"), index("motion_1"),
-								index("motion_2"), index("motion_3"),
-								index("motion_4"), index("motion_5") };
+	const std::vector<int> stgsIdx = { optionalIndex("trbf_center"), optionalIndex("trbf_scale"),
+								optionalIndex("motion_0"), optionalIndex("motion_1"),
+								optionalIndex("motion_2"), optionalIndex("motion_3"),
+								optionalIndex("motion_4"), optionalIndex("motion_5") };
 
 	// Check that only valid indices were returned.
 	auto checkIndices = [&](const std::vector<int>& idxVec) -> bool {
@@ -205,6 +732,8 @@ TArray<FGaussianSplattingPoint> ParseSplatFromStream(std::istream& in)
 		!checkIndices(colorIdx)) {
 		return Result;
 	}
+	// Without the full set of spacetime fields the splats are static.
+	const bool hasStgs = checkIndices(stgsIdx);
 
 	// Spherical harmonics are optional and variable in size (depending on degree)
 	std::vector<int> shIdx;
@@ -238,27 +767,27 @@ TArray<FGaussianSplattingPoint> ParseSplatFromStream(std::istream& in)
 		size_t vertexOffset = i * fields.size();
 		FGaussianSplattingPoint& Point = Result[i];
 
-		// Time, Motion
-		float Time = values[vertexOffset + stgsIdx[0]];
-		float trbf_scale = values[vertexOffset + stgsIdx[1]];
-		std::vector<float> Motion = {
-			values[vertexOffset + stgsIdx[2]],
-			values[vertexOffset + stgsIdx[3]],
-			values[vertexOffset + stgsIdx[4]],
-			values[vertexOffset + stgsIdx[5]],
-			values[vertexOffset + stgsIdx[6]],
-			values[vertexOffset + stgsIdx[7]]
-		};
 		int times = 100;
 
-		Point.Time = FVector4f(Time, trbf_scale, times * Motion[0], times * -Motion[2]);
-		Point.Motion = times * FVector4f(-Motion[1], Motion[3], -Motion[5], -Motion[4]);
-
+		// Time, Motion
+		if (hasStgs) {
+			float Time = values[vertexOffset + stgsIdx[0]];
+			float trbf_scale = values[vertexOffset + stgsIdx[1]];
+			std::vector<float> Motion = {
+				values[vertexOffset + stgsIdx[2]],
+				values[vertexOffset + stgsIdx[3]],
+				values[vertexOffset + stgsIdx[4]],
+				values[vertexOffset + stgsIdx[5]],
+				values[vertexOffset + stgsIdx[6]],
+				values[vertexOffset + stgsIdx[7]]
+			};
 
-		if (i == 0) {
-			UE_LOG(LogTemp, Log, TEXT("Time: %f"), Time);
-			UE_LOG(LogTemp, Log, TEXT("trbf_scale: %f"), trbf_scale);
-			UE_LOG(LogTemp, Log, TEXT("Motion: %f, %f, %f, %f, %f, %f"), Motion[0], Motion[1], Motion[2], Motion[3], Motion[4], Motion[5]);
+			Point.Time = FVector4f(Time, trbf_scale, times * Motion[0], times * -Motion[2]);
+			Point.Motion = times * FVector4f(-Motion[1], Motion[3], -Motion[5], -Motion[4]);
+		}
+		else {
+			Point.Time = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+			Point.Motion = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
 		}
 
 		// Position
@@ -299,9 +828,63 @@ TArray<FGaussianSplattingPoint> ParseSplatFromStream(std::istream& in)
 	return Result;
 }
 
+#if WITH_EDITORONLY_DATA
+namespace
+{
+	const FName SourceFilePathTag(TEXT("SourceFilePath"));
+	const FName SourceFileSizeTag(TEXT("SourceFileSize"));
+	const FName SourceTimestampTag(TEXT("SourceTimestamp"));
+	const FName SourceContentHashTag(TEXT("SourceContentHash"));
+	const FName SourceSettingsHashTag(TEXT("SourceSettingsHash"));
+}
+
+bool UGaussianSplattingPointCloud::GetSourceInfoFromAssetData(const FAssetData& AssetData, FGaussianSplattingSourceInfo& OutSourceInfo)
+{
+	FString FileSize, Timestamp, ContentHash, SettingsHash;
+	if (!AssetData.GetTagValue(SourceFileSizeTag, FileSize) || !AssetData.GetTagValue(SourceTimestampTag, Timestamp)
+		|| !AssetData.GetTagValue(SourceContentHashTag, ContentHash) || !AssetData.GetTagValue(SourceSettingsHashTag, SettingsHash)) {
+		return false;
+	}
+	int64 Ticks = 0;
+	AssetData.GetTagValue(SourceFilePathTag, OutSourceInfo.FilePath);
+	LexFromString(OutSourceInfo.FileSize, *FileSize);
+	LexFromString(Ticks, *Timestamp);
+	OutSourceInfo.Timestamp = FDateTime(Ticks);
+	LexFromString(OutSourceInfo.ContentHash, *ContentHash);
+	LexFromString(OutSourceInfo.SettingsHash, *SettingsHash);
+	return true;
+}
+#endif
+
+void UGaussianSplattingPointCloud::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+#if WITH_EDITORONLY_DATA
+	// Reimports compare the source of a saved cloud from these without loading it, the time stamp is kept in exact ticks.
+	Context.AddTag(FAssetRegistryTag(SourceFilePathTag, SourceInfo.FilePath, FAssetRegistryTag::TT_Alphabetical));
+	Context.AddTag(FAssetRegistryTag(SourceFileSizeTag, LexToString(SourceInfo.FileSize), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag(SourceTimestampTag, LexToString(SourceInfo.Timestamp.GetTicks()), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag(SourceContentHashTag, LexToString(SourceInfo.ContentHash), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag(SourceSettingsHashTag, LexToString(SourceInfo.SettingsHash), FAssetRegistryTag::TT_Hidden));
+#endif
+}
+
+void UGaussianSplattingPointCloud::CopySettings(const UGaussianSplattingPointCloud& Other)
+{
+	CompressionMethod = Other.CompressionMethod;
+	SegmentFractions = Other.SegmentFractions;
+	NumSortDirections = Other.NumSortDirections;
+	MaxLODLevels = Other.MaxLODLevels;
+	LODReductionRatio = Other.LODReductionRatio;
+	FeatureLevel = Other.FeatureLevel;
+	bPayloadsEncoded = false;
+}
+
 void UGaussianSplattingPointCloud::LoadFromFile(FString InFilePath)
 {
-	Points = LoadPointsFromFile(InFilePath);
+	// Goes through SetPoints so the segments, the chunk hierarchy and the levels of detail match the new points, which keep
+	// the order of the file.
+	SetPoints(LoadPointsFromFile(InFilePath), false);
 }
 
 TArray<FGaussianSplattingPoint> UGaussianSplattingPointCloud::LoadPointsFromFile(FString InFilePath)
@@ -314,14 +897,128 @@ TArray<FGaussianSplattingPoint> UGaussianSplattingPointCloud::LoadPointsFromFile
 	return ParseSplatFromStream(IStream);
 }
 
-void UGaussianSplattingPointCloud::Serialize(FArchive& Ar)
+TArray<FGaussianSplattingPoint> UGaussianSplattingPointCloud::LoadPointsFromMemory(TConstArrayView<uint8> Data)
 {
-	Super::Serialize(Ar);
-	if (GetCompressionMethod() == EGaussianSplattingCompressionMethod::None) {
-		Ar << Points;
+	// Reads the bytes in place instead of copying them into a string stream.
+	struct FMemoryStreamBuffer : public std::streambuf
+	{
+		FMemoryStreamBuffer(TConstArrayView<uint8> InData)
+		{
+			char* Begin = const_cast<char*>(reinterpret_cast<const char*>(InData.GetData()));
+			setg(Begin, Begin, Begin + InData.Num());
+		}
+	};
+	FMemoryStreamBuffer Buffer(Data);
+	std::istream IStream(&Buffer);
+	return ParseSplatFromStream(IStream);
+}
+
+void UGaussianSplattingPointCloud::EncodePayloads()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGaussianSplattingPointCloud::EncodePayloads);
+	LoadAllSegments();
+	const TArray<int32> PreviousSegmentEnds = SegmentEnds;
+	UpdateSegments();
+	if (SegmentEnds != PreviousSegmentEnds || ChunkHierarchy.GetNumSegments() != SegmentEnds.Num() || ChunkHierarchy.GetNumSortDirections() != NumSortDirections / 2 * 2) {
+		BuildChunkHierarchy();
+	}
+	ResidentSegmentCount = RequestedSegmentCount = SegmentEnds.Num();
+	LoadAllLODs();
+	if (LODPoints.ContainsByPredicate([](const TSharedPtr<const TArray<FGaussianSplattingPoint>>& LevelPoints) { return !LevelPoints; })) {
+		UE_LOG(LogTemp, Warning, TEXT("Failed to load the levels of detail of %s, they are not saved."), *GetPathName());
+		LODLevels.Reset();
+		LODPoints.Reset();
+	}
+
+	// Compressing the payloads dominates saving, every segment and level is encoded on its own worker.
+	TArray<TArray<uint8>> Payloads;
+	Payloads.SetNum(SegmentEnds.Num() + LODPoints.Num());
+	ParallelFor(TEXT("GaussianSplatting.EncodePayloads"), Payloads.Num(), 1, [&](int32 PayloadIndex) {
+		if (PayloadIndex < SegmentEnds.Num()) {
+			EncodeSegment(PayloadIndex, Payloads[PayloadIndex]);
+		}
+		else {
+			EncodePoints(*LODPoints[PayloadIndex - SegmentEnds.Num()], CompressionMethod, Payloads[PayloadIndex]);
+		}
+	});
+	SegmentPayloads.Reset();
+	for (int32 SegmentIndex = 0; SegmentIndex < SegmentEnds.Num(); SegmentIndex++) {
+		const TArray<uint8>& Payload = Payloads[SegmentIndex];
+		FByteBulkData* BulkData = new FByteBulkData();
+		// The coarsest segment is always loaded with the asset, the finer ones are streamed on demand.
+		BulkData->SetBulkDataFlags(SegmentIndex == 0 ? BULKDATA_ForceInlinePayload : BULKDATA_Force_NOT_InlinePayload);
+		BulkData->Lock(LOCK_READ_WRITE);
+		FMemory::Memcpy(BulkData->Realloc(Payload.Num()), Payload.GetData(), Payload.Num());
+		BulkData->Unlock();
+		SegmentPayloads.Add(BulkData);
+	}
+	LODPayloads.Reset();
+	for (int32 LevelIndex = 0; LevelIndex < LODPoints.Num(); LevelIndex++) {
+		const TArray<uint8>& Payload = Payloads[SegmentEnds.Num() + LevelIndex];
+		FByteBulkData* BulkData = new FByteBulkData();
+		// The coarsest level is the fallback of distant clouds and stays loaded, the finer ones are streamed on demand.
+		BulkData->SetBulkDataFlags(LevelIndex == LODPoints.Num() - 1 ? BULKDATA_ForceInlinePayload : BULKDATA_Force_NOT_InlinePayload);
+		BulkData->Lock(LOCK_READ_WRITE);
+		FMemory::Memcpy(BulkData->Realloc(Payload.Num()), Payload.GetData(), Payload.Num());
+		BulkData->Unlock();
+		LODPayloads.Add(BulkData);
+	}
+	bPayloadsEncoded = true;
+}
+
+void UGaussianSplattingPointCloud::SerializeResidentPoints(FArchive& Ar)
+{
+	if (Ar.IsLoading()) {
+		if (PendingRequest) {
+			PendingRequest->WaitCompletion();
+			delete PendingRequest;
+			PendingRequest = nullptr;
+		}
+		if (PendingLODRequest) {
+			PendingLODRequest->Cancel();
+			PendingLODRequest->WaitCompletion();
+			delete PendingLODRequest;
+			PendingLODRequest = nullptr;
+		}
+	}
+	Ar << Points;
+	Ar << ResidentSegmentCount;
+	Ar << bPayloadsEncoded;
+	int32 NumLevels = LODPoints.Num();
+	Ar << NumLevels;
+	if (Ar.IsLoading()) {
+		RequestedSegmentCount = ResidentSegmentCount;
+		LODPoints.Reset();
+		LODPoints.SetNum(NumLevels);
+		FailedLODLevels.Reset();
+		RequestedLOD = 0;
 	}
-	else if(GetCompressionMethod() == EGaussianSplattingCompressionMethod::Zlib){
+	for (int32 LevelIndex = 0; LevelIndex < NumLevels; LevelIndex++) {
+		bool bResident = LODPoints[LevelIndex].IsValid();
+		Ar << bResident;
+		if (!bResident) {
+			continue;
+		}
+		TArray<FGaussianSplattingPoint> LevelPoints;
+		if (Ar.IsSaving()) {
+			LevelPoints = *LODPoints[LevelIndex];
+		}
+		Ar << LevelPoints;
 		if (Ar.IsLoading()) {
+			LODPoints[LevelIndex] = MakeShared<const TArray<FGaussianSplattingPoint>>(MoveTemp(LevelPoints));
+		}
+	}
+}
+
+void UGaussianSplattingPointCloud::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+	Ar.UsingCustomVersion(FGaussianSplattingCustomVersion::GUID);
+	if (Ar.IsLoading() && Ar.CustomVer(FGaussianSplattingCustomVersion::GUID) < FGaussianSplattingCustomVersion::SegmentedPayload) {
+		if (GetCompressionMethod() == EGaussianSplattingCompressionMethod::None) {
+			Ar << Points;
+		}
+		else if (GetCompressionMethod() == EGaussianSplattingCompressionMethod::Zlib) {
 			std::vector<uint8_t> CompressedData;
 			int CompressedDataSize = 0;
 			Ar << CompressedDataSize;
@@ -329,12 +1026,93 @@ void UGaussianSplattingPointCloud::Serialize(FArchive& Ar)
 			Ar.Serialize(CompressedData.data(), CompressedData.size() * sizeof(uint8_t));
 			Spz::decompress(CompressedData, Points);
 		}
-		else if (Ar.IsSaving()) {
-			std::vector<uint8_t> CompressedData;
-			Spz::compress(Points, 3, 1, CompressedData);
-			int CompressedDataSize = CompressedData.size();
-			Ar << CompressedDataSize;
-			Ar.Serialize(CompressedData.data(), CompressedData.size() * sizeof(uint8_t));
+		UpdateSegments();
+		BuildChunkHierarchy();
+		SegmentPayloads.Reset();
+		ResidentSegmentCount = RequestedSegmentCount = SegmentEnds.Num();
+		return;
+	}
+	if (!Ar.IsLoading() && !Ar.IsSaving()) {
+		return;
+	}
+
+	// Undo, redo and duplication copy the object in memory, they carry the resident points and levels as they are instead of
+	// compressing every payload, which only saving to disk needs.
+	const bool bInMemoryCopy = !Ar.IsPersistent() || Ar.IsTransacting();
+	if (Ar.IsSaving() && !bPayloadsEncoded && !bInMemoryCopy) {
+		EncodePayloads();
+	}
+
+	Ar << SegmentEnds;
+	if (Ar.CustomVer(FGaussianSplattingCustomVersion::GUID) >= FGaussianSplattingCustomVersion::ChunkHierarchy) {
+		Ar << ChunkHierarchy;
+	}
+	else {
+		ChunkHierarchy.Reset();
+	}
+	if (Ar.IsLoading()) {
+		SegmentPayloads.Reset();
+		for (int32 SegmentIndex = 0; SegmentIndex < SegmentEnds.Num(); SegmentIndex++) {
+			SegmentPayloads.Add(new FByteBulkData());
+		}
+	}
+	for (int32 SegmentIndex = 0; SegmentIndex < SegmentPayloads.Num(); SegmentIndex++) {
+		SegmentPayloads[SegmentIndex].Serialize(Ar, this, SegmentIndex);
+	}
+	if (Ar.CustomVer(FGaussianSplattingCustomVersion::GUID) >= FGaussianSplattingCustomVersion::LODLevels) {
+		Ar << LODLevels;
+		if (Ar.IsLoading()) {
+			LODPayloads.Reset();
+			for (int32 LevelIndex = 0; LevelIndex < LODLevels.Num(); LevelIndex++) {
+				LODPayloads.Add(new FByteBulkData());
+			}
+		}
+		for (int32 LevelIndex = 0; LevelIndex < LODPayloads.Num(); LevelIndex++) {
+			LODPayloads[LevelIndex].Serialize(Ar, this, SegmentPayloads.Num() + LevelIndex);
+		}
+	}
+	else if (Ar.IsLoading()) {
+		LODLevels.Reset();
+		LODPayloads.Reset();
+	}
+#if WITH_EDITORONLY_DATA
+	if (!Ar.IsFilterEditorOnly()) {
+		if (Ar.IsSaving() && ContributionScores.Num() != GetTotalPointCount()) {
+			ContributionScores.Reset();
+		}
+		if (Ar.CustomVer(FGaussianSplattingCustomVersion::GUID) >= FGaussianSplattingCustomVersion::ContributionScores) {
+			Ar << ContributionScores;
+		}
+		else if (Ar.IsLoading()) {
+			ContributionScores.Reset();
+		}
+	}
+#endif
+
+	if (bInMemoryCopy) {
+		SerializeResidentPoints(Ar);
+		return;
+	}
+	if (Ar.IsLoading()) {
+		Points.Reset();
+		ResidentSegmentCount = RequestedSegmentCount = 0;
+		if (!SegmentEnds.IsEmpty()) {
+			LoadSegments(1);
+		}
+		LODPoints.Reset();
+		LODPoints.SetNum(LODLevels.Num());
+		FailedLODLevels.Reset();
+		RequestedLOD = 0;
+		if (!LODLevels.IsEmpty()) {
+			LoadLOD(LODLevels.Num() - 1);
+		}
+		// Editor worlds and asset tools expect the whole cloud, streaming only kicks in for game worlds.
+		if (GIsEditor) {
+			LoadAllSegments();
+			const bool bStaleTemporalBounds = ChunkHierarchy.HasTemporalIndex() && Ar.CustomVer(FGaussianSplattingCustomVersion::GUID) < FGaussianSplattingCustomVersion::SweptChunkBounds;
+			if (ChunkHierarchy.GetNumSegments() != SegmentEnds.Num() || bStaleTemporalBounds) {
+				BuildChunkHierarchy();
+			}
 		}
 	}
 }
@@ -3,6 +3,10 @@
 #include "NiagaraShaderParametersBuilder.h"
 #include "NiagaraSystemInstance.h"
 #include "NiagaraRenderer.h"
+#include "GaussianSplattingBudgetSubsystem.h"
+#include "GaussianSplattingSequence.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "GaussianSplatting"
 
@@ -35,68 +39,123 @@ FNiagaraDataInterfaceProxyGaussianSplattingPointCloud::~FNiagaraDataInterfacePro
 
 }
 
-void FNiagaraDataInterfaceProxyGaussianSplattingPointCloud::MakeBufferDirty()
+void FNiagaraDataInterfaceProxyGaussianSplattingPointCloud::UpdatePointBuffers(FRHICommandListImmediate& RHICmdList, const TArray<FVector4f>& PointData, const TArray<uint32>& PointIndices, const TArray<uint16>& SortedOrders)
 {
-	bDirty = true;
-}
+	UploadedPointCount = PointData.Num() / FGaussianSplattingPoint::NumPackedVectors;
+	int32 NumBytesInBuffer = sizeof(FVector4f) * PointData.Num();
+	if (NumBytesInBuffer != GaussianPointDataBuffer.NumBytes){
+		if (GaussianPointDataBuffer.NumBytes > 0)
+			GaussianPointDataBuffer.Release();
+		if (NumBytesInBuffer > 0)
+			GaussianPointDataBuffer.Initialize(RHICmdList, TEXT("FNiagaraDataInterfaceProxySpectrum_PositionBuffer"), sizeof(FVector4f), PointData.Num(), EPixelFormat::PF_A32B32G32R32F, BUF_Static);
+	}
+	if (GaussianPointDataBuffer.NumBytes > 0){
+		void* BufferData = RHICmdList.LockBuffer(GaussianPointDataBuffer.Buffer, 0, NumBytesInBuffer, EResourceLockMode::RLM_WriteOnly);
+		FPlatformMemory::Memcpy(BufferData, PointData.GetData(), NumBytesInBuffer);
+		RHICmdList.UnlockBuffer(GaussianPointDataBuffer.Buffer);
+	}
 
-void FNiagaraDataInterfaceProxyGaussianSplattingPointCloud::TryUpdateBuffer()
-{
-	if (PointCloud != Owner->PointCloud) {
-		PointCloud = Owner->PointCloud;
-		if (PointCloud) {
-			PointCloud->OnPointsChanged.AddLambda([this]() {
-				bDirty = true;
-			});
-		}
-		bDirty = true;
+	// Permutation from chunk order to point order, visible ranges index into it.
+	NumBytesInBuffer = sizeof(uint32) * PointIndices.Num();
+	if (NumBytesInBuffer != PointIndexBuffer.NumBytes) {
+		if (PointIndexBuffer.NumBytes > 0)
+			PointIndexBuffer.Release();
+		if (NumBytesInBuffer > 0)
+			PointIndexBuffer.Initialize(RHICmdList, TEXT("FNiagaraDataInterfaceProxyGaussianSplattingPointCloud_PointIndexBuffer"), sizeof(uint32), PointIndices.Num(), EPixelFormat::PF_R32_UINT, BUF_Static);
+	}
+	if (PointIndexBuffer.NumBytes > 0) {
+		void* BufferData = RHICmdList.LockBuffer(PointIndexBuffer.Buffer, 0, NumBytesInBuffer, EResourceLockMode::RLM_WriteOnly);
+		FPlatformMemory::Memcpy(BufferData, PointIndices.GetData(), NumBytesInBuffer);
+		RHICmdList.UnlockBuffer(PointIndexBuffer.Buffer);
 	}
-	if (bDirty) {
-		PostDataToGPU();
-		bDirty = false;
+
+	// Presorted back-to-front orders, one block of chunk-local offsets per baked direction.
+	SortedOrderStride = PointIndices.Num();
+	NumBytesInBuffer = sizeof(uint16) * SortedOrders.Num();
+	if (NumBytesInBuffer != SortedOrderBuffer.NumBytes) {
+		if (SortedOrderBuffer.NumBytes > 0)
+			SortedOrderBuffer.Release();
+		if (NumBytesInBuffer > 0)
+			SortedOrderBuffer.Initialize(RHICmdList, TEXT("FNiagaraDataInterfaceProxyGaussianSplattingPointCloud_SortedOrderBuffer"), sizeof(uint16), SortedOrders.Num(), EPixelFormat::PF_R16_UINT, BUF_Static);
+	}
+	if (SortedOrderBuffer.NumBytes > 0) {
+		void* BufferData = RHICmdList.LockBuffer(SortedOrderBuffer.Buffer, 0, NumBytesInBuffer, EResourceLockMode::RLM_WriteOnly);
+		FPlatformMemory::Memcpy(BufferData, SortedOrders.GetData(), NumBytesInBuffer);
+		RHICmdList.UnlockBuffer(SortedOrderBuffer.Buffer);
 	}
 }
 
-void FNiagaraDataInterfaceProxyGaussianSplattingPointCloud::PostDataToGPU()
+void FNiagaraDataInterfaceProxyGaussianSplattingPointCloud::UploadSequenceFrames(FRHICommandListImmediate& RHICmdList, const TSharedPtr<const FGaussianSplattingSequenceFrame>& DisplayedFrame, TConstArrayView<TSharedPtr<const FGaussianSplattingSequenceFrame>> UpcomingFrames)
 {
-	if (Owner == nullptr || Owner->PointCloud == nullptr) {
-		return;
+	// Slots holding any wanted frame are kept first, so uploading one frame never evicts another wanted one.
+	bool bKeepSlot[NumSequenceUploadSlots] = {};
+	auto FindSlot = [this](const TSharedPtr<const FGaussianSplattingSequenceFrame>& Frame) {
+		for (int32 SlotIndex = 0; SlotIndex < NumSequenceUploadSlots; SlotIndex++) {
+			if (SequenceUploadSlots[SlotIndex].Frame.Pin() == Frame) {
+				return SlotIndex;
+			}
+		}
+		return (int32)INDEX_NONE;
+	};
+	TArray<TSharedPtr<const FGaussianSplattingSequenceFrame>, TInlineAllocator<NumSequenceUploadSlots + 1>> WantedFrames;
+	if (DisplayedFrame) {
+		WantedFrames.Add(DisplayedFrame);
 	}
-	const TArray<FGaussianSplattingPoint>& Points = Owner->PointCloud->GetPoints();
-	TArray<FVector4f> PointData;
-
-	const int size_times = 6;
-
-	PointData.SetNum(Points.Num() * size_times);
-	for (int i = 0; i < Points.Num(); i++) {
-		const FGaussianSplattingPoint& Point = Points[i];
-		PointData[i * size_times] = Point.Position;
-		PointData[i * size_times + 1] = FVector4f(Point.Quat.X, Point.Quat.Y, Point.Quat.Z, Point.Quat.W);
-		PointData[i * size_times + 2] = Point.Scale;
-		PointData[i * size_times + 3] = Point.Color;
-		PointData[i * size_times + 4] = Point.Time;
-		PointData[i * size_times + 5] = Point.Motion;
+	for (const TSharedPtr<const FGaussianSplattingSequenceFrame>& Frame : UpcomingFrames) {
+		if (Frame && Frame != DisplayedFrame && WantedFrames.Num() < NumSequenceUploadSlots) {
+			WantedFrames.Add(Frame);
+		}
+	}
+	for (const TSharedPtr<const FGaussianSplattingSequenceFrame>& Frame : WantedFrames) {
+		const int32 SlotIndex = FindSlot(Frame);
+		if (SlotIndex != INDEX_NONE) {
+			bKeepSlot[SlotIndex] = true;
+		}
 	}
 
-	ENQUEUE_RENDER_COMMAND(FUpdateSpectrumBuffer)(
-		[this, PointData](FRHICommandListImmediate& RHICmdList)
-		{
-			const int32 NumBytesInBuffer = sizeof(FVector4f) * PointData.Num();
-
-			if (NumBytesInBuffer != GaussianPointDataBuffer.NumBytes){
-				if (GaussianPointDataBuffer.NumBytes > 0)
-					GaussianPointDataBuffer.Release();
-				if (NumBytesInBuffer > 0)
-					GaussianPointDataBuffer.Initialize(RHICmdList, TEXT("FNiagaraDataInterfaceProxySpectrum_PositionBuffer"), sizeof(FVector4f), PointData.Num(), EPixelFormat::PF_A32B32G32R32F, BUF_Static);
+	DisplayedSequenceSlot = INDEX_NONE;
+	for (const TSharedPtr<const FGaussianSplattingSequenceFrame>& Frame : WantedFrames) {
+		int32 SlotIndex = FindSlot(Frame);
+		if (SlotIndex == INDEX_NONE) {
+			for (int32 FreeIndex = 0; FreeIndex < NumSequenceUploadSlots && SlotIndex == INDEX_NONE; FreeIndex++) {
+				SlotIndex = bKeepSlot[FreeIndex] ? INDEX_NONE : FreeIndex;
 			}
-
-			if (GaussianPointDataBuffer.NumBytes > 0){
-				float* BufferData = static_cast<float*>(RHICmdList.LockBuffer(GaussianPointDataBuffer.Buffer, 0, NumBytesInBuffer, EResourceLockMode::RLM_WriteOnly));
-				FScopeLock ScopeLock(&BufferLock);
-				FPlatformMemory::Memcpy(BufferData, PointData.GetData(), NumBytesInBuffer);
-				RHICmdList.UnlockBuffer(GaussianPointDataBuffer.Buffer);
+			if (SlotIndex == INDEX_NONE) {
+				break;
 			}
-		});
+			bKeepSlot[SlotIndex] = true;
+
+			// The buffers only grow, frame sizes vary a little around the playback.
+			FSequenceUploadSlot& Slot = SequenceUploadSlots[SlotIndex];
+			const int32 NumBytesInBuffer = sizeof(FVector4f) * Frame->PointData.Num();
+			if (NumBytesInBuffer > (int32)Slot.Buffer.NumBytes) {
+				if (Slot.Buffer.NumBytes > 0)
+					Slot.Buffer.Release();
+				Slot.Buffer.Initialize(RHICmdList, TEXT("FNiagaraDataInterfaceProxyGaussianSplattingPointCloud_SequenceBuffer"), sizeof(FVector4f), Frame->PointData.Num(), EPixelFormat::PF_A32B32G32R32F, BUF_Dynamic);
+			}
+			if (NumBytesInBuffer > 0) {
+				void* BufferData = RHICmdList.LockBuffer(Slot.Buffer.Buffer, 0, NumBytesInBuffer, EResourceLockMode::RLM_WriteOnly);
+				FPlatformMemory::Memcpy(BufferData, Frame->PointData.GetData(), NumBytesInBuffer);
+				RHICmdList.UnlockBuffer(Slot.Buffer.Buffer);
+			}
+			Slot.Frame = Frame;
+			Slot.NumPoints = Frame->NumPoints;
+		}
+		if (Frame == DisplayedFrame) {
+			DisplayedSequenceSlot = SlotIndex;
+		}
+	}
+}
+
+void FNiagaraDataInterfaceProxyGaussianSplattingPointCloud::ReleaseSequenceFrames()
+{
+	DisplayedSequenceSlot = INDEX_NONE;
+	for (FSequenceUploadSlot& Slot : SequenceUploadSlots) {
+		if (Slot.Buffer.NumBytes > 0)
+			Slot.Buffer.Release();
+		Slot.Frame.Reset();
+		Slot.NumPoints = 0;
+	}
 }
 
 UNiagaraDataInterfaceGaussianSplattingPointCloud::UNiagaraDataInterfaceGaussianSplattingPointCloud(FObjectInitializer const& ObjectInitializer)
@@ -152,10 +211,58 @@ DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceGaussianSplattingPointCloud,
 
 void UNiagaraDataInterfaceGaussianSplattingPointCloud::SetPointCloud(UGaussianSplattingPointCloud* InPointCloud)
 {
+	if (PointCloud != InPointCloud) {
+		SetLOD(0);
+	}
 	PointCloud = InPointCloud;
-	if (auto DIProxy = GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>()) {
-		DIProxy->MakeBufferDirty();
+	BindPointCloud();
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::BindPointCloud()
+{
+	UGaussianSplattingPointCloud* Bound = BoundPointCloud.Get();
+	if (Bound != PointCloud) {
+		if (Bound) {
+			Bound->OnPointsChanged.Remove(PointsChangedHandle);
+		}
+		PointsChangedHandle = PointCloud ? PointCloud->OnPointsChanged.AddUObject(this, &UNiagaraDataInterfaceGaussianSplattingPointCloud::UploadPoints) : FDelegateHandle();
+		BoundPointCloud = PointCloud;
 	}
+	UploadPoints();
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::UploadPoints()
+{
+	// Editor tools replace the points from worker tasks, the snapshot is still taken on the game thread.
+	if (!IsInGameThread()) {
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UNiagaraDataInterfaceGaussianSplattingPointCloud>(this)]() {
+			if (UNiagaraDataInterfaceGaussianSplattingPointCloud* DataInterface = WeakThis.Get()) {
+				DataInterface->UploadPoints();
+			}
+		});
+		return;
+	}
+	FNiagaraDataInterfaceProxyGaussianSplattingPointCloud* DIProxy = GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>();
+	if (DIProxy == nullptr) {
+		return;
+	}
+	TArray<FVector4f> PointData;
+	TArray<uint32> PointIndices;
+	TArray<uint16> SortedOrders;
+	if (PointCloud) {
+		const TArray<FGaussianSplattingPoint>& Points = PointCloud->GetPoints();
+		PointData.SetNumUninitialized(Points.Num() * FGaussianSplattingPoint::NumPackedVectors);
+		ParallelFor(TEXT("GaussianSplatting.PackPoints"), Points.Num(), 4096, [&](int32 i) {
+			Points[i].Pack(&PointData[i * FGaussianSplattingPoint::NumPackedVectors]);
+		});
+		PointIndices = PointCloud->GetChunkHierarchy().GetPointIndices();
+		SortedOrders = PointCloud->GetChunkHierarchy().GetSortedOrders();
+	}
+	ENQUEUE_RENDER_COMMAND(FUpdatePointBuffers)(
+		[DIProxy, PointData = MoveTemp(PointData), PointIndices = MoveTemp(PointIndices), SortedOrders = MoveTemp(SortedOrders)](FRHICommandListImmediate& RHICmdList)
+		{
+			DIProxy->UpdatePointBuffers(RHICmdList, PointData, PointIndices, SortedOrders);
+		});
 }
 
 UGaussianSplattingPointCloud* UNiagaraDataInterfaceGaussianSplattingPointCloud::GetPointCloud() const
@@ -163,13 +270,305 @@ UGaussianSplattingPointCloud* UNiagaraDataInterfaceGaussianSplattingPointCloud::
 	return PointCloud;
 }
 
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::SetPointBudget(int32 InPointBudget)
+{
+	if (auto DIProxy = GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>()) {
+		DIProxy->PointBudget = InPointBudget;
+	}
+}
+
+int32 UNiagaraDataInterfaceGaussianSplattingPointCloud::GetBudgetedPointCount() const
+{
+	const int32 PointCount = PointCloud ? PointCloud->GetPointCount() : 0;
+	const FNiagaraDataInterfaceProxyGaussianSplattingPointCloud* DIProxy = GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>();
+	return DIProxy ? DIProxy->GetBudgetedPointCount(PointCount) : PointCount;
+}
+
+int32 FNiagaraDataInterfaceProxyGaussianSplattingPointCloud::GetBudgetedPointCount(int32 PointCount) const
+{
+	const int32 Budget = PointBudget.load();
+	const int32 NumSequencePoints = SequencePointCount.load();
+	if (NumSequencePoints != INDEX_NONE) {
+		return Budget == INDEX_NONE ? NumSequencePoints : FMath::Min(NumSequencePoints, Budget);
+	}
+	const int32 NumLODPoints = LODPointCount.load();
+	if (NumLODPoints != INDEX_NONE) {
+		return Budget == INDEX_NONE ? NumLODPoints : FMath::Min(NumLODPoints, Budget);
+	}
+	const int32 NumVisiblePoints = VisiblePointCount.load();
+	const int32 ExposedPointCount = NumVisiblePoints == INDEX_NONE ? PointCount : FMath::Min(PointCount, NumVisiblePoints);
+	return Budget == INDEX_NONE ? ExposedPointCount : FMath::Min(ExposedPointCount, Budget);
+}
+
+int32 UNiagaraDataInterfaceGaussianSplattingPointCloud::GetPointBudget() const
+{
+	const FNiagaraDataInterfaceProxyGaussianSplattingPointCloud* DIProxy = GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>();
+	return DIProxy ? DIProxy->PointBudget.load() : INDEX_NONE;
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::SetVisibleRanges(TArray<FUintVector4>&& InVisibleRanges, int32 InVisiblePointCount)
+{
+	FNiagaraDataInterfaceProxyGaussianSplattingPointCloud* DIProxy = GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>();
+	if (DIProxy == nullptr) {
+		return;
+	}
+	{
+		FRWScopeLock ScopeLock(VisibleRangesLock, SLT_Write);
+		if (InVisibleRanges.IsEmpty() && VisibleRanges.IsEmpty()) {
+			return;
+		}
+		VisibleRanges = InVisibleRanges;
+	}
+	DIProxy->VisiblePointCount = InVisibleRanges.IsEmpty() ? INDEX_NONE : InVisiblePointCount;
+
+	ENQUEUE_RENDER_COMMAND(FUpdateVisibleRangeBuffer)(
+		[DIProxy, Ranges = MoveTemp(InVisibleRanges)](FRHICommandListImmediate& RHICmdList)
+		{
+			DIProxy->NumVisibleRanges = Ranges.Num();
+			if (Ranges.IsEmpty()) {
+				return;
+			}
+			// The buffer only grows, culling changes the range count every frame.
+			const int32 NumBytesInBuffer = sizeof(FUintVector4) * Ranges.Num();
+			if (NumBytesInBuffer > (int32)DIProxy->VisibleRangeBuffer.NumBytes) {
+				if (DIProxy->VisibleRangeBuffer.NumBytes > 0)
+					DIProxy->VisibleRangeBuffer.Release();
+				DIProxy->VisibleRangeBuffer.Initialize(RHICmdList, TEXT("FNiagaraDataInterfaceProxyGaussianSplattingPointCloud_VisibleRangeBuffer"), sizeof(FUintVector4), FMath::RoundUpToPowerOfTwo(Ranges.Num()), EPixelFormat::PF_R32G32B32A32_UINT, BUF_Dynamic);
+			}
+			void* BufferData = RHICmdList.LockBuffer(DIProxy->VisibleRangeBuffer.Buffer, 0, NumBytesInBuffer, EResourceLockMode::RLM_WriteOnly);
+			FPlatformMemory::Memcpy(BufferData, Ranges.GetData(), NumBytesInBuffer);
+			RHICmdList.UnlockBuffer(DIProxy->VisibleRangeBuffer.Buffer);
+		});
+}
+
+int32 UNiagaraDataInterfaceGaussianSplattingPointCloud::GetVisiblePointIndex(int32 Index) const
+{
+	FRWScopeLock ScopeLock(VisibleRangesLock, SLT_ReadOnly);
+	return GetVisiblePointIndexLocked(Index);
+}
+
+int32 UNiagaraDataInterfaceGaussianSplattingPointCloud::GetVisiblePointIndexLocked(int32 Index) const
+{
+	if (CPUSortedOrder.IsValidIndex(Index)) {
+		Index = CPUSortedOrder[Index];
+	}
+	// Coarser levels are drawn whole, without visible ranges.
+	return LODPoints ? Index : PointCloud->GetChunkHierarchy().MapVisibleIndex(VisibleRanges, Index);
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::UpdateCPUSortOrder(const FVector3f* LocalViewOrigin)
+{
+	if (!bSortPointsOnCPU || PointCloud == nullptr || LocalViewOrigin == nullptr || SequenceFrame) {
+		SortTask.Wait();
+		if (!CPUSortedOrder.IsEmpty()) {
+			FRWScopeLock ScopeLock(VisibleRangesLock, SLT_Write);
+			CPUSortedOrder.Reset();
+		}
+		CPUSorter.Reset();
+		return;
+	}
+	// The previous order stays in use for one more frame while its sort is still running.
+	if (!SortTask.IsCompleted()) {
+		return;
+	}
+
+	// Only the game thread writes the ranges and the LOD, so they can be read here without the lock.
+	const TArray<FGaussianSplattingPoint>& Points = LODPoints ? *LODPoints : PointCloud->GetPoints();
+	const FGaussianSplattingChunkHierarchy& Hierarchy = PointCloud->GetChunkHierarchy();
+	TArray<float> Depths;
+	Depths.SetNumUninitialized(GetBudgetedPointCount());
+	ParallelFor(Depths.Num(), [&](int32 i) {
+		const uint32 PointIndex = LODPoints ? i : Hierarchy.MapVisibleIndex(VisibleRanges, i);
+		Depths[i] = Points.IsValidIndex(PointIndex) ? FVector3f::DistSquared(Points[PointIndex].Position, *LocalViewOrigin) : 0.0f;
+	});
+	// An order over a different number of points would map outside the new ranges.
+	if (CPUSortedOrder.Num() != Depths.Num()) {
+		FRWScopeLock ScopeLock(VisibleRangesLock, SLT_Write);
+		CPUSortedOrder.Reset();
+	}
+
+	// Sorting millions of keys takes milliseconds even when the order is only repaired, so it runs off the game thread
+	// and the order is published when it is done.
+	SortTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, Depths = MoveTemp(Depths)]() {
+		CPUSorter.Sort(Depths);
+		TArray<uint32> Order(CPUSorter.GetOrder());
+		FRWScopeLock ScopeLock(VisibleRangesLock, SLT_Write);
+		CPUSortedOrder = MoveTemp(Order);
+	});
+}
+
+bool UNiagaraDataInterfaceGaussianSplattingPointCloud::InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
+{
+	FNDIGaussianSplattingPointCloudInstanceData* InstanceData = new (PerInstanceData) FNDIGaussianSplattingPointCloudInstanceData();
+	InstanceData->InstanceID = SystemInstance->GetId();
+	if (UWorld* World = SystemInstance->GetWorld()) {
+		if (UGaussianSplattingBudgetSubsystem* BudgetSubsystem = World->GetSubsystem<UGaussianSplattingBudgetSubsystem>()) {
+			BudgetSubsystem->Register(this, SystemInstance->GetAttachComponent(), InstanceData->InstanceID);
+			InstanceData->BudgetSubsystem = BudgetSubsystem;
+		}
+	}
+	return true;
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
+{
+	FNDIGaussianSplattingPointCloudInstanceData* InstanceData = static_cast<FNDIGaussianSplattingPointCloudInstanceData*>(PerInstanceData);
+	if (UGaussianSplattingBudgetSubsystem* BudgetSubsystem = InstanceData->BudgetSubsystem.Get()) {
+		BudgetSubsystem->Unregister(InstanceData->InstanceID);
+	}
+	InstanceData->~FNDIGaussianSplattingPointCloudInstanceData();
+}
+
+bool UNiagaraDataInterfaceGaussianSplattingPointCloud::PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds)
+{
+	// Clouds assigned without SetPointCloud, by loading or copying the data interface, are picked up here.
+	if (BoundPointCloud.Get() != PointCloud) {
+		BindPointCloud();
+	}
+	// Mirrors the time selection of the generated HLSL, which receives the system age.
+	const float ExplicitTime = ExplicitPlaybackTime.load();
+	PlaybackTime = ExplicitTime != TNumericLimits<float>::Lowest() ? ExplicitTime : FMath::Fmod((float)SystemInstance->GetAge(), FMath::Max(ClipDuration, UE_KINDA_SMALL_NUMBER));
+	return false;
+}
+
+TOptional<float> UNiagaraDataInterfaceGaussianSplattingPointCloud::GetPlaybackTime() const
+{
+	const float Time = PlaybackTime.load();
+	return Time == TNumericLimits<float>::Lowest() ? TOptional<float>() : TOptional<float>(Time);
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::SetPlaybackTime(float InPlaybackTime, TConstArrayView<FVector2f> ActiveTimeRanges)
+{
+	{
+		FScopeLock ScopeLock(&TimeRangesLock);
+		ExplicitTimeRanges = ActiveTimeRanges;
+	}
+	ExplicitPlaybackTime = InPlaybackTime;
+	PlaybackTime = InPlaybackTime;
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::ClearPlaybackTime()
+{
+	FScopeLock ScopeLock(&TimeRangesLock);
+	ExplicitTimeRanges.Reset();
+	ExplicitPlaybackTime = TNumericLimits<float>::Lowest();
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::GetActiveTimeRanges(TArray<FVector2f>& OutRanges) const
+{
+	OutRanges.Reset();
+	if (ExplicitPlaybackTime.load() != TNumericLimits<float>::Lowest()) {
+		FScopeLock ScopeLock(&TimeRangesLock);
+		OutRanges = ExplicitTimeRanges;
+	}
+	if (OutRanges.IsEmpty()) {
+		if (const TOptional<float> Time = GetPlaybackTime()) {
+			OutRanges.Add(FVector2f(Time.GetValue(), Time.GetValue()));
+		}
+	}
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::SetSequenceFrames(TSharedPtr<const FGaussianSplattingSequenceFrame> DisplayedFrame, TConstArrayView<TSharedPtr<const FGaussianSplattingSequenceFrame>> UpcomingFrames)
+{
+	FNiagaraDataInterfaceProxyGaussianSplattingPointCloud* DIProxy = GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>();
+	if (DIProxy == nullptr) {
+		return;
+	}
+	{
+		FRWScopeLock ScopeLock(VisibleRangesLock, SLT_Write);
+		SequenceFrame = DisplayedFrame;
+	}
+	DIProxy->SequencePointCount = DisplayedFrame ? DisplayedFrame->NumPoints : INDEX_NONE;
+
+	ENQUEUE_RENDER_COMMAND(FUploadSequenceFrames)(
+		[DIProxy, DisplayedFrame, Upcoming = TArray<TSharedPtr<const FGaussianSplattingSequenceFrame>>(UpcomingFrames)](FRHICommandListImmediate& RHICmdList)
+		{
+			DIProxy->UploadSequenceFrames(RHICmdList, DisplayedFrame, Upcoming);
+		});
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::ClearSequenceFrames()
+{
+	FNiagaraDataInterfaceProxyGaussianSplattingPointCloud* DIProxy = GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>();
+	if (DIProxy == nullptr || DIProxy->SequencePointCount.load() == INDEX_NONE) {
+		return;
+	}
+	{
+		FRWScopeLock ScopeLock(VisibleRangesLock, SLT_Write);
+		SequenceFrame.Reset();
+	}
+	DIProxy->SequencePointCount = INDEX_NONE;
+
+	ENQUEUE_RENDER_COMMAND(FReleaseSequenceFrames)(
+		[DIProxy](FRHICommandListImmediate& RHICmdList)
+		{
+			DIProxy->ReleaseSequenceFrames();
+		});
+}
+
+TSharedPtr<const FGaussianSplattingSequenceFrame> UNiagaraDataInterfaceGaussianSplattingPointCloud::GetSequenceFrame() const
+{
+	FRWScopeLock ScopeLock(VisibleRangesLock, SLT_ReadOnly);
+	return SequenceFrame;
+}
+
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::SetLOD(int32 LOD)
+{
+	FNiagaraDataInterfaceProxyGaussianSplattingPointCloud* DIProxy = GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>();
+	if (DIProxy == nullptr) {
+		return;
+	}
+	TSharedPtr<const TArray<FGaussianSplattingPoint>> Points = PointCloud && LOD > 0 ? PointCloud->GetLODPoints(LOD) : nullptr;
+	if (LOD > 0 && !Points) {
+		return;
+	}
+	{
+		// Rebuilt levels come with new points even when the LOD index stays the same.
+		FRWScopeLock ScopeLock(VisibleRangesLock, SLT_Write);
+		if (Points == LODPoints) {
+			return;
+		}
+		LODPoints = Points;
+	}
+	DisplayedLOD = Points ? LOD : 0;
+	DIProxy->LODPointCount = Points ? Points->Num() : INDEX_NONE;
+
+	TArray<FVector4f> PointData;
+	if (Points) {
+		PointData.SetNumUninitialized(Points->Num() * FGaussianSplattingPoint::NumPackedVectors);
+		ParallelFor(TEXT("GaussianSplatting.PackLODPoints"), Points->Num(), 4096, [&](int32 i) {
+			(*Points)[i].Pack(&PointData[i * FGaussianSplattingPoint::NumPackedVectors]);
+		});
+	}
+	ENQUEUE_RENDER_COMMAND(FUpdateLODPointDataBuffer)(
+		[DIProxy, PointData = MoveTemp(PointData)](FRHICommandListImmediate& RHICmdList)
+		{
+			DIProxy->LODBufferPointCount = PointData.Num() / FGaussianSplattingPoint::NumPackedVectors;
+			if (PointData.IsEmpty()) {
+				if (DIProxy->LODPointDataBuffer.NumBytes > 0)
+					DIProxy->LODPointDataBuffer.Release();
+				return;
+			}
+			// The buffer only grows while the LOD changes, it is released when the full cloud is shown again.
+			const int32 NumBytesInBuffer = sizeof(FVector4f) * PointData.Num();
+			if (NumBytesInBuffer > (int32)DIProxy->LODPointDataBuffer.NumBytes) {
+				if (DIProxy->LODPointDataBuffer.NumBytes > 0)
+					DIProxy->LODPointDataBuffer.Release();
+				DIProxy->LODPointDataBuffer.Initialize(RHICmdList, TEXT("FNiagaraDataInterfaceProxyGaussianSplattingPointCloud_LODBuffer"), sizeof(FVector4f), PointData.Num(), EPixelFormat::PF_A32B32G32R32F, BUF_Dynamic);
+			}
+			void* BufferData = RHICmdList.LockBuffer(DIProxy->LODPointDataBuffer.Buffer, 0, NumBytesInBuffer, EResourceLockMode::RLM_WriteOnly);
+			FPlatformMemory::Memcpy(BufferData, PointData.GetData(), NumBytesInBuffer);
+			RHICmdList.UnlockBuffer(DIProxy->LODPointDataBuffer.Buffer);
+		});
+}
+
 void UNiagaraDataInterfaceGaussianSplattingPointCloud::GetPointCount(FVectorVMExternalFunctionContext& Context)
 {
 	VectorVM::FExternalFuncRegisterHandler<int32> OutPointCount(Context);
 
 	for (int32 InstanceIdx = 0; InstanceIdx < Context.GetNumInstances(); ++InstanceIdx)
 	{
-		*OutPointCount.GetDestAndAdvance() = PointCloud->GetPoints().Num();
+		*OutPointCount.GetDestAndAdvance() = GetBudgetedPointCount();
 	}
 }
 
@@ -194,10 +593,27 @@ void UNiagaraDataInterfaceGaussianSplattingPointCloud::GetPointData(FVectorVMExt
 	VectorVM::FExternalFuncRegisterHandler<float> ColorB(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> ColorA(Context);
 
-	auto Points = PointCloud->GetPoints();
+	// A sequence frame replaces the point cloud, its points are read back from the packed upload data.
+	// A coarser LOD is read directly, it is never culled.
+	// The lock is held for the whole batch rather than taken for every instance.
+	FRWScopeLock ScopeLock(VisibleRangesLock, SLT_ReadOnly);
+	const TSharedPtr<const FGaussianSplattingSequenceFrame> Frame = SequenceFrame;
+	const TSharedPtr<const TArray<FGaussianSplattingPoint>> CurrentLODPoints = LODPoints;
+	static const TArray<FGaussianSplattingPoint> NoPoints;
+	const TArray<FGaussianSplattingPoint>& Points = Frame ? NoPoints : CurrentLODPoints ? *CurrentLODPoints : PointCloud ? PointCloud->GetPoints() : NoPoints;
+	// Empty frames, levels or clouds yield an invisible point instead of reading out of bounds.
+	const FGaussianSplattingPoint EmptyPoint(FVector3f::ZeroVector, FQuat4f::Identity, FVector3f::ZeroVector, FLinearColor::Transparent);
 	for (int32 InstanceIdx = 0; InstanceIdx < Context.GetNumInstances(); ++InstanceIdx){
-		int32 Index = InIndex.Get();
-		FGaussianSplattingPoint& Point = Points[Index];
+		FGaussianSplattingPoint Point = EmptyPoint;
+		if (Frame) {
+			if (Frame->NumPoints > 0) {
+				Point = FGaussianSplattingPoint::Unpack(&Frame->PointData[FMath::Clamp(InIndex.Get(), 0, Frame->NumPoints - 1) * FGaussianSplattingPoint::NumPackedVectors]);
+			}
+		}
+		else if (!Points.IsEmpty()) {
+			const int32 PointIndex = CurrentLODPoints ? FMath::Clamp(GetVisiblePointIndexLocked(InIndex.Get()), 0, Points.Num() - 1) : GetVisiblePointIndexLocked(InIndex.Get());
+			Point = Points.IsValidIndex(PointIndex) ? Points[PointIndex] : EmptyPoint;
+		}
 		*PosX.GetDest() = Point.Position.X;
 		*PosY.GetDest() = Point.Position.Y;
 		*PosZ.GetDest() = Point.Position.Z;
@@ -275,6 +691,28 @@ bool UNiagaraDataInterfaceGaussianSplattingPointCloud::GetFunctionHLSL(
 			void {FunctionName}(int In_PointIndex, float In_Time, out float3 Out_Position, out float4 Out_Quat, out float3 Out_Scale, out float4 Out_Color)
 			{
 				int PointIndex = In_PointIndex < {PointCount} ? In_PointIndex : {PointCount} - 1;
+				float Budgeted = In_PointIndex < {PointCount} ? 1.0f : 0.0f;
+				if ({NumVisibleRanges} > 0) {
+					uint Low = 0;
+					uint High = {NumVisibleRanges} - 1;
+					while (Low < High) {
+						uint Mid = (Low + High + 1) / 2;
+						if ({VisibleRangeBuffer}[Mid].x <= (uint)PointIndex) {
+							Low = Mid;
+						}
+						else {
+							High = Mid - 1;
+						}
+					}
+					uint4 Range = {VisibleRangeBuffer}[Low];
+					uint Offset = min((uint)PointIndex - Range.x, Range.z - 1);
+					if (Range.w > 0 && {SortedOrderStride} > 0) {
+						uint Direction = (Range.w - 1) >> 1;
+						Offset = ((Range.w - 1) & 1) ? Range.z - 1 - Offset : Offset;
+						Offset = {SortedOrderBuffer}[Direction * {SortedOrderStride} + Range.y + Offset];
+					}
+					PointIndex = {PointIndexBuffer}[Range.y + Offset];
+				}
 				Out_Position = {PointDataBuffer}.Load(PointIndex * 6 ).xyz;
 				Out_Quat = {PointDataBuffer}.Load(PointIndex *     6 + 1);
 				Out_Scale = {PointDataBuffer}.Load(PointIndex *	   6 + 2).xyz;
@@ -284,7 +722,7 @@ bool UNiagaraDataInterfaceGaussianSplattingPointCloud::GetFunctionHLSL(
                 float4 Out_Time = {PointDataBuffer}.Load(PointIndex *     6 + 4);
                 float4 Out_Motion = {PointDataBuffer}.Load(PointIndex *   6 + 5);
 				
-				float time = fmod(In_Time, 5.0f);
+				float time = {HasPlaybackTime} ? {PlaybackTime} : fmod(In_Time, {ClipDuration});
 
                 float dt = time - Out_Time.x;
 				float3 V = float3(Out_Time.z, Out_Time.w, Out_Motion.x);
@@ -294,7 +732,8 @@ bool UNiagaraDataInterfaceGaussianSplattingPointCloud::GetFunctionHLSL(
 				float trbf_val = dt / exp(Out_Time.y);
 				float visibility = exp(-1.0f * trbf_val * trbf_val);
 
-				Out_Color.a *= visibility;	
+				Out_Color.a *= visibility * Budgeted;
+				Out_Scale *= Budgeted;
 			}
 		)");
 
@@ -304,7 +743,15 @@ bool UNiagaraDataInterfaceGaussianSplattingPointCloud::GetFunctionHLSL(
 		TMap<FString, FStringFormatArg> ArgsBounds = {
 			{TEXT("FunctionName"), FStringFormatArg(FunctionInfo.InstanceName)},
 			{TEXT("PointCount"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + PointCountName)},
+			{TEXT("PlaybackTime"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + PlaybackTimeName)},
+			{TEXT("HasPlaybackTime"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + HasPlaybackTimeName)},
+			{TEXT("ClipDuration"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + ClipDurationName)},
 			{TEXT("PointDataBuffer"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + PointDataBufferName)},
+			{TEXT("NumVisibleRanges"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + NumVisibleRangesName)},
+			{TEXT("PointIndexBuffer"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + PointIndexBufferName)},
+			{TEXT("VisibleRangeBuffer"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + VisibleRangeBufferName)},
+			{TEXT("SortedOrderStride"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + SortedOrderStrideName)},
+			{TEXT("SortedOrderBuffer"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + SortedOrderBufferName)},
 		};
 		OutHLSL += FString::Format(FormatBounds, ArgsBounds);
 		return true;
@@ -339,11 +786,27 @@ void UNiagaraDataInterfaceGaussianSplattingPointCloud::GetParameterDefinitionHLS
 	static const TCHAR* FormatDeclarations = TEXT(R"(		
 		int {PointCountName};
 		Buffer<float4> {PointDataBufferName};
+		uint {NumVisibleRangesName};
+		Buffer<uint> {PointIndexBufferName};
+		Buffer<uint4> {VisibleRangeBufferName};
+		uint {SortedOrderStrideName};
+		Buffer<uint> {SortedOrderBufferName};
+		float {PlaybackTimeName};
+		int {HasPlaybackTimeName};
+		float {ClipDurationName};
 	)");
 
 	TMap<FString, FStringFormatArg> ArgsDeclarations = {
 		{TEXT("PointCountName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + PointCountName)},
 		{TEXT("PointDataBufferName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + PointDataBufferName)},
+		{TEXT("NumVisibleRangesName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + NumVisibleRangesName)},
+		{TEXT("PointIndexBufferName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + PointIndexBufferName)},
+		{TEXT("VisibleRangeBufferName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + VisibleRangeBufferName)},
+		{TEXT("SortedOrderStrideName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + SortedOrderStrideName)},
+		{TEXT("SortedOrderBufferName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + SortedOrderBufferName)},
+		{TEXT("PlaybackTimeName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + PlaybackTimeName)},
+		{TEXT("HasPlaybackTimeName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + HasPlaybackTimeName)},
+		{TEXT("ClipDurationName"), FStringFormatArg(ParamInfo.DataInterfaceHLSLSymbol + ClipDurationName)},
 	};
 	OutHLSL += FString::Format(FormatDeclarations, ArgsDeclarations);
 }
@@ -357,18 +820,44 @@ void UNiagaraDataInterfaceGaussianSplattingPointCloud::BuildShaderParameters(FNi
 void UNiagaraDataInterfaceGaussianSplattingPointCloud::SetShaderParameters(const FNiagaraDataInterfaceSetShaderParametersContext& Context) const
 {
 	FNiagaraDataInterfaceProxyGaussianSplattingPointCloud& DIProxy = Context.GetProxy<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>();
-	DIProxy.TryUpdateBuffer();
 	UNiagaraDataInterfaceGaussianSplattingPointCloud* Current = DIProxy.Owner;
 	FShaderParameters* ShaderParameters = Context.GetParameterNestedStruct<FShaderParameters>();
-	ShaderParameters->PointCount = Current->PointCloud ? Current->PointCloud->GetPoints().Num() : 0;
-	ShaderParameters->PointDataBuffer = FNiagaraRenderer::GetSrvOrDefaultFloat4(DIProxy.GaussianPointDataBuffer.SRV);
+	// Sequence frames are static and unculled, they are read directly at time zero so the temporal terms leave them untouched.
+	const FNiagaraDataInterfaceProxyGaussianSplattingPointCloud::FSequenceUploadSlot* SequenceSlot = DIProxy.DisplayedSequenceSlot != INDEX_NONE ? &DIProxy.SequenceUploadSlots[DIProxy.DisplayedSequenceSlot] : nullptr;
+	const bool bShowSequence = SequenceSlot && SequenceSlot->Buffer.SRV.IsValid();
+	// Coarser LODs are whole clouds in their own buffer, drawn without visible ranges.
+	const bool bShowLOD = !bShowSequence && DIProxy.LODBufferPointCount > 0 && DIProxy.LODPointDataBuffer.SRV.IsValid();
+	// Only proxy state is read here, the cloud may change its points on the game thread meanwhile.
+	const int32 UploadedPointCount = DIProxy.UploadedPointCount.load();
+	if (bShowSequence) {
+		ShaderParameters->PointCount = FMath::Min(DIProxy.GetBudgetedPointCount(UploadedPointCount), SequenceSlot->NumPoints);
+		ShaderParameters->PointDataBuffer = FNiagaraRenderer::GetSrvOrDefaultFloat4(SequenceSlot->Buffer.SRV);
+	}
+	else if (bShowLOD) {
+		ShaderParameters->PointCount = FMath::Min(DIProxy.GetBudgetedPointCount(UploadedPointCount), DIProxy.LODBufferPointCount);
+		ShaderParameters->PointDataBuffer = FNiagaraRenderer::GetSrvOrDefaultFloat4(DIProxy.LODPointDataBuffer.SRV);
+	}
+	else {
+		ShaderParameters->PointCount = DIProxy.GetBudgetedPointCount(UploadedPointCount);
+		ShaderParameters->PointDataBuffer = FNiagaraRenderer::GetSrvOrDefaultFloat4(DIProxy.GaussianPointDataBuffer.SRV);
+	}
+	const bool bUseVisibleRanges = !bShowSequence && !bShowLOD && DIProxy.NumVisibleRanges > 0 && DIProxy.PointIndexBuffer.SRV.IsValid() && DIProxy.VisibleRangeBuffer.SRV.IsValid();
+	ShaderParameters->NumVisibleRanges = bUseVisibleRanges ? DIProxy.NumVisibleRanges : 0;
+	ShaderParameters->PointIndexBuffer = FNiagaraRenderer::GetSrvOrDefaultUInt(DIProxy.PointIndexBuffer.SRV);
+	ShaderParameters->VisibleRangeBuffer = FNiagaraRenderer::GetSrvOrDefaultUInt4(DIProxy.VisibleRangeBuffer.SRV);
+	ShaderParameters->SortedOrderStride = DIProxy.SortedOrderBuffer.SRV.IsValid() ? DIProxy.SortedOrderStride : 0;
+	ShaderParameters->SortedOrderBuffer = FNiagaraRenderer::GetSrvOrDefaultUInt(DIProxy.SortedOrderBuffer.SRV);
+	const float ExplicitTime = bShowSequence ? 0.0f : Current->ExplicitPlaybackTime.load();
+	ShaderParameters->PlaybackTime = ExplicitTime != TNumericLimits<float>::Lowest() ? ExplicitTime : 0.0f;
+	ShaderParameters->HasPlaybackTime = ExplicitTime != TNumericLimits<float>::Lowest() ? 1 : 0;
+	ShaderParameters->ClipDuration = FMath::Max(Current->ClipDuration, UE_KINDA_SMALL_NUMBER);
 }
 
 bool UNiagaraDataInterfaceGaussianSplattingPointCloud::Equals(const UNiagaraDataInterface* Other) const
 {
 	bool bIsEqual = Super::Equals(Other);
 	const UNiagaraDataInterfaceGaussianSplattingPointCloud* OtherPointCloud = CastChecked<const UNiagaraDataInterfaceGaussianSplattingPointCloud>(Other);
-	return OtherPointCloud->PointCloud == PointCloud;
+	return OtherPointCloud->PointCloud == PointCloud && OtherPointCloud->bSortPointsOnCPU == bSortPointsOnCPU && OtherPointCloud->ClipDuration == ClipDuration;
 }
 
 #if WITH_EDITOR
@@ -379,7 +868,7 @@ void UNiagaraDataInterfaceGaussianSplattingPointCloud::PostEditChangeProperty(st
 
 	if (!HasAnyFlags(RF_ClassDefaultObject)){
 		if (PropertyChangedEvent.GetMemberPropertyName() == PointCloudFName) {
-			GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>()->MakeBufferDirty();
+			BindPointCloud();
 		}
 	}
 }
@@ -393,9 +882,6 @@ void UNiagaraDataInterfaceGaussianSplattingPointCloud::PostInitProperties()
 		ENiagaraTypeRegistryFlags Flags = ENiagaraTypeRegistryFlags::AllowAnyVariable | ENiagaraTypeRegistryFlags::AllowParameter;
 		FNiagaraTypeRegistry::Register(FNiagaraTypeDefinition(GetClass()), Flags);
 	}
-	else {
-		GetProxyAs<FNiagaraDataInterfaceProxyGaussianSplattingPointCloud>()->MakeBufferDirty();
-	}
 }
 
 void UNiagaraDataInterfaceGaussianSplattingPointCloud::PostLoad()
@@ -403,6 +889,16 @@ void UNiagaraDataInterfaceGaussianSplattingPointCloud::PostLoad()
 	Super::PostLoad();
 }
 
+void UNiagaraDataInterfaceGaussianSplattingPointCloud::BeginDestroy()
+{
+	SortTask.Wait();
+	if (UGaussianSplattingPointCloud* Bound = BoundPointCloud.Get()) {
+		Bound->OnPointsChanged.Remove(PointsChangedHandle);
+	}
+	BoundPointCloud.Reset();
+	Super::BeginDestroy();
+}
+
 bool UNiagaraDataInterfaceGaussianSplattingPointCloud::CopyToInternal(UNiagaraDataInterface* Destination) const
 {
 	if (!Super::CopyToInternal(Destination)){
@@ -412,6 +908,8 @@ bool UNiagaraDataInterfaceGaussianSplattingPointCloud::CopyToInternal(UNiagaraDa
 	UNiagaraDataInterfaceGaussianSplattingPointCloud* CastedDestination = Cast<UNiagaraDataInterfaceGaussianSplattingPointCloud>(Destination);
 	if (CastedDestination){
 		CastedDestination->PointCloud = PointCloud;
+		CastedDestination->bSortPointsOnCPU = bSortPointsOnCPU;
+		CastedDestination->ClipDuration = ClipDuration;
 	}
 	return true;
 }
@@ -424,5 +922,13 @@ const FName UNiagaraDataInterfaceGaussianSplattingPointCloud::GetPointCountFunct
 // Global variable prefixes, used in HLSL parameter declarations.
 const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::PointCountName(TEXT("_PointCount"));
 const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::PointDataBufferName(TEXT("_PointDataBuffer"));
+const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::NumVisibleRangesName(TEXT("_NumVisibleRanges"));
+const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::PointIndexBufferName(TEXT("_PointIndexBuffer"));
+const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::VisibleRangeBufferName(TEXT("_VisibleRangeBuffer"));
+const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::SortedOrderStrideName(TEXT("_SortedOrderStride"));
+const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::SortedOrderBufferName(TEXT("_SortedOrderBuffer"));
+const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::PlaybackTimeName(TEXT("_PlaybackTime"));
+const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::HasPlaybackTimeName(TEXT("_HasPlaybackTime"));
+const FString UNiagaraDataInterfaceGaussianSplattingPointCloud::ClipDurationName(TEXT("_ClipDuration"));
 
 #undef LOCTEXT_NAMESPACE
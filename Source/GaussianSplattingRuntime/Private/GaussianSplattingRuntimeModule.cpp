@@ -1,8 +1,14 @@
 #include "GaussianSplattingRuntimeModule.h"
 #include "Interfaces/IPluginManager.h"
+#include "GaussianSplattingCustomVersion.h"
+#include "Serialization/CustomVersion.h"
 
 #define LOCTEXT_NAMESPACE "GaussianSplatting"
 
+const FGuid FGaussianSplattingCustomVersion::GUID(0x6C1D2A47, 0x9E3B4F18, 0xA5D07C62, 0x3B8E91F4);
+
+FCustomVersionRegistration GRegisterGaussianSplattingCustomVersion(FGaussianSplattingCustomVersion::GUID, FGaussianSplattingCustomVersion::LatestVersion, TEXT("GaussianSplattingVer"));
+
 void FGaussianSplattingRuntimeModule::StartupModule()
 {
 }
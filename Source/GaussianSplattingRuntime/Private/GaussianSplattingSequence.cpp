@@ -0,0 +1,597 @@
+#include "GaussianSplattingSequence.h"
+#include "Compression/Spz.h"
+#include "GaussianSplattingCustomVersion.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/Compression.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include <atomic>
+
+namespace
+{
+	enum class EFrameType : uint8
+	{
+		Keyframe,
+		Delta,
+	};
+
+	/** Points per independently compressed SPZ block, so keyframes and added splats decompress in parallel. */
+	constexpr int32 PointsPerBlock = 65536;
+
+	constexpr int32 MovesPerBlock = 65536;
+
+	/** SPZ stores positions as fixed point meters with 12 fractional bits, moves are quantized on the same grid. */
+	constexpr float PositionStep = 100.0f / 4096.0f;
+
+	struct FCompressedBlockView
+	{
+		int32 UncompressedSize = 0;
+		TConstArrayView<uint8> Data;
+
+		bool Read(FMemoryReaderView& Reader, TConstArrayView<uint8> Payload)
+		{
+			int32 CompressedSize = 0;
+			Reader << UncompressedSize;
+			Reader << CompressedSize;
+			if (Reader.IsError() || UncompressedSize < 0 || CompressedSize < 0 || Reader.Tell() + CompressedSize > Payload.Num()) {
+				return false;
+			}
+			Data = Payload.Slice((int32)Reader.Tell(), CompressedSize);
+			Reader.Seek(Reader.Tell() + CompressedSize);
+			return true;
+		}
+
+		bool Uncompress(TArray<uint8>& OutData) const
+		{
+			OutData.SetNumUninitialized(UncompressedSize);
+			return UncompressedSize == 0 || FCompression::UncompressMemory(NAME_Zlib, OutData.GetData(), UncompressedSize, Data.GetData(), Data.Num());
+		}
+	};
+
+	void WriteCompressedBlock(FArchive& Writer, TConstArrayView<uint8> Data)
+	{
+		int32 UncompressedSize = Data.Num();
+		int32 CompressedSize = UncompressedSize > 0 ? FCompression::CompressMemoryBound(NAME_Zlib, UncompressedSize) : 0;
+		TArray<uint8> Compressed;
+		Compressed.SetNumUninitialized(CompressedSize);
+		if (UncompressedSize > 0) {
+			verify(FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Data.GetData(), UncompressedSize));
+		}
+		Writer << UncompressedSize;
+		Writer << CompressedSize;
+		Writer.Serialize(Compressed.GetData(), CompressedSize);
+	}
+
+	void WritePointBlocks(FArchive& Writer, const TArray<FGaussianSplattingPoint>& Points)
+	{
+		int32 NumPoints = Points.Num();
+		Writer << NumPoints;
+		TArray<std::vector<uint8_t>> Blocks;
+		Blocks.SetNum(FMath::DivideAndRoundUp(NumPoints, PointsPerBlock));
+		ParallelFor(Blocks.Num(), [&](int32 BlockIndex) {
+			const int32 Begin = BlockIndex * PointsPerBlock;
+			const TArray<FGaussianSplattingPoint> BlockPoints(Points.GetData() + Begin, FMath::Min(PointsPerBlock, NumPoints - Begin));
+			Spz::compress(BlockPoints, 3, 1, Blocks[BlockIndex]);
+		});
+		for (std::vector<uint8_t>& Block : Blocks) {
+			int32 BlockSize = (int32)Block.size();
+			Writer << BlockSize;
+			Writer.Serialize(Block.data(), BlockSize);
+		}
+	}
+
+	bool ReadPointBlocks(FMemoryReaderView& Reader, TConstArrayView<uint8> Payload, TArray<FGaussianSplattingPoint>& Points)
+	{
+		int32 NumPoints = 0;
+		Reader << NumPoints;
+		if (Reader.IsError() || NumPoints < 0) {
+			return false;
+		}
+		TArray<TConstArrayView<uint8>> Blocks;
+		Blocks.SetNum(FMath::DivideAndRoundUp(NumPoints, PointsPerBlock));
+		for (TConstArrayView<uint8>& Block : Blocks) {
+			int32 BlockSize = 0;
+			Reader << BlockSize;
+			if (Reader.IsError() || BlockSize < 0 || Reader.Tell() + BlockSize > Payload.Num()) {
+				return false;
+			}
+			Block = Payload.Slice((int32)Reader.Tell(), BlockSize);
+			Reader.Seek(Reader.Tell() + BlockSize);
+		}
+
+		const int32 FirstPoint = Points.Num();
+		Points.AddUninitialized(NumPoints);
+		std::atomic<bool> bFailed = false;
+		ParallelFor(Blocks.Num(), [&](int32 BlockIndex) {
+			const int32 Begin = BlockIndex * PointsPerBlock;
+			const int32 Count = FMath::Min(PointsPerBlock, NumPoints - Begin);
+			TArray<FGaussianSplattingPoint> BlockPoints;
+			if (!Spz::decompress(std::span<const uint8_t>(Blocks[BlockIndex].GetData(), Blocks[BlockIndex].Num()), BlockPoints) || BlockPoints.Num() != Count) {
+				bFailed = true;
+				return;
+			}
+			FMemory::Memcpy(&Points[FirstPoint + Begin], BlockPoints.GetData(), Count * sizeof(FGaussianSplattingPoint));
+		});
+		return !bFailed;
+	}
+
+	/** Whether two points quantize to the same SPZ orientation, scale, color and opacity. */
+	bool HasSameAppearance(const Spz::PackedGaussians& A, int32 IndexA, const Spz::PackedGaussians& B, int32 IndexB)
+	{
+		return A.alphas[IndexA] == B.alphas[IndexB]
+			&& FMemory::Memcmp(&A.colors[IndexA * 3], &B.colors[IndexB * 3], 3) == 0
+			&& FMemory::Memcmp(&A.scales[IndexA * 3], &B.scales[IndexB * 3], 3) == 0
+			&& FMemory::Memcmp(&A.rotations[IndexA * 3], &B.rotations[IndexB * 3], 3) == 0;
+	}
+
+	/**
+	 * Indices are stored as the gap to the index after the previous one, so consecutive indices are runs of zeros.
+	 * Moves are stored as their indices followed by the X, Y and Z offsets in planes, which zlib compresses best.
+	 */
+	bool DecodeDelta(FMemoryReaderView& Reader, TConstArrayView<uint8> Payload, TArray<FGaussianSplattingPoint>& Points)
+	{
+		int32 NumPrevious = 0;
+		Reader << NumPrevious;
+		if (NumPrevious != Points.Num()) {
+			return false;
+		}
+
+		FCompressedBlockView RemovedBlock;
+		TArray<uint8> RemovedBytes;
+		if (!RemovedBlock.Read(Reader, Payload) || !RemovedBlock.Uncompress(RemovedBytes) || RemovedBytes.Num() % sizeof(uint32) != 0) {
+			return false;
+		}
+
+		int32 NumMoves = 0;
+		Reader << NumMoves;
+		if (Reader.IsError() || NumMoves < 0) {
+			return false;
+		}
+		TArray<FCompressedBlockView> MoveBlocks;
+		MoveBlocks.SetNum(FMath::DivideAndRoundUp(NumMoves, MovesPerBlock));
+		for (FCompressedBlockView& MoveBlock : MoveBlocks) {
+			if (!MoveBlock.Read(Reader, Payload)) {
+				return false;
+			}
+		}
+
+		// Moves address the previous frame, so they apply before the removals compact it.
+		std::atomic<bool> bFailed = false;
+		ParallelFor(MoveBlocks.Num(), [&](int32 BlockIndex) {
+			const int32 Count = FMath::Min(MovesPerBlock, NumMoves - BlockIndex * MovesPerBlock);
+			TArray<uint8> Bytes;
+			if (!MoveBlocks[BlockIndex].Uncompress(Bytes) || Bytes.Num() != Count * (sizeof(uint32) + 3 * sizeof(int16))) {
+				bFailed = true;
+				return;
+			}
+			const uint32* Gaps = reinterpret_cast<const uint32*>(Bytes.GetData());
+			const int16* Offsets = reinterpret_cast<const int16*>(Gaps + Count);
+			uint32 Index = 0;
+			for (int32 i = 0; i < Count; i++) {
+				Index += Gaps[i];
+				if (Index >= (uint32)NumPrevious) {
+					bFailed = true;
+					return;
+				}
+				Points[Index].Position += FVector3f(Offsets[i], Offsets[Count + i], Offsets[2 * Count + i]) * PositionStep;
+				Index++;
+			}
+		});
+		if (bFailed) {
+			return false;
+		}
+
+		const int32 NumRemoved = RemovedBytes.Num() / sizeof(uint32);
+		if (NumRemoved > 0) {
+			const uint32* Gaps = reinterpret_cast<const uint32*>(RemovedBytes.GetData());
+			uint32 Removed = Gaps[0];
+			int32 RemovedCount = 0;
+			int32 WriteIndex = 0;
+			for (int32 ReadIndex = 0; ReadIndex < NumPrevious; ReadIndex++) {
+				if (RemovedCount < NumRemoved && (uint32)ReadIndex == Removed) {
+					RemovedCount++;
+					Removed += 1 + (RemovedCount < NumRemoved ? Gaps[RemovedCount] : 0);
+					continue;
+				}
+				if (WriteIndex != ReadIndex) {
+					Points[WriteIndex] = Points[ReadIndex];
+				}
+				WriteIndex++;
+			}
+			if (RemovedCount != NumRemoved) {
+				return false;
+			}
+			Points.SetNum(WriteIndex);
+		}
+
+		return ReadPointBlocks(Reader, Payload, Points) && !Reader.IsError();
+	}
+}
+
+bool FGaussianSplattingSequenceDecoder::DecodeFrame(int32 InFrameIndex, TConstArrayView<uint8> Payload)
+{
+	FMemoryReaderView Reader(Payload);
+	uint8 Type = 0;
+	Reader << Type;
+	bool bDecoded = false;
+	if (Reader.IsError()) {
+		bDecoded = false;
+	}
+	else if (Type == (uint8)EFrameType::Keyframe) {
+		Points.Reset();
+		bDecoded = ReadPointBlocks(Reader, Payload, Points);
+	}
+	else if (Type == (uint8)EFrameType::Delta && FrameIndex != INDEX_NONE && FrameIndex == InFrameIndex - 1) {
+		bDecoded = DecodeDelta(Reader, Payload, Points);
+	}
+	if (!bDecoded) {
+		Reset();
+		return false;
+	}
+	FrameIndex = InFrameIndex;
+	return true;
+}
+
+void FGaussianSplattingSequenceDecoder::Pack(FGaussianSplattingSequenceFrame& OutFrame) const
+{
+	OutFrame.FrameIndex = FrameIndex;
+	OutFrame.NumPoints = Points.Num();
+	OutFrame.PointData.SetNumUninitialized(Points.Num() * FGaussianSplattingPoint::NumPackedVectors);
+	ParallelFor(TEXT("GaussianSplatting.PackSequenceFrame"), Points.Num(), 4096, [&](int32 i) {
+		Points[i].Pack(&OutFrame.PointData[i * FGaussianSplattingPoint::NumPackedVectors]);
+	});
+}
+
+void FGaussianSplattingSequenceDecoder::Reset()
+{
+	FrameIndex = INDEX_NONE;
+	Points.Reset();
+}
+
+float UGaussianSplattingSequence::GetDuration() const
+{
+	return FrameInfos.Num() / FMath::Max(FrameRate, UE_KINDA_SMALL_NUMBER);
+}
+
+int32 UGaussianSplattingSequence::GetFrameAtTime(float Time) const
+{
+	if (FrameInfos.IsEmpty()) {
+		return INDEX_NONE;
+	}
+	// The bias keeps times computed as Frame / FrameRate on that frame despite rounding.
+	return FMath::Clamp(FMath::FloorToInt32(Time * FrameRate + 1e-3f), 0, FrameInfos.Num() - 1);
+}
+
+int32 UGaussianSplattingSequence::GetKeyframeIndex(int32 FrameIndex) const
+{
+	for (int32 Index = FMath::Min(FrameIndex, FrameInfos.Num() - 1); Index >= 0; Index--) {
+		if (FrameInfos[Index].bKeyframe) {
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int64 UGaussianSplattingSequence::GetFramePayloadSize(int32 FrameIndex) const
+{
+	return FramePayloads.IsValidIndex(FrameIndex) ? FramePayloads[FrameIndex].GetBulkDataSize() : 0;
+}
+
+IBulkDataIORequest* UGaussianSplattingSequence::ReadFramePayload(int32 FrameIndex, TFunction<void(TArray<uint8>&&)> OnRead) const
+{
+	if (!FramePayloads.IsValidIndex(FrameIndex)) {
+		OnRead(TArray<uint8>());
+		return nullptr;
+	}
+	const FByteBulkData& BulkData = FramePayloads[FrameIndex];
+	if (BulkData.IsBulkDataLoaded() || !BulkData.CanLoadFromDisk()) {
+		TArray<uint8> Payload;
+		if (BulkData.IsBulkDataLoaded()) {
+			Payload.Append(static_cast<const uint8*>(BulkData.LockReadOnly()), BulkData.GetBulkDataSize());
+			BulkData.Unlock();
+		}
+		OnRead(MoveTemp(Payload));
+		return nullptr;
+	}
+	FBulkDataIORequestCallBack Callback = [OnRead](bool bWasCancelled, IBulkDataIORequest* Request) {
+		TArray<uint8> Payload;
+		if (uint8* Data = bWasCancelled ? nullptr : Request->GetReadResults()) {
+			Payload.Append(Data, Request->GetSize());
+			FMemory::Free(Data);
+		}
+		OnRead(MoveTemp(Payload));
+	};
+	return BulkData.CreateStreamingRequest(AIOP_High, &Callback, nullptr);
+}
+
+void UGaussianSplattingSequence::AddFrame(const FGaussianSplattingSequenceFrameInfo& Info, const TArray<uint8>& Payload)
+{
+	FrameInfos.Add(Info);
+	FByteBulkData* BulkData = new FByteBulkData();
+	BulkData->SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+	BulkData->Lock(LOCK_READ_WRITE);
+	FMemory::Memcpy(BulkData->Realloc(Payload.Num()), Payload.GetData(), Payload.Num());
+	BulkData->Unlock();
+	FramePayloads.Add(BulkData);
+}
+
+void UGaussianSplattingSequence::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+	Ar.UsingCustomVersion(FGaussianSplattingCustomVersion::GUID);
+	if (!Ar.IsLoading() && !Ar.IsSaving()) {
+		return;
+	}
+
+	Ar << FrameInfos;
+	if (Ar.IsLoading()) {
+		FramePayloads.Reset();
+		for (int32 FrameIndex = 0; FrameIndex < FrameInfos.Num(); FrameIndex++) {
+			FramePayloads.Add(new FByteBulkData());
+		}
+	}
+	for (int32 FrameIndex = 0; FrameIndex < FramePayloads.Num(); FrameIndex++) {
+		FramePayloads[FrameIndex].Serialize(Ar, this, FrameIndex);
+	}
+}
+
+FGaussianSplattingSequenceBuilder::FGaussianSplattingSequenceBuilder(UGaussianSplattingSequence* InSequence)
+	: Sequence(InSequence)
+{
+	check(Sequence);
+	Sequence->FrameInfos.Reset();
+	Sequence->FramePayloads.Reset();
+}
+
+bool FGaussianSplattingSequenceBuilder::AddFrame(const TArray<FGaussianSplattingPoint>& Points, TConstArrayView<uint32> Ids)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGaussianSplattingSequenceBuilder::AddFrame);
+	const int32 FrameIndex = Sequence->GetNumFrames();
+	TArray<uint32> FrameIds;
+	if (Ids.Num() == Points.Num()) {
+		FrameIds.Append(Ids.GetData(), Ids.Num());
+	}
+	else {
+		FrameIds.SetNumUninitialized(Points.Num());
+		for (int32 i = 0; i < Points.Num(); i++) {
+			FrameIds[i] = i;
+		}
+	}
+
+	TArray<uint8> Payload;
+	TBitArray<> Kept;
+	TArray<uint32> AddedIds;
+	bool bKeyframe = FrameIndex % Sequence->GetKeyframeInterval() == 0 || Decoder.GetFrameIndex() != FrameIndex - 1;
+	if (!bKeyframe) {
+		const TArray<FGaussianSplattingPoint>& Previous = Decoder.GetPoints();
+		const Spz::PackedGaussians PreviousPacked = Spz::packGaussians(Previous);
+		const Spz::PackedGaussians FramePacked = Spz::packGaussians(Points);
+		TMap<uint32, int32> SlotOfId;
+		SlotOfId.Reserve(DecodedIds.Num());
+		for (int32 Slot = 0; Slot < DecodedIds.Num(); Slot++) {
+			SlotOfId.Add(DecodedIds[Slot], Slot);
+		}
+
+		// Splats keep their slot when their id survives and their appearance quantizes to the same SPZ values, every other one is re-added.
+		struct FMove
+		{
+			uint32 Slot;
+			int16 Offset[3];
+		};
+		TArray<FMove> Moves;
+		TArray<FGaussianSplattingPoint> Added;
+		Kept.Init(false, Previous.Num());
+		for (int32 i = 0; i < Points.Num(); i++) {
+			const int32* Slot = SlotOfId.Find(FrameIds[i]);
+			if (Slot && !Kept[*Slot] && HasSameAppearance(PreviousPacked, *Slot, FramePacked, i)) {
+				const FVector3f Offset = (Points[i].Position - Previous[*Slot].Position) / PositionStep;
+				if (Offset.GetAbsMax() < (float)(MAX_int16 - 1)) {
+					FMove Move = { (uint32)*Slot, { (int16)FMath::RoundToInt32(Offset.X), (int16)FMath::RoundToInt32(Offset.Y), (int16)FMath::RoundToInt32(Offset.Z) } };
+					if (Move.Offset[0] != 0 || Move.Offset[1] != 0 || Move.Offset[2] != 0) {
+						Moves.Add(Move);
+					}
+					Kept[*Slot] = true;
+					continue;
+				}
+			}
+			Added.Add(Points[i]);
+			AddedIds.Add(FrameIds[i]);
+		}
+
+		// A delta replacing most of the frame is about as large as a keyframe and slower to decode.
+		const int32 NumRemoved = Previous.Num() - Kept.CountSetBits();
+		bKeyframe = NumRemoved + Added.Num() > Previous.Num() / 2;
+		if (!bKeyframe) {
+			Moves.Sort([](const FMove& A, const FMove& B) { return A.Slot < B.Slot; });
+			FMemoryWriter Writer(Payload);
+			uint8 Type = (uint8)EFrameType::Delta;
+			Writer << Type;
+			int32 NumPrevious = Previous.Num();
+			Writer << NumPrevious;
+
+			TArray<uint32> RemovedGaps;
+			RemovedGaps.Reserve(NumRemoved);
+			uint32 NextSlot = 0;
+			for (int32 Slot = 0; Slot < Previous.Num(); Slot++) {
+				if (!Kept[Slot]) {
+					RemovedGaps.Add(Slot - NextSlot);
+					NextSlot = Slot + 1;
+				}
+			}
+			WriteCompressedBlock(Writer, MakeArrayView(reinterpret_cast<const uint8*>(RemovedGaps.GetData()), RemovedGaps.Num() * sizeof(uint32)));
+
+			int32 NumMoves = Moves.Num();
+			Writer << NumMoves;
+			TArray<TArray<uint8>> MoveBlocks;
+			MoveBlocks.SetNum(FMath::DivideAndRoundUp(NumMoves, MovesPerBlock));
+			ParallelFor(MoveBlocks.Num(), [&](int32 BlockIndex) {
+				const int32 Begin = BlockIndex * MovesPerBlock;
+				const int32 Count = FMath::Min(MovesPerBlock, NumMoves - Begin);
+				TArray<uint8> Bytes;
+				Bytes.SetNumUninitialized(Count * (sizeof(uint32) + 3 * sizeof(int16)));
+				uint32* Gaps = reinterpret_cast<uint32*>(Bytes.GetData());
+				int16* Offsets = reinterpret_cast<int16*>(Gaps + Count);
+				uint32 NextIndex = 0;
+				for (int32 i = 0; i < Count; i++) {
+					const FMove& Move = Moves[Begin + i];
+					Gaps[i] = Move.Slot - NextIndex;
+					NextIndex = Move.Slot + 1;
+					for (int32 Axis = 0; Axis < 3; Axis++) {
+						Offsets[Axis * Count + i] = Move.Offset[Axis];
+					}
+				}
+				FMemoryWriter BlockWriter(MoveBlocks[BlockIndex]);
+				WriteCompressedBlock(BlockWriter, Bytes);
+			});
+			for (TArray<uint8>& MoveBlock : MoveBlocks) {
+				Writer.Serialize(MoveBlock.GetData(), MoveBlock.Num());
+			}
+
+			WritePointBlocks(Writer, Added);
+		}
+	}
+	if (bKeyframe) {
+		Payload.Reset();
+		FMemoryWriter Writer(Payload);
+		uint8 Type = (uint8)EFrameType::Keyframe;
+		Writer << Type;
+		WritePointBlocks(Writer, Points);
+	}
+
+	// Decoding the payload gives exactly what the runtime will see, which the next delta is encoded against.
+	if (!Decoder.DecodeFrame(FrameIndex, Payload)) {
+		UE_LOG(LogTemp, Error, TEXT("Failed to decode frame %d right after encoding it."), FrameIndex);
+		return false;
+	}
+	if (bKeyframe) {
+		DecodedIds = MoveTemp(FrameIds);
+		NumKeyframes++;
+		KeyframeBytes += Payload.Num();
+	}
+	else {
+		TArray<uint32> NextIds;
+		NextIds.Reserve(Decoder.GetPoints().Num());
+		for (TConstSetBitIterator<> It(Kept); It; ++It) {
+			NextIds.Add(DecodedIds[It.GetIndex()]);
+		}
+		NextIds.Append(AddedIds);
+		DecodedIds = MoveTemp(NextIds);
+		DeltaBytes += Payload.Num();
+	}
+
+	FGaussianSplattingSequenceFrameInfo Info;
+	Info.bKeyframe = bKeyframe;
+	Info.NumPoints = Decoder.GetPoints().Num();
+	for (const FGaussianSplattingPoint& Point : Decoder.GetPoints()) {
+		Info.Bounds += Point.GetSweptBounds(Point.Time.X, Point.Time.X);
+	}
+	Sequence->AddFrame(Info, Payload);
+	return true;
+}
+
+FGaussianSplattingSequenceStreamer::FGaussianSplattingSequenceStreamer(UGaussianSplattingSequence* InSequence)
+	: Sequence(InSequence)
+	, Decoder(MakeShared<FGaussianSplattingSequenceDecoder>())
+{
+}
+
+FGaussianSplattingSequenceStreamer::~FGaussianSplattingSequenceStreamer()
+{
+	if (PendingRequest) {
+		PendingRequest->Cancel();
+		PendingRequest->WaitCompletion();
+		delete PendingRequest;
+		PendingRequest = nullptr;
+	}
+}
+
+void FGaussianSplattingSequenceStreamer::Update(TConstArrayView<int32> InWantedFrames)
+{
+	WantedFrames = InWantedFrames;
+	ReadyFrames.RemoveAll([this](const TSharedPtr<const FGaussianSplattingSequenceFrame>& Frame) {
+		return !WantedFrames.Contains(Frame->FrameIndex);
+	});
+	DecodeNext();
+}
+
+TSharedPtr<const FGaussianSplattingSequenceFrame> FGaussianSplattingSequenceStreamer::GetFrame(int32 FrameIndex) const
+{
+	const TSharedPtr<const FGaussianSplattingSequenceFrame>* Frame = ReadyFrames.FindByPredicate([FrameIndex](const TSharedPtr<const FGaussianSplattingSequenceFrame>& Ready) {
+		return Ready->FrameIndex == FrameIndex;
+	});
+	return Frame ? *Frame : nullptr;
+}
+
+void FGaussianSplattingSequenceStreamer::DecodeNext()
+{
+	const UGaussianSplattingSequence* CurrentSequence = Sequence.Get();
+	if (bDecoding || CurrentSequence == nullptr) {
+		return;
+	}
+	if (PendingRequest) {
+		PendingRequest->WaitCompletion();
+		delete PendingRequest;
+		PendingRequest = nullptr;
+	}
+
+	int32 TargetFrame = INDEX_NONE;
+	for (int32 FrameIndex : WantedFrames) {
+		if (FrameIndex >= 0 && FrameIndex < CurrentSequence->GetNumFrames() && !FailedFrames.Contains(FrameIndex) && !GetFrame(FrameIndex)) {
+			TargetFrame = FrameIndex;
+			break;
+		}
+	}
+	const int32 Keyframe = TargetFrame != INDEX_NONE ? CurrentSequence->GetKeyframeIndex(TargetFrame) : INDEX_NONE;
+	if (Keyframe == INDEX_NONE) {
+		return;
+	}
+
+	// Carries on from the decoded frame when it lies between the keyframe and the target, seeking restarts from the keyframe.
+	const int32 CurrentFrame = Decoder->GetFrameIndex();
+	const bool bContinue = CurrentFrame >= Keyframe && CurrentFrame <= TargetFrame;
+	const int32 NextFrame = bContinue ? CurrentFrame + 1 : Keyframe;
+	bDecoding = true;
+	TWeakPtr<FGaussianSplattingSequenceStreamer> WeakThis = AsShared();
+	TSharedPtr<FGaussianSplattingSequenceDecoder> DecoderRef = Decoder;
+	if (CurrentFrame == TargetFrame) {
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, DecoderRef, TargetFrame]() {
+			TSharedPtr<FGaussianSplattingSequenceFrame> Frame = MakeShared<FGaussianSplattingSequenceFrame>();
+			DecoderRef->Pack(*Frame);
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, TargetFrame, Frame]() {
+				if (TSharedPtr<FGaussianSplattingSequenceStreamer> This = WeakThis.Pin()) {
+					This->OnFrameDecoded(TargetFrame, Frame, true);
+				}
+			});
+		});
+		return;
+	}
+	PendingRequest = CurrentSequence->ReadFramePayload(NextFrame, [WeakThis, DecoderRef, NextFrame, TargetFrame](TArray<uint8>&& Payload) {
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, DecoderRef, NextFrame, TargetFrame, Payload = MoveTemp(Payload)]() {
+			const bool bDecoded = DecoderRef->DecodeFrame(NextFrame, Payload);
+			TSharedPtr<FGaussianSplattingSequenceFrame> Frame;
+			if (bDecoded && NextFrame == TargetFrame) {
+				Frame = MakeShared<FGaussianSplattingSequenceFrame>();
+				DecoderRef->Pack(*Frame);
+			}
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, TargetFrame, Frame, bDecoded]() {
+				if (TSharedPtr<FGaussianSplattingSequenceStreamer> This = WeakThis.Pin()) {
+					This->OnFrameDecoded(TargetFrame, Frame, bDecoded);
+				}
+			});
+		});
+	});
+}
+
+void FGaussianSplattingSequenceStreamer::OnFrameDecoded(int32 FrameIndex, TSharedPtr<FGaussianSplattingSequenceFrame> Frame, bool bSucceeded)
+{
+	bDecoding = false;
+	if (!bSucceeded) {
+		UE_LOG(LogTemp, Warning, TEXT("Failed to decode the frames leading to frame %d of %s."), FrameIndex, Sequence.IsValid() ? *Sequence->GetPathName() : TEXT("a released sequence"));
+		FailedFrames.Add(FrameIndex);
+	}
+	else if (Frame && WantedFrames.Contains(Frame->FrameIndex)) {
+		ReadyFrames.Add(Frame);
+	}
+	DecodeNext();
+}
@@ -0,0 +1,407 @@
+#include "GaussianSplattingSoftwareRenderer.h"
+#include "GaussianSplattingPointCloud.h"
+#include "GaussianSplattingSorter.h"
+#include "Async/ParallelFor.h"
+
+/** Splat in screen space, with the inverse of its 2D covariance. */
+struct FGaussianSplattingProjectedSplat
+{
+	FVector2f Center = FVector2f::ZeroVector;
+
+	/** Inverse 2D covariance as XX, XY, YY. */
+	FVector3f Conic = FVector3f::ZeroVector;
+
+	FVector3f Color = FVector3f::ZeroVector;
+
+	float Opacity = 0.0f;
+
+	float Radius = 0.0f;
+
+	/** Covered tiles, max exclusive. */
+	FIntRect Tiles;
+};
+
+/** Pinhole intrinsics of a view, in pixels. */
+struct FGaussianSplattingViewIntrinsics
+{
+	FVector2f Focal = FVector2f::ZeroVector;
+
+	FVector2f PrincipalPoint = FVector2f::ZeroVector;
+
+	/** Tangents of the widest half angles from the optical axis to the image borders. */
+	FVector2f TanHalfFov = FVector2f::ZeroVector;
+};
+
+FGaussianSplattingRenderView FGaussianSplattingRenderView::LookAt(const FVector3f& Location, const FVector3f& Target, int32 Width, int32 Height, float FieldOfView)
+{
+	FGaussianSplattingRenderView View;
+	View.Location = Location;
+	View.Rotation = (Target - Location).GetSafeNormal(UE_SMALL_NUMBER, FVector3f::ForwardVector).ToOrientationQuat();
+	View.Width = Width;
+	View.Height = Height;
+	View.FieldOfView = FieldOfView;
+	return View;
+}
+
+static bool ProjectSplat(const FGaussianSplattingPoint& Point, const FGaussianSplattingRenderView& View, const FGaussianSplattingViewIntrinsics& Intrinsics, FIntPoint NumTiles, FGaussianSplattingProjectedSplat& OutSplat, float& OutDepth)
+{
+	// Same motion and visibility as the data interface HLSL, static points have zero time and stay fully visible at time zero.
+	const float DeltaTime = View.Time - Point.Time.X;
+	const float TemporalFalloff = DeltaTime / FMath::Exp(Point.Time.Y);
+	const float Opacity = Point.Color.A * FMath::Exp(-TemporalFalloff * TemporalFalloff);
+	if (Opacity < 1.0f / 255.0f) {
+		return false;
+	}
+	const FVector3f CameraPosition = View.Rotation.UnrotateVector(Point.GetPositionAt(View.Time) - View.Location);
+	const float Depth = CameraPosition.X;
+	if (Depth < View.NearPlane) {
+		return false;
+	}
+
+	// Covariance in camera space, from the axes of the splat scaled by its standard deviations.
+	float Covariance[3][3] = {};
+	const FVector3f Axes[3] = { Point.Quat.GetAxisX(), Point.Quat.GetAxisY(), Point.Quat.GetAxisZ() };
+	for (int32 k = 0; k < 3; k++) {
+		const FVector3f Axis = View.Rotation.UnrotateVector(Axes[k]) * Point.Scale[k];
+		for (int32 Row = 0; Row < 3; Row++) {
+			for (int32 Column = 0; Column < 3; Column++) {
+				Covariance[Row][Column] += Axis[Row] * Axis[Column];
+			}
+		}
+	}
+
+	// Jacobian of the perspective projection at the center, with the lateral offsets clamped a bit outside of the frustum
+	// so splats far off screen do not blow up.
+	const float InvDepth = 1.0f / Depth;
+	const FVector2f& Focal = Intrinsics.Focal;
+	const FVector2f& TanHalfFov = Intrinsics.TanHalfFov;
+	const float Right = FMath::Clamp(CameraPosition.Y * InvDepth, -1.3f * TanHalfFov.X, 1.3f * TanHalfFov.X) * Depth;
+	const float Up = FMath::Clamp(CameraPosition.Z * InvDepth, -1.3f * TanHalfFov.Y, 1.3f * TanHalfFov.Y) * Depth;
+	const float Jacobian[2][3] = {
+		{ -Focal.X * Right * InvDepth * InvDepth, Focal.X * InvDepth, 0.0f },
+		{ Focal.Y * Up * InvDepth * InvDepth, 0.0f, -Focal.Y * InvDepth },
+	};
+	float Projected[2][3] = {};
+	for (int32 Row = 0; Row < 2; Row++) {
+		for (int32 Column = 0; Column < 3; Column++) {
+			for (int32 k = 0; k < 3; k++) {
+				Projected[Row][Column] += Jacobian[Row][k] * Covariance[k][Column];
+			}
+		}
+	}
+	// A small screen space blur keeps subpixel splats at least a pixel wide, like the GPU path.
+	float Covariance2D[3] = { 0.3f, 0.0f, 0.3f };
+	for (int32 k = 0; k < 3; k++) {
+		Covariance2D[0] += Projected[0][k] * Jacobian[0][k];
+		Covariance2D[1] += Projected[0][k] * Jacobian[1][k];
+		Covariance2D[2] += Projected[1][k] * Jacobian[1][k];
+	}
+	const float Determinant = Covariance2D[0] * Covariance2D[2] - Covariance2D[1] * Covariance2D[1];
+	if (Determinant <= 0.0f) {
+		return false;
+	}
+	const float Mid = 0.5f * (Covariance2D[0] + Covariance2D[2]);
+	const float MaxEigenvalue = Mid + FMath::Sqrt(FMath::Max(0.1f, Mid * Mid - Determinant));
+	const float Radius = FMath::CeilToFloat(3.0f * FMath::Sqrt(MaxEigenvalue));
+	const FVector2f Center(Intrinsics.PrincipalPoint.X + Focal.X * CameraPosition.Y * InvDepth, Intrinsics.PrincipalPoint.Y - Focal.Y * CameraPosition.Z * InvDepth);
+
+	const FIntRect Tiles(
+		FMath::Clamp(FMath::FloorToInt32((Center.X - Radius) / GaussianSplattingSoftwareRenderer::TileSize), 0, NumTiles.X),
+		FMath::Clamp(FMath::FloorToInt32((Center.Y - Radius) / GaussianSplattingSoftwareRenderer::TileSize), 0, NumTiles.Y),
+		FMath::Clamp(FMath::FloorToInt32((Center.X + Radius) / GaussianSplattingSoftwareRenderer::TileSize) + 1, 0, NumTiles.X),
+		FMath::Clamp(FMath::FloorToInt32((Center.Y + Radius) / GaussianSplattingSoftwareRenderer::TileSize) + 1, 0, NumTiles.Y));
+	if (Tiles.Min.X >= Tiles.Max.X || Tiles.Min.Y >= Tiles.Max.Y) {
+		return false;
+	}
+	OutSplat.Center = Center;
+	OutSplat.Conic = FVector3f(Covariance2D[2], -Covariance2D[1], Covariance2D[0]) / Determinant;
+	OutSplat.Color = FVector3f(Point.Color.R, Point.Color.G, Point.Color.B);
+	OutSplat.Opacity = Opacity;
+	OutSplat.Radius = Radius;
+	OutSplat.Tiles = Tiles;
+	OutDepth = Depth;
+	return true;
+}
+
+/**
+ * Blends the splats of a tile front to back, a row of four pixels per vector. With bWeights, OutWeights receives the largest
+ * and the summed blending weight of every entry of the tile, and stays zero for the entries skipped once the tile is opaque.
+ */
+template<bool bWeights>
+static void RasterizeTile(FIntPoint TileOrigin, TConstArrayView<uint32> TileSplats, TConstArrayView<FGaussianSplattingProjectedSplat> Splats, const FGaussianSplattingRenderView& View, TArray<FLinearColor>& OutPixels, FVector2f* OutWeights)
+{
+	constexpr int32 TileSize = GaussianSplattingSoftwareRenderer::TileSize;
+	constexpr int32 GroupsPerRow = TileSize / 4;
+	VectorRegister4Float Transmittance[TileSize][GroupsPerRow];
+	VectorRegister4Float Red[TileSize][GroupsPerRow];
+	VectorRegister4Float Green[TileSize][GroupsPerRow];
+	VectorRegister4Float Blue[TileSize][GroupsPerRow];
+	for (int32 Row = 0; Row < TileSize; Row++) {
+		for (int32 Group = 0; Group < GroupsPerRow; Group++) {
+			Transmittance[Row][Group] = VectorOneFloat();
+			Red[Row][Group] = VectorZeroFloat();
+			Green[Row][Group] = VectorZeroFloat();
+			Blue[Row][Group] = VectorZeroFloat();
+		}
+	}
+
+	const VectorRegister4Float PixelOffsets = MakeVectorRegister(0.5f, 1.5f, 2.5f, 3.5f);
+	const VectorRegister4Float MinusHalf = VectorSetFloat1(-0.5f);
+	const VectorRegister4Float MaxAlpha = VectorSetFloat1(0.99f);
+	const VectorRegister4Float MinAlpha = VectorSetFloat1(1.0f / 255.0f);
+	const VectorRegister4Float MinTransmittance = VectorSetFloat1(1e-4f);
+	for (int32 EntryIndex = 0; EntryIndex < TileSplats.Num(); EntryIndex++) {
+		const FGaussianSplattingProjectedSplat& Splat = Splats[TileSplats[EntryIndex]];
+		// Only the rows and four pixel groups within the radius of the splat are touched.
+		const int32 RowBegin = FMath::Max(FMath::FloorToInt32(Splat.Center.Y - Splat.Radius) - TileOrigin.Y, 0);
+		const int32 RowEnd = FMath::Min(FMath::CeilToInt32(Splat.Center.Y + Splat.Radius) - TileOrigin.Y, TileSize);
+		const int32 GroupBegin = FMath::Max(FMath::FloorToInt32(Splat.Center.X - Splat.Radius) - TileOrigin.X, 0) / 4;
+		const int32 GroupEnd = FMath::Min(FMath::DivideAndRoundUp(FMath::CeilToInt32(Splat.Center.X + Splat.Radius) - TileOrigin.X, 4), GroupsPerRow);
+		const VectorRegister4Float ConicX = VectorSetFloat1(Splat.Conic.X);
+		const VectorRegister4Float Opacity = VectorSetFloat1(Splat.Opacity);
+		const VectorRegister4Float ColorR = VectorSetFloat1(Splat.Color.X);
+		const VectorRegister4Float ColorG = VectorSetFloat1(Splat.Color.Y);
+		const VectorRegister4Float ColorB = VectorSetFloat1(Splat.Color.Z);
+		VectorRegister4Float MaxWeight = VectorZeroFloat();
+		VectorRegister4Float SumWeight = VectorZeroFloat();
+		for (int32 Row = RowBegin; Row < RowEnd; Row++) {
+			const float DeltaY = TileOrigin.Y + Row + 0.5f - Splat.Center.Y;
+			const VectorRegister4Float RowTerm = VectorSetFloat1(Splat.Conic.Z * DeltaY * DeltaY);
+			const VectorRegister4Float CrossTerm = VectorSetFloat1(Splat.Conic.Y * DeltaY);
+			for (int32 Group = GroupBegin; Group < GroupEnd; Group++) {
+				const VectorRegister4Float DeltaX = VectorSubtract(VectorAdd(VectorSetFloat1((float)(TileOrigin.X + Group * 4)), PixelOffsets), VectorSetFloat1(Splat.Center.X));
+				// -0.5 * (a dx^2 + c dy^2) - b dx dy
+				const VectorRegister4Float Power = VectorSubtract(
+					VectorMultiply(MinusHalf, VectorMultiplyAdd(ConicX, VectorMultiply(DeltaX, DeltaX), RowTerm)),
+					VectorMultiply(CrossTerm, DeltaX));
+				VectorRegister4Float Alpha = VectorMin(VectorMultiply(Opacity, VectorExp(Power)), MaxAlpha);
+				const VectorRegister4Float Mask = VectorBitwiseAnd(VectorCompareGE(Alpha, MinAlpha), VectorCompareLE(Power, VectorZeroFloat()));
+				Alpha = VectorSelect(Mask, Alpha, VectorZeroFloat());
+				VectorRegister4Float& T = Transmittance[Row][Group];
+				const VectorRegister4Float Weight = VectorMultiply(Alpha, T);
+				Red[Row][Group] = VectorMultiplyAdd(ColorR, Weight, Red[Row][Group]);
+				Green[Row][Group] = VectorMultiplyAdd(ColorG, Weight, Green[Row][Group]);
+				Blue[Row][Group] = VectorMultiplyAdd(ColorB, Weight, Blue[Row][Group]);
+				T = VectorSubtract(T, Weight);
+				if constexpr (bWeights) {
+					MaxWeight = VectorMax(MaxWeight, Weight);
+					SumWeight = VectorAdd(SumWeight, Weight);
+				}
+			}
+		}
+		if constexpr (bWeights) {
+			float Max[4], Sum[4];
+			VectorStore(MaxWeight, Max);
+			VectorStore(SumWeight, Sum);
+			OutWeights[EntryIndex] = FVector2f(FMath::Max(FMath::Max(Max[0], Max[1]), FMath::Max(Max[2], Max[3])), Sum[0] + Sum[1] + Sum[2] + Sum[3]);
+		}
+
+		// Stop once every pixel of the tile is opaque, checked now and then since most tiles never saturate.
+		if ((EntryIndex & 31) == 31) {
+			bool bOpaque = true;
+			for (int32 Row = 0; Row < TileSize && bOpaque; Row++) {
+				for (int32 Group = 0; Group < GroupsPerRow && bOpaque; Group++) {
+					bOpaque = VectorMaskBits(VectorCompareGT(Transmittance[Row][Group], MinTransmittance)) == 0;
+				}
+			}
+			if (bOpaque) {
+				break;
+			}
+		}
+	}
+
+	const FLinearColor& Background = View.BackgroundColor;
+	for (int32 Row = 0; Row < TileSize; Row++) {
+		const int32 Y = TileOrigin.Y + Row;
+		if (Y >= View.Height) {
+			break;
+		}
+		for (int32 Group = 0; Group < GroupsPerRow; Group++) {
+			float T[4], R[4], G[4], B[4];
+			VectorStore(Transmittance[Row][Group], T);
+			VectorStore(Red[Row][Group], R);
+			VectorStore(Green[Row][Group], G);
+			VectorStore(Blue[Row][Group], B);
+			for (int32 Lane = 0; Lane < 4; Lane++) {
+				const int32 X = TileOrigin.X + Group * 4 + Lane;
+				if (X < View.Width) {
+					OutPixels[Y * View.Width + X] = FLinearColor(R[Lane] + T[Lane] * Background.R, G[Lane] + T[Lane] * Background.G, B[Lane] + T[Lane] * Background.B, 1.0f - T[Lane]);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Projects, sorts and bins the points, then rasterizes every tile. OutEntryWeights, when given, receives the blending weights
+ * of the tile entries listed in OutEntries. Returns false when the view needs more tile entries than a pass can hold.
+ */
+static bool RasterizeView(TConstArrayView<FGaussianSplattingPoint> Points, const FGaussianSplattingRenderView& View, TArray<FLinearColor>& OutPixels, TArray<uint32>& OutEntries, TArray<FVector2f>* OutEntryWeights, GaussianSplattingSoftwareRenderer::FStats& Stats)
+{
+	using namespace GaussianSplattingSoftwareRenderer;
+	const int32 Width = FMath::Max(View.Width, 1);
+	const int32 Height = FMath::Max(View.Height, 1);
+	OutPixels.Init(View.BackgroundColor.CopyWithNewOpacity(0.0f), Width * Height);
+	const FIntPoint NumTiles(FMath::DivideAndRoundUp(Width, TileSize), FMath::DivideAndRoundUp(Height, TileSize));
+	const int32 NumTileCount = NumTiles.X * NumTiles.Y;
+	FGaussianSplattingViewIntrinsics Intrinsics;
+	if (View.FocalLength.X > 0.0f && View.FocalLength.Y > 0.0f) {
+		Intrinsics.Focal = View.FocalLength;
+	}
+	else {
+		const float TanHalfFov = FMath::Tan(FMath::DegreesToRadians(FMath::Clamp(View.FieldOfView, 1.0f, 170.0f)) * 0.5f);
+		Intrinsics.Focal = FVector2f(0.5f * Width / TanHalfFov);
+	}
+	Intrinsics.PrincipalPoint = View.PrincipalPoint.IsZero() ? FVector2f(0.5f * Width, 0.5f * Height) : View.PrincipalPoint;
+	Intrinsics.TanHalfFov = FVector2f(
+		FMath::Max(Intrinsics.PrincipalPoint.X, Width - Intrinsics.PrincipalPoint.X) / Intrinsics.Focal.X,
+		FMath::Max(Intrinsics.PrincipalPoint.Y, Height - Intrinsics.PrincipalPoint.Y) / Intrinsics.Focal.Y);
+	FGaussianSplattingRenderView ClampedView = View;
+	ClampedView.Width = Width;
+	ClampedView.Height = Height;
+
+	double StageStart = FPlatformTime::Seconds();
+	const int32 NumPoints = Points.Num();
+	TArray<FGaussianSplattingProjectedSplat> Splats;
+	TArray<float> Depths;
+	TBitArray<> Visible(false, NumPoints);
+	Splats.SetNumUninitialized(NumPoints);
+	Depths.SetNumUninitialized(NumPoints);
+	// Bits of a TBitArray share words, so every block of 32 points is written by a single task.
+	ParallelFor(TEXT("GaussianSplatting.SoftwareProject"), FMath::DivideAndRoundUp(NumPoints, 32), 64, [&](int32 WordIndex) {
+		const int32 End = FMath::Min((WordIndex + 1) * 32, NumPoints);
+		for (int32 i = WordIndex * 32; i < End; i++) {
+			Visible[i] = ProjectSplat(Points[i], ClampedView, Intrinsics, NumTiles, Splats[i], Depths[i]);
+		}
+	});
+
+	// Sorting all splats by depth once and binning them in that order leaves every tile list sorted front to back.
+	TArray<uint32> Keys;
+	TArray<uint32> Order;
+	for (TConstSetBitIterator<> It(Visible); It; ++It) {
+		Keys.Add(GaussianSplattingSort::FloatToSortableKey(Depths[It.GetIndex()]));
+		Order.Add(It.GetIndex());
+	}
+	GaussianSplattingSort::RadixSort(Keys, Order);
+	Keys.Empty();
+	Stats.NumVisibleSplats = Order.Num();
+	Stats.ProjectSeconds = FPlatformTime::Seconds() - StageStart;
+
+	// Stable parallel counting sort by tile: every block of the depth order counts its entries per tile, and the offsets
+	// walk the blocks in order within each tile.
+	StageStart = FPlatformTime::Seconds();
+	const int32 NumBlocks = FMath::Clamp(FMath::DivideAndRoundUp(Order.Num(), 8192), 1, FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1) * 4);
+	const int32 SplatsPerBlock = FMath::DivideAndRoundUp(FMath::Max(Order.Num(), 1), NumBlocks);
+	TArray<int32> BlockOffsets;
+	BlockOffsets.SetNumZeroed(NumBlocks * NumTileCount);
+	ParallelFor(TEXT("GaussianSplatting.SoftwareCount"), NumBlocks, 1, [&](int32 BlockIndex) {
+		int32* Counts = &BlockOffsets[BlockIndex * NumTileCount];
+		const int32 End = FMath::Min((BlockIndex + 1) * SplatsPerBlock, Order.Num());
+		for (int32 i = BlockIndex * SplatsPerBlock; i < End; i++) {
+			const FIntRect& Tiles = Splats[Order[i]].Tiles;
+			for (int32 TileY = Tiles.Min.Y; TileY < Tiles.Max.Y; TileY++) {
+				for (int32 TileX = Tiles.Min.X; TileX < Tiles.Max.X; TileX++) {
+					Counts[TileY * NumTiles.X + TileX]++;
+				}
+			}
+		}
+	});
+	TArray<int32> TileStarts;
+	TileStarts.SetNumUninitialized(NumTileCount + 1);
+	int64 NumEntries = 0;
+	for (int32 Tile = 0; Tile < NumTileCount; Tile++) {
+		TileStarts[Tile] = (int32)NumEntries;
+		for (int32 BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex++) {
+			int32& Offset = BlockOffsets[BlockIndex * NumTileCount + Tile];
+			const int32 Count = Offset;
+			Offset = (int32)NumEntries;
+			NumEntries += Count;
+		}
+	}
+	if (NumEntries > MAX_int32) {
+		UE_LOG(LogTemp, Warning, TEXT("Software render of %d points needs %lld tile entries, too many for a single pass."), NumPoints, NumEntries);
+		return false;
+	}
+	TileStarts[NumTileCount] = (int32)NumEntries;
+	OutEntries.SetNumUninitialized((int32)NumEntries);
+	ParallelFor(TEXT("GaussianSplatting.SoftwareBin"), NumBlocks, 1, [&](int32 BlockIndex) {
+		int32* Offsets = &BlockOffsets[BlockIndex * NumTileCount];
+		const int32 End = FMath::Min((BlockIndex + 1) * SplatsPerBlock, Order.Num());
+		for (int32 i = BlockIndex * SplatsPerBlock; i < End; i++) {
+			const FIntRect& Tiles = Splats[Order[i]].Tiles;
+			for (int32 TileY = Tiles.Min.Y; TileY < Tiles.Max.Y; TileY++) {
+				for (int32 TileX = Tiles.Min.X; TileX < Tiles.Max.X; TileX++) {
+					OutEntries[Offsets[TileY * NumTiles.X + TileX]++] = Order[i];
+				}
+			}
+		}
+	});
+	Stats.NumTileEntries = NumEntries;
+	Stats.BinSeconds = FPlatformTime::Seconds() - StageStart;
+	if (OutEntryWeights) {
+		OutEntryWeights->SetNumZeroed((int32)NumEntries);
+	}
+
+	StageStart = FPlatformTime::Seconds();
+	ParallelFor(TEXT("GaussianSplatting.SoftwareRaster"), NumTileCount, 1, [&](int32 Tile) {
+		const FIntPoint TileOrigin((Tile % NumTiles.X) * TileSize, (Tile / NumTiles.X) * TileSize);
+		const TConstArrayView<uint32> TileSplats(OutEntries.GetData() + TileStarts[Tile], TileStarts[Tile + 1] - TileStarts[Tile]);
+		if (OutEntryWeights) {
+			RasterizeTile<true>(TileOrigin, TileSplats, Splats, ClampedView, OutPixels, OutEntryWeights->GetData() + TileStarts[Tile]);
+		}
+		else {
+			RasterizeTile<false>(TileOrigin, TileSplats, Splats, ClampedView, OutPixels, nullptr);
+		}
+	});
+	Stats.RasterSeconds = FPlatformTime::Seconds() - StageStart;
+	return true;
+}
+
+void GaussianSplattingSoftwareRenderer::Render(TConstArrayView<FGaussianSplattingPoint> Points, const FGaussianSplattingRenderView& View, TArray<FLinearColor>& OutPixels, FStats* OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingSoftwareRenderer::Render);
+	FStats Stats;
+	TArray<uint32> Entries;
+	RasterizeView(Points, View, OutPixels, Entries, nullptr, Stats);
+	if (OutStats) {
+		*OutStats = Stats;
+	}
+}
+
+void GaussianSplattingSoftwareRenderer::AccumulateWeights(TConstArrayView<FGaussianSplattingPoint> Points, const FGaussianSplattingRenderView& View, TArrayView<float> InOutMaxWeights, TArrayView<float> InOutSumWeights, FStats* OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingSoftwareRenderer::AccumulateWeights);
+	check(InOutMaxWeights.Num() == Points.Num() && InOutSumWeights.Num() == Points.Num());
+	FStats Stats;
+	TArray<FLinearColor> Pixels;
+	TArray<uint32> Entries;
+	TArray<FVector2f> EntryWeights;
+	if (RasterizeView(Points, View, Pixels, Entries, &EntryWeights, Stats)) {
+		// A splat has an entry in every tile it overlaps, written by different tasks, so the entries are gathered afterwards.
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++) {
+			const FVector2f Weight = EntryWeights[EntryIndex];
+			const uint32 PointIndex = Entries[EntryIndex];
+			InOutMaxWeights[PointIndex] = FMath::Max(InOutMaxWeights[PointIndex], Weight.X);
+			InOutSumWeights[PointIndex] += Weight.Y;
+		}
+	}
+	if (OutStats) {
+		*OutStats = Stats;
+	}
+}
+
+
+float GaussianSplattingSoftwareRenderer::ComputePSNR(TConstArrayView<FLinearColor> Image, TConstArrayView<FLinearColor> Reference)
+{
+	if (Image.Num() != Reference.Num() || Image.IsEmpty()) {
+		return 0.0f;
+	}
+	double SumSquaredError = 0.0;
+	for (int32 i = 0; i < Image.Num(); i++) {
+		const FLinearColor A = Image[i].GetClamped();
+		const FLinearColor B = Reference[i].GetClamped();
+		SumSquaredError += FMath::Square(A.R - B.R) + FMath::Square(A.G - B.G) + FMath::Square(A.B - B.B);
+	}
+	const double MeanSquaredError = SumSquaredError / (3.0 * Image.Num());
+	return MeanSquaredError > 0.0 ? (float)(-10.0 * FMath::LogX(10.0, MeanSquaredError)) : UE_MAX_FLT;
+}
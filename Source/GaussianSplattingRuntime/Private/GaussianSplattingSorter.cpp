@@ -0,0 +1,151 @@
+#include "GaussianSplattingSorter.h"
+#include "Async/ParallelFor.h"
+#include <atomic>
+
+void GaussianSplattingSort::RadixSort(TArrayView<uint32> Keys, TArrayView<uint32> Values)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GaussianSplattingSort::RadixSort);
+	check(Keys.Num() == Values.Num());
+	const int32 Num = Keys.Num();
+	if (Num <= 1) {
+		return;
+	}
+
+	constexpr int32 RadixBits = 8;
+	constexpr int32 RadixSize = 1 << RadixBits;
+	constexpr int32 MinBlockSize = 64 * 1024;
+	const int32 NumBlocks = FMath::Clamp(Num / MinBlockSize, 1, FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1) * 4);
+	const int32 BlockSize = FMath::DivideAndRoundUp(Num, NumBlocks);
+
+	TArray<uint32> KeyScratch;
+	TArray<uint32> ValueScratch;
+	KeyScratch.SetNumUninitialized(Num);
+	ValueScratch.SetNumUninitialized(Num);
+	TArray<uint32> Histograms;
+	Histograms.SetNumUninitialized(NumBlocks * RadixSize);
+
+	uint32* SourceKeys = Keys.GetData();
+	uint32* SourceValues = Values.GetData();
+	uint32* DestKeys = KeyScratch.GetData();
+	uint32* DestValues = ValueScratch.GetData();
+	for (int32 Shift = 0; Shift < 32; Shift += RadixBits) {
+		ParallelFor(NumBlocks, [&](int32 BlockIndex) {
+			uint32* Histogram = &Histograms[BlockIndex * RadixSize];
+			FMemory::Memzero(Histogram, RadixSize * sizeof(uint32));
+			const int32 End = FMath::Min(Num, (BlockIndex + 1) * BlockSize);
+			for (int32 i = BlockIndex * BlockSize; i < End; i++) {
+				Histogram[(SourceKeys[i] >> Shift) & (RadixSize - 1)]++;
+			}
+		});
+
+		// Digit-major, block-minor offsets keep the scatter stable across blocks.
+		uint32 Offset = 0;
+		bool bSingleDigit = false;
+		for (int32 Digit = 0; Digit < RadixSize; Digit++) {
+			uint32 DigitCount = 0;
+			for (int32 BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex++) {
+				uint32& Count = Histograms[BlockIndex * RadixSize + Digit];
+				DigitCount += Count;
+				const uint32 BlockCount = Count;
+				Count = Offset;
+				Offset += BlockCount;
+			}
+			bSingleDigit |= DigitCount == (uint32)Num;
+		}
+		// Every key shares this digit, the pass would only copy.
+		if (bSingleDigit) {
+			continue;
+		}
+
+		ParallelFor(NumBlocks, [&](int32 BlockIndex) {
+			uint32* Histogram = &Histograms[BlockIndex * RadixSize];
+			const int32 End = FMath::Min(Num, (BlockIndex + 1) * BlockSize);
+			for (int32 i = BlockIndex * BlockSize; i < End; i++) {
+				const uint32 Destination = Histogram[(SourceKeys[i] >> Shift) & (RadixSize - 1)]++;
+				DestKeys[Destination] = SourceKeys[i];
+				DestValues[Destination] = SourceValues[i];
+			}
+		});
+		Swap(SourceKeys, DestKeys);
+		Swap(SourceValues, DestValues);
+	}
+
+	if (SourceKeys != Keys.GetData()) {
+		FMemory::Memcpy(Keys.GetData(), SourceKeys, Num * sizeof(uint32));
+		FMemory::Memcpy(Values.GetData(), SourceValues, Num * sizeof(uint32));
+	}
+}
+
+void FGaussianSplattingDepthSorter::Sort(TConstArrayView<float> Depths, bool bAllowIncremental /*= true*/)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGaussianSplattingDepthSorter::Sort);
+	bWasIncremental = bAllowIncremental && Order.Num() == Depths.Num() && TryRepair(Depths);
+	if (bWasIncremental) {
+		return;
+	}
+
+	const int32 Num = Depths.Num();
+	Order.SetNumUninitialized(Num);
+	Keys.SetNumUninitialized(Num);
+	ParallelFor(Num, [&](int32 i) {
+		// Inverted so the ascending sort puts the farthest points first.
+		Keys[i] = ~GaussianSplattingSort::FloatToSortableKey(Depths[i]);
+		Order[i] = i;
+	});
+	GaussianSplattingSort::RadixSort(Keys, Order);
+}
+
+/**
+ * Insertion sort of Order[Begin, End) by descending depth, ties ordered by index to match the result of the stable radix sort.
+ * Costs one move per inversion, so it is cheap exactly when the camera barely moved. Gives up past MaxMoves.
+ */
+static bool RepairRange(TArray<uint32>& Order, int32 Begin, int32 End, TConstArrayView<float> Depths, int64 MaxMoves)
+{
+	int64 Moves = 0;
+	for (int32 i = Begin + 1; i < End; i++) {
+		const uint32 Index = Order[i];
+		const float Depth = Depths[Index];
+		int32 j = i - 1;
+		while (j >= Begin && (Depths[Order[j]] < Depth || (Depths[Order[j]] == Depth && Order[j] > Index))) {
+			Order[j + 1] = Order[j];
+			j--;
+			if (++Moves > MaxMoves) {
+				return false;
+			}
+		}
+		Order[j + 1] = Index;
+	}
+	return true;
+}
+
+bool FGaussianSplattingDepthSorter::TryRepair(TConstArrayView<float> Depths)
+{
+	// Blocks are repaired in parallel, then a serial pass over the whole order only moves the few keys left inverted across
+	// block boundaries and otherwise costs one comparison per key.
+	const int32 Num = Depths.Num();
+	constexpr int32 MinBlockSize = 64 * 1024;
+	const int32 NumBlocks = FMath::Clamp(Num / MinBlockSize, 1, FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1) * 4);
+	const int32 BlockSize = FMath::DivideAndRoundUp(Num, NumBlocks);
+	const int64 MaxMoves = (int64)(MaxRepairMovesPerKey * Num);
+	TArray<uint32> Repaired = Order;
+	std::atomic<bool> bRepaired = true;
+	ParallelFor(NumBlocks, [&](int32 BlockIndex) {
+		const int32 Begin = BlockIndex * BlockSize;
+		const int32 End = FMath::Min(Num, Begin + BlockSize);
+		if (bRepaired && !RepairRange(Repaired, Begin, End, Depths, MaxMoves * (End - Begin) / FMath::Max(Num, 1))) {
+			bRepaired = false;
+		}
+	});
+	if (!bRepaired || (NumBlocks > 1 && !RepairRange(Repaired, 0, Num, Depths, MaxMoves))) {
+		return false;
+	}
+	Order = MoveTemp(Repaired);
+	return true;
+}
+
+void FGaussianSplattingDepthSorter::Reset()
+{
+	Order.Reset();
+	Keys.Reset();
+	bWasIncremental = false;
+}
@@ -0,0 +1,86 @@
+#include "GaussianSplattingBudgetSubsystem.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGaussianSplattingBudgetAllocateTest, "GaussianSplatting.Budget.Allocate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGaussianSplattingBudgetAllocateTest::RunTest(const FString& Parameters)
+{
+	TArray<int32> PointCounts;
+
+	// Everything fits, each request keeps all of its points.
+	GaussianSplattingBudget::Allocate({ { 1000, 0.5f }, { 2000, 0.0f } }, 10000, 0, PointCounts);
+	TestEqual(TEXT("Unbudgeted first"), PointCounts[0], 1000);
+	TestEqual(TEXT("Unbudgeted second"), PointCounts[1], 2000);
+
+	// Shares follow the coverage.
+	GaussianSplattingBudget::Allocate({ { 100000, 0.75f }, { 100000, 0.25f } }, 1000, 0, PointCounts);
+	TestEqual(TEXT("Proportional total"), PointCounts[0] + PointCounts[1], 1000);
+	TestEqual(TEXT("Proportional first"), PointCounts[0], 750);
+	TestEqual(TEXT("Proportional second"), PointCounts[1], 250);
+
+	// A saturated request hands its surplus to the others.
+	GaussianSplattingBudget::Allocate({ { 100, 0.9f }, { 100000, 0.1f } }, 1000, 0, PointCounts);
+	TestEqual(TEXT("Saturated first"), PointCounts[0], 100);
+	TestEqual(TEXT("Saturated second"), PointCounts[1], 900);
+
+	// Requests off screen still get the minimum share.
+	GaussianSplattingBudget::Allocate({ { 100000, 1.0f }, { 100000, 0.0f } }, 1000, 100, PointCounts);
+	TestEqual(TEXT("Minimum share off screen"), PointCounts[1], 100);
+	TestEqual(TEXT("Minimum share total"), PointCounts[0] + PointCounts[1], 1000);
+
+	// The minimum share shrinks when the budget cannot cover it for every request.
+	GaussianSplattingBudget::Allocate({ { 100000, 0.0f }, { 100000, 0.0f }, { 100000, 0.0f }, { 100000, 0.0f } }, 200, 100, PointCounts);
+	for (int32 Count : PointCounts) {
+		TestEqual(TEXT("Clamped minimum share"), Count, 50);
+	}
+
+	GaussianSplattingBudget::Allocate({}, 1000, 100, PointCounts);
+	TestTrue(TEXT("No requests"), PointCounts.IsEmpty());
+
+	// Random requests never exceed the budget nor their point count, and the same input yields the same counts.
+	FRandomStream Random(1234);
+	for (int32 Iteration = 0; Iteration < 100; Iteration++) {
+		TArray<FGaussianSplattingBudgetRequest> Requests;
+		Requests.SetNum(Random.RandRange(1, 64));
+		int64 TotalPoints = 0;
+		for (FGaussianSplattingBudgetRequest& Request : Requests) {
+			Request.PointCount = Random.RandRange(0, 1000000);
+			Request.ScreenCoverage = Random.FRand() < 0.2f ? 0.0f : Random.FRand();
+			TotalPoints += Request.PointCount;
+		}
+		const int64 TotalBudget = Random.RandRange(0, 4000000);
+		const int32 MinPointsPerRequest = Random.RandRange(0, 10000);
+		GaussianSplattingBudget::Allocate(Requests, TotalBudget, MinPointsPerRequest, PointCounts);
+
+		int64 Allocated = 0;
+		for (int32 i = 0; i < Requests.Num(); i++) {
+			if (PointCounts[i] < 0 || PointCounts[i] > Requests[i].PointCount) {
+				AddError(FString::Printf(TEXT("Iteration %d: request %d got %d of %d points"), Iteration, i, PointCounts[i], Requests[i].PointCount));
+				return false;
+			}
+			Allocated += PointCounts[i];
+		}
+		if (Allocated > FMath::Max(TotalBudget, (int64)0)) {
+			AddError(FString::Printf(TEXT("Iteration %d: %lld points allocated for a budget of %lld"), Iteration, Allocated, TotalBudget));
+			return false;
+		}
+		if (TotalPoints <= TotalBudget && Allocated != TotalPoints) {
+			AddError(FString::Printf(TEXT("Iteration %d: %lld of %lld points allocated under budget"), Iteration, Allocated, TotalPoints));
+			return false;
+		}
+
+		TArray<int32> RepeatedCounts;
+		GaussianSplattingBudget::Allocate(Requests, TotalBudget, MinPointsPerRequest, RepeatedCounts);
+		if (RepeatedCounts != PointCounts) {
+			AddError(FString::Printf(TEXT("Iteration %d: the allocation is not deterministic"), Iteration));
+			return false;
+		}
+	}
+	return true;
+}
+
+#endif
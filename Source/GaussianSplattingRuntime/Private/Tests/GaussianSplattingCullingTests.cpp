@@ -0,0 +1,126 @@
+#include "GaussianSplattingChunkHierarchy.h"
+#include "GaussianSplattingPointCloud.h"
+#include "ConvexVolume.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GaussianSplattingCullingTests
+{
+	constexpr int32 GridSize = 32;
+	constexpr float GridSpacing = 100.0f;
+
+	/** Grid of small splats, split into two segments so culling can be restricted to the first one. */
+	static TArray<FGaussianSplattingPoint> MakeGridPoints()
+	{
+		TArray<FGaussianSplattingPoint> Points;
+		Points.Reserve(GridSize * GridSize * GridSize);
+		for (int32 X = 0; X < GridSize; X++) {
+			for (int32 Y = 0; Y < GridSize; Y++) {
+				for (int32 Z = 0; Z < GridSize; Z++) {
+					Points.Add(FGaussianSplattingPoint(FVector3f(X, Y, Z) * GridSpacing, FQuat4f::Identity, FVector3f(1.0f)));
+				}
+			}
+		}
+		return Points;
+	}
+
+	/** Frustum whose planes face outwards and bound X to [MinX, MaxX], the other axes are unbounded. */
+	static FConvexVolume MakeSlabFrustum(float MinX, float MaxX)
+	{
+		TArray<FPlane> Planes;
+		Planes.Add(FPlane(FVector(1.0, 0.0, 0.0), MaxX));
+		Planes.Add(FPlane(FVector(-1.0, 0.0, 0.0), -MinX));
+		return FConvexVolume(Planes);
+	}
+
+	static bool OverlapsSlab(const FBox3f& Bounds, float MinX, float MaxX)
+	{
+		return Bounds.Max.X >= MinX && Bounds.Min.X <= MaxX;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGaussianSplattingChunkCullingTest, "GaussianSplatting.ChunkHierarchy.Cull",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGaussianSplattingChunkCullingTest::RunTest(const FString& Parameters)
+{
+	using namespace GaussianSplattingCullingTests;
+	const TArray<FGaussianSplattingPoint> Points = MakeGridPoints();
+	const TArray<int32> SegmentEnds = { Points.Num() / 2, Points.Num() };
+	FGaussianSplattingChunkHierarchy Hierarchy;
+	Hierarchy.Build(Points, SegmentEnds, 256, 0);
+	const TConstArrayView<FGaussianSplattingChunk> Chunks = Hierarchy.GetChunks();
+	TestEqual(TEXT("Chunk count"), Hierarchy.GetNumChunks(), Points.Num() / 256);
+
+	TArray<int32> VisibleChunks;
+	Hierarchy.Cull({}, FVector3f::ZeroVector, 0.0f, SegmentEnds.Num(), VisibleChunks);
+	TestEqual(TEXT("Unculled chunks"), VisibleChunks.Num(), Hierarchy.GetNumChunks());
+
+	// Chunks are kept exactly when their bounds overlap one of the frustums, in chunk order.
+	const float SlabMin[2] = { 250.0f, 2450.0f };
+	const float SlabMax[2] = { 650.0f, 2550.0f };
+	const TArray<FConvexVolume> Frustums = { MakeSlabFrustum(SlabMin[0], SlabMax[0]), MakeSlabFrustum(SlabMin[1], SlabMax[1]) };
+	Hierarchy.Cull(Frustums, FVector3f::ZeroVector, 0.0f, SegmentEnds.Num(), VisibleChunks);
+	TArray<int32> ExpectedChunks;
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ChunkIndex++) {
+		if (OverlapsSlab(Chunks[ChunkIndex].Bounds, SlabMin[0], SlabMax[0]) || OverlapsSlab(Chunks[ChunkIndex].Bounds, SlabMin[1], SlabMax[1])) {
+			ExpectedChunks.Add(ChunkIndex);
+		}
+	}
+	TestTrue(TEXT("Some chunks are culled"), ExpectedChunks.Num() > 0 && ExpectedChunks.Num() < Chunks.Num());
+	TestTrue(TEXT("Frustum culled chunks"), VisibleChunks == ExpectedChunks);
+
+	// The compacted ranges expose every point of the visible chunks exactly once, which includes every point inside the frustums.
+	TArray<FUintVector4> Ranges;
+	const int32 NumVisiblePoints = Hierarchy.BuildVisibleRanges(VisibleChunks, Ranges);
+	int32 ExpectedVisiblePoints = 0;
+	for (int32 ChunkIndex : VisibleChunks) {
+		ExpectedVisiblePoints += Chunks[ChunkIndex].NumPoints;
+	}
+	TestEqual(TEXT("Visible point count"), NumVisiblePoints, ExpectedVisiblePoints);
+	TestTrue(TEXT("Adjacent chunks are merged"), Ranges.Num() <= VisibleChunks.Num());
+	TBitArray<> Seen(false, Points.Num());
+	for (int32 Index = 0; Index < NumVisiblePoints; Index++) {
+		const uint32 PointIndex = Hierarchy.MapVisibleIndex(Ranges, Index);
+		if (PointIndex >= (uint32)Points.Num() || Seen[PointIndex]) {
+			AddError(FString::Printf(TEXT("Visible index %d maps to point %u, which is out of range or already mapped"), Index, PointIndex));
+			return false;
+		}
+		Seen[PointIndex] = true;
+	}
+	for (int32 PointIndex = 0; PointIndex < Points.Num(); PointIndex++) {
+		const float X = Points[PointIndex].Position.X;
+		if (((X >= SlabMin[0] && X <= SlabMax[0]) || (X >= SlabMin[1] && X <= SlabMax[1])) && !Seen[PointIndex]) {
+			AddError(FString::Printf(TEXT("Point %d inside a frustum is culled"), PointIndex));
+			return false;
+		}
+	}
+
+	// The distance test keeps the chunks whose bounds come within MaxDistance of the origin.
+	const FVector3f ViewOrigin(1600.0f, 1600.0f, 1600.0f);
+	const float MaxDistance = 500.0f;
+	Hierarchy.Cull({}, ViewOrigin, MaxDistance, SegmentEnds.Num(), VisibleChunks);
+	ExpectedChunks.Reset();
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ChunkIndex++) {
+		if (Chunks[ChunkIndex].Bounds.ComputeSquaredDistanceToPoint(ViewOrigin) <= MaxDistance * MaxDistance) {
+			ExpectedChunks.Add(ChunkIndex);
+		}
+	}
+	TestTrue(TEXT("Some chunks are in range"), ExpectedChunks.Num() > 0 && ExpectedChunks.Num() < Chunks.Num());
+	TestTrue(TEXT("Distance culled chunks"), VisibleChunks == ExpectedChunks);
+
+	// Only the chunks of resident segments are returned.
+	Hierarchy.Cull(Frustums, FVector3f::ZeroVector, 0.0f, 1, VisibleChunks);
+	const int32 NumResidentChunks = Hierarchy.GetNumChunksForSegments(1);
+	TestTrue(TEXT("Resident chunks"), NumResidentChunks > 0 && NumResidentChunks < Chunks.Num());
+	for (int32 ChunkIndex : VisibleChunks) {
+		if (ChunkIndex >= NumResidentChunks) {
+			AddError(FString::Printf(TEXT("Chunk %d of a missing segment is visible"), ChunkIndex));
+			return false;
+		}
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,52 @@
+#include "GaussianSplattingPlaybackComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGaussianSplattingPlaybackEvaluateTimeTest, "GaussianSplatting.Playback.EvaluateTime",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGaussianSplattingPlaybackEvaluateTimeTest::RunTest(const FString& Parameters)
+{
+	auto Evaluate = [](float RawTime, EGaussianSplattingLoopMode LoopMode) {
+		return UGaussianSplattingPlaybackComponent::EvaluateTime(RawTime, 4.0f, LoopMode);
+	};
+	constexpr float Tolerance = 1e-4f;
+
+	TestEqual(TEXT("Loop inside the clip"), Evaluate(1.5f, EGaussianSplattingLoopMode::Loop), 1.5f, Tolerance);
+	TestEqual(TEXT("Loop wraps past the end"), Evaluate(9.0f, EGaussianSplattingLoopMode::Loop), 1.0f, Tolerance);
+	TestEqual(TEXT("Loop wraps negative times"), Evaluate(-1.0f, EGaussianSplattingLoopMode::Loop), 3.0f, Tolerance);
+	TestEqual(TEXT("Loop starts over at the duration"), Evaluate(4.0f, EGaussianSplattingLoopMode::Loop), 0.0f, Tolerance);
+
+	TestEqual(TEXT("Once inside the clip"), Evaluate(2.5f, EGaussianSplattingLoopMode::Once), 2.5f, Tolerance);
+	TestEqual(TEXT("Once holds the last frame"), Evaluate(9.0f, EGaussianSplattingLoopMode::Once), 4.0f, Tolerance);
+	TestEqual(TEXT("Once holds the first frame"), Evaluate(-3.0f, EGaussianSplattingLoopMode::Once), 0.0f, Tolerance);
+
+	TestEqual(TEXT("PingPong forward"), Evaluate(1.0f, EGaussianSplattingLoopMode::PingPong), 1.0f, Tolerance);
+	TestEqual(TEXT("PingPong turns at the duration"), Evaluate(4.0f, EGaussianSplattingLoopMode::PingPong), 4.0f, Tolerance);
+	TestEqual(TEXT("PingPong backward"), Evaluate(5.0f, EGaussianSplattingLoopMode::PingPong), 3.0f, Tolerance);
+	TestEqual(TEXT("PingPong second period"), Evaluate(9.0f, EGaussianSplattingLoopMode::PingPong), 1.0f, Tolerance);
+	TestEqual(TEXT("PingPong negative times"), Evaluate(-1.0f, EGaussianSplattingLoopMode::PingPong), 1.0f, Tolerance);
+
+	// Degenerate inputs stay at the start of the clip instead of producing NaNs.
+	for (const EGaussianSplattingLoopMode LoopMode : { EGaussianSplattingLoopMode::Loop, EGaussianSplattingLoopMode::Once, EGaussianSplattingLoopMode::PingPong }) {
+		TestEqual(TEXT("Zero duration"), UGaussianSplattingPlaybackComponent::EvaluateTime(3.0f, 0.0f, LoopMode), 0.0f);
+		TestEqual(TEXT("Negative duration"), UGaussianSplattingPlaybackComponent::EvaluateTime(3.0f, -1.0f, LoopMode), 0.0f);
+		TestEqual(TEXT("NaN time"), Evaluate(NAN, LoopMode), 0.0f);
+		TestEqual(TEXT("Infinite time"), Evaluate(INFINITY, LoopMode), 0.0f);
+	}
+
+	// Long playback keeps the result in range despite the float error of large times.
+	for (float RawTime = 0.0f; RawTime < 100000.0f; RawTime += 977.3f) {
+		for (const EGaussianSplattingLoopMode LoopMode : { EGaussianSplattingLoopMode::Loop, EGaussianSplattingLoopMode::PingPong }) {
+			const float ClipTime = Evaluate(RawTime, LoopMode);
+			if (ClipTime < 0.0f || ClipTime > 4.0f) {
+				AddError(FString::Printf(TEXT("%g evaluates to %g, outside the clip"), RawTime, ClipTime));
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+#endif
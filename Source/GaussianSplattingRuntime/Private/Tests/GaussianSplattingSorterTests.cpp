@@ -0,0 +1,120 @@
+#include "GaussianSplattingSorter.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include <algorithm>
+#include <vector>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GaussianSplattingSorterTests
+{
+	/** Indices by descending depth, ties by index, which is what the stable radix sort produces. */
+	static std::vector<uint32> SortReference(TConstArrayView<float> Depths)
+	{
+		std::vector<uint32> Reference(Depths.Num());
+		for (int32 i = 0; i < Depths.Num(); i++) {
+			Reference[i] = i;
+		}
+		std::sort(Reference.begin(), Reference.end(), [&Depths](uint32 A, uint32 B) {
+			return Depths[A] > Depths[B] || (Depths[A] == Depths[B] && A < B);
+		});
+		return Reference;
+	}
+
+	static bool MatchesReference(TConstArrayView<uint32> Order, const std::vector<uint32>& Reference)
+	{
+		return Order.Num() == (int32)Reference.size() && FMemory::Memcmp(Order.GetData(), Reference.data(), Reference.size() * sizeof(uint32)) == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGaussianSplattingRadixSortTest, "GaussianSplatting.Sort.RadixSort",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGaussianSplattingRadixSortTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(31);
+	// Small inputs take a single block, the large one is split across workers. Few distinct keys exercise stability and skipped digits.
+	for (const int32 Count : { 0, 1, 7, 1000, 300000 }) {
+		for (const uint32 KeyRange : { 16u, MAX_uint32 }) {
+			TArray<uint32> Keys;
+			TArray<uint32> Values;
+			std::vector<std::pair<uint32, uint32>> Reference;
+			for (int32 i = 0; i < Count; i++) {
+				Keys.Add(KeyRange == MAX_uint32 ? (uint32)Random.GetUnsignedInt() : (uint32)Random.RandHelper(KeyRange));
+				Values.Add(i);
+				Reference.emplace_back(Keys.Last(), i);
+			}
+			std::stable_sort(Reference.begin(), Reference.end(), [](const std::pair<uint32, uint32>& A, const std::pair<uint32, uint32>& B) {
+				return A.first < B.first;
+			});
+			GaussianSplattingSort::RadixSort(Keys, Values);
+			for (int32 i = 0; i < Count; i++) {
+				if (Keys[i] != Reference[i].first || Values[i] != Reference[i].second) {
+					AddError(FString::Printf(TEXT("%d keys below %u: entry %d is (%u, %u), expected (%u, %u)"), Count, KeyRange, i, Keys[i], Values[i], Reference[i].first, Reference[i].second));
+					return false;
+				}
+			}
+		}
+	}
+
+	// Float keys keep their order, negative values and zeros included.
+	const float Floats[] = { -UE_MAX_FLT, -1000.0f, -1.0f, -UE_SMALL_NUMBER, -0.0f, 0.0f, UE_SMALL_NUMBER, 1.0f, 1000.0f, UE_MAX_FLT };
+	for (int32 i = 1; i < UE_ARRAY_COUNT(Floats); i++) {
+		TestTrue(FString::Printf(TEXT("Sortable key of %g"), Floats[i]), GaussianSplattingSort::FloatToSortableKey(Floats[i - 1]) <= GaussianSplattingSort::FloatToSortableKey(Floats[i]));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGaussianSplattingDepthSorterTest, "GaussianSplatting.Sort.DepthSorter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGaussianSplattingDepthSorterTest::RunTest(const FString& Parameters)
+{
+	using namespace GaussianSplattingSorterTests;
+	FRandomStream Random(131);
+	for (const int32 Count : { 1000, 500000 }) {
+		TArray<float> Depths;
+		Depths.SetNumUninitialized(Count);
+		for (float& Depth : Depths) {
+			Depth = Random.FRandRange(-1000.0f, 1000.0f);
+		}
+		// Rounded depths give plenty of ties, which must come out in index order.
+		for (int32 i = 0; i < Count; i += 3) {
+			Depths[i] = FMath::RoundToFloat(Depths[i]);
+		}
+
+		FGaussianSplattingDepthSorter Sorter;
+		Sorter.Sort(Depths);
+		TestFalse(FString::Printf(TEXT("%d keys: first sort is full"), Count), Sorter.WasIncremental());
+		TestTrue(FString::Printf(TEXT("%d keys: full sort"), Count), MatchesReference(Sorter.GetOrder(), SortReference(Depths)));
+
+		// A small camera move only swaps close neighbours, the previous order is repaired. The ties are kept.
+		for (int32 i = 0; i < Count; i++) {
+			if (i % 3 != 0) {
+				Depths[i] += Random.FRandRange(-0.01f, 0.01f);
+			}
+		}
+		Sorter.Sort(Depths);
+		TestTrue(FString::Printf(TEXT("%d keys: small move is repaired"), Count), Sorter.WasIncremental());
+		TestTrue(FString::Printf(TEXT("%d keys: repaired order"), Count), MatchesReference(Sorter.GetOrder(), SortReference(Depths)));
+
+		// A large move exceeds the repair budget and falls back to a full sort.
+		for (float& Depth : Depths) {
+			Depth = -Depth + Random.FRandRange(-100.0f, 100.0f);
+		}
+		Sorter.Sort(Depths);
+		TestFalse(FString::Printf(TEXT("%d keys: large move is sorted again"), Count), Sorter.WasIncremental());
+		TestTrue(FString::Printf(TEXT("%d keys: resorted order"), Count), MatchesReference(Sorter.GetOrder(), SortReference(Depths)));
+
+		// Incremental sorting can be disabled, and a different count always sorts from scratch.
+		Sorter.Sort(Depths, false);
+		TestFalse(FString::Printf(TEXT("%d keys: incremental disabled"), Count), Sorter.WasIncremental());
+		Depths.SetNum(Count / 2);
+		Sorter.Sort(Depths);
+		TestFalse(FString::Printf(TEXT("%d keys: count changed"), Count), Sorter.WasIncremental());
+		TestTrue(FString::Printf(TEXT("%d keys: order after the count changed"), Count), MatchesReference(Sorter.GetOrder(), SortReference(Depths)));
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGaussianSplattingPoint;
+
+/** Synthetic clouds shared by the benchmark console commands of the runtime and editor modules. */
+namespace GaussianSplattingBenchmarks
+{
+	/**
+	 * Clusters of 4096 points scattered over 500 m, which roughly look like a captured scene where uniform noise would make
+	 * every chunk span the whole cloud. The same NumPoints always gives the same points.
+	 */
+	GAUSSIANSPLATTINGRUNTIME_API TArray<FGaussianSplattingPoint> MakeBenchmarkPoints(int32 NumPoints);
+}
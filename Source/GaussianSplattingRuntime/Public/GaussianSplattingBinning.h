@@ -0,0 +1,154 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGaussianSplattingPoint;
+
+/**
+ * Splits the points of many placed clouds into square cells on the XY plane in a single pass over the points: the cell
+ * of every point is computed in parallel, then a counting sort with per block prefix sums scatters the points into one
+ * contiguous range per cell, keeping the order of the sources.
+ */
+namespace GaussianSplattingBinning
+{
+	struct FSource
+	{
+		TConstArrayView<FGaussianSplattingPoint> Points;
+
+		/** Location the points of the source are placed at. */
+		FVector Offset = FVector::ZeroVector;
+	};
+
+	struct FCells
+	{
+		/** Grid coordinates of the cells holding points, row by row. */
+		TArray<FIntPoint> Cells;
+
+		/** Points of cell i are Points[CellStarts[i], CellStarts[i + 1]). */
+		TArray<int32> CellStarts;
+
+		TArray<FGaussianSplattingPoint> Points;
+
+		TConstArrayView<FGaussianSplattingPoint> GetCellPoints(int32 CellIndex) const
+		{
+			return TConstArrayView<FGaussianSplattingPoint>(Points.GetData() + CellStarts[CellIndex], CellStarts[CellIndex + 1] - CellStarts[CellIndex]);
+		}
+	};
+
+	struct FStats
+	{
+		int32 NumBlocks = 0;
+
+		double BoundsSeconds = 0.0;
+		double CountSeconds = 0.0;
+
+		/** Morton ordering of the octree, the grid does not sort. */
+		double SortSeconds = 0.0;
+
+		double ScatterSeconds = 0.0;
+	};
+
+	struct FOctreeSettings
+	{
+		/** Cells holding more points are split into their eight octants. */
+		int32 MaxPointsPerCell = 1000000;
+
+		/** Cells whose points take more GPU memory are split too, 0 disables it. */
+		int64 MaxBytesPerCell = 0;
+
+		/** Depth at which cells are no longer split whatever their size, at most MaxOctreeDepth. */
+		int32 MaxDepth = 8;
+	};
+
+	constexpr int32 MaxOctreeDepth = 10;
+
+	struct FOctreeCell
+	{
+		/** Cube of the octree node, the cells tile the cube around all points without overlapping. */
+		FBox Bounds = FBox(ForceInit);
+
+		int32 Depth = 0;
+
+		/** Octant taken at every level from the root, one octal digit per level in the low bits. */
+		uint32 Path = 0;
+	};
+
+	struct FOctreeCells
+	{
+		TArray<FOctreeCell> Cells;
+
+		/** Points of cell i are Points[CellStarts[i], CellStarts[i + 1]). */
+		TArray<int32> CellStarts;
+
+		TArray<FGaussianSplattingPoint> Points;
+
+		TConstArrayView<FGaussianSplattingPoint> GetCellPoints(int32 CellIndex) const
+		{
+			return TConstArrayView<FGaussianSplattingPoint>(Points.GetData() + CellStarts[CellIndex], CellStarts[CellIndex + 1] - CellStarts[CellIndex]);
+		}
+	};
+
+	enum class EOverlapMode : uint8
+	{
+		/** Every point of every source is kept. */
+		Keep,
+
+		/** Within every cell of the spatial hash, only the points of the source whose center is the nearest to the cell are kept. */
+		Ownership,
+
+		/** A point is dropped when a similar point of another source, nearer to its center, lies within a hash cell of it. */
+		Similarity,
+	};
+
+	struct FOverlapSettings
+	{
+		EOverlapMode Mode = EOverlapMode::Ownership;
+
+		/** Size of the spatial hash cells, and the largest distance between two similar points. */
+		double CellSize = 20.0;
+
+		/** Largest difference of the color and opacity channels between two similar points. */
+		float MaxColorDistance = 0.1f;
+
+		/** Largest ratio between the sizes of two similar points. */
+		float MaxScaleRatio = 1.5f;
+	};
+
+	struct FOverlapStats
+	{
+		/** Points within the bounds of another source, the only ones the hash is built over. */
+		int32 NumCandidates = 0;
+
+		int32 NumRemoved = 0;
+
+		double Seconds = 0.0;
+	};
+
+	/** Video memory the data interface needs for the points of a cell. */
+	GAUSSIANSPLATTINGRUNTIME_API int64 GetPointBytes(int32 NumPoints);
+
+	/** Center of a cell at Z 0, cell (0, 0) starts at Origin. */
+	GAUSSIANSPLATTINGRUNTIME_API FVector GetCellCenter(const FVector2D& Origin, double CellSize, FIntPoint Cell);
+
+	/**
+	 * Removes the points duplicated where sources overlap, such as HLOD clusters captured with padding around them. Only the
+	 * points within the bounds of another source are hashed into cells of Settings.CellSize, sorted in parallel, and resolved
+	 * per cell by the mode of Settings, the offset of every source being its center. OutSources views the sources that lost
+	 * points in OutPoints, at the same index, and the other ones as they were.
+	 */
+	GAUSSIANSPLATTINGRUNTIME_API void RemoveOverlaps(TConstArrayView<FSource> Sources, const FOverlapSettings& Settings, TArray<TArray<FGaussianSplattingPoint>>& OutPoints, TArray<FSource>& OutSources, FOverlapStats* OutStats = nullptr);
+
+	/**
+	 * Bins the points of all sources, placed at their offsets, into cells of CellSize starting at Origin. Every point lands in
+	 * exactly one cell and is moved into its space, relative to the cell center. Positions are placed in double precision.
+	 */
+	GAUSSIANSPLATTINGRUNTIME_API void BinPoints(TConstArrayView<FSource> Sources, const FVector2D& Origin, double CellSize, FCells& OutCells, FStats* OutStats = nullptr);
+
+	/**
+	 * Bins the points of all sources into the leaves of an octree over their bounds, splitting every cell in 3D until it fits
+	 * the budgets of Settings, so dense areas get many small cells and sparse ones a few large cells. Points are sorted
+	 * along a Morton curve in parallel, every node is then a contiguous range of the order. Points are moved into the space
+	 * of their cell, relative to the center of its bounds.
+	 */
+	GAUSSIANSPLATTINGRUNTIME_API void BinPointsOctree(TConstArrayView<FSource> Sources, const FOctreeSettings& Settings, FOctreeCells& OutCells, FStats* OutStats = nullptr);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "NiagaraCommon.h"
+#include "GaussianSplattingBudgetSubsystem.generated.h"
+
+class UNiagaraDataInterfaceGaussianSplattingPointCloud;
+
+struct GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingBudgetRequest
+{
+	/** Number of points the component could draw at full detail. */
+	int32 PointCount = 0;
+
+	/** Fraction of the screen covered by the component bounds, in [0, 1]. Zero means the component gets only the minimum share. */
+	float ScreenCoverage = 0.0f;
+};
+
+namespace GaussianSplattingBudget
+{
+	/**
+	 * Splits TotalBudget points across the requests proportionally to their screen coverage.
+	 * Each request receives at least min(MinPointsPerRequest, TotalBudget / Num) points and never more than its PointCount,
+	 * budget freed by saturated requests is redistributed over the remaining ones.
+	 * The result only depends on the order and content of Requests, so the same input always yields the same counts.
+	 */
+	GAUSSIANSPLATTINGRUNTIME_API void Allocate(TConstArrayView<FGaussianSplattingBudgetRequest> Requests, int64 TotalBudget, int32 MinPointsPerRequest, TArray<int32>& OutPointCounts);
+}
+
+UCLASS()
+class GAUSSIANSPLATTINGRUNTIME_API UGaussianSplattingBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+public:
+	void Register(UNiagaraDataInterfaceGaussianSplattingPointCloud* DataInterface, USceneComponent* Component, FNiagaraSystemInstanceID InstanceID);
+
+	void Unregister(FNiagaraSystemInstanceID InstanceID);
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Culls the chunks of every point cloud against the local player views and hands the visible ranges to the data interfaces. */
+	void UpdateVisibleRanges();
+
+	struct FEntry
+	{
+		FNiagaraSystemInstanceID InstanceID;
+		TWeakObjectPtr<UNiagaraDataInterfaceGaussianSplattingPointCloud> DataInterface;
+		TWeakObjectPtr<USceneComponent> Component;
+	};
+
+	TArray<FEntry> Entries;
+};
@@ -0,0 +1,239 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GaussianSplattingCustomVersion.h"
+
+struct FGaussianSplattingPoint;
+struct FConvexVolume;
+
+/** A run of spatially coherent points, all taken from the same LOD segment. */
+struct GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingChunk
+{
+	/** Bounds of the point positions grown by three standard deviations of each splat, swept over the playback for 4D clouds. */
+	FBox3f Bounds = FBox3f(ForceInit);
+
+	/** First entry of the chunk in the hierarchy point index table. */
+	int32 FirstIndex = 0;
+
+	int32 NumPoints = 0;
+
+	int32 Segment = 0;
+
+	/** Playback times outside [ActiveBegin, ActiveEnd] leave every point of the chunk invisible. */
+	float ActiveBegin = -UE_MAX_FLT;
+	float ActiveEnd = UE_MAX_FLT;
+
+	friend FArchive& operator<<(FArchive& Ar, FGaussianSplattingChunk& Chunk)
+	{
+		Ar << Chunk.Bounds;
+		Ar << Chunk.FirstIndex;
+		Ar << Chunk.NumPoints;
+		Ar << Chunk.Segment;
+		if (Ar.CustomVer(FGaussianSplattingCustomVersion::GUID) >= FGaussianSplattingCustomVersion::ChunkTemporalIndex) {
+			Ar << Chunk.ActiveBegin;
+			Ar << Chunk.ActiveEnd;
+		}
+		return Ar;
+	}
+};
+
+struct GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingChunkNode
+{
+	FBox3f Bounds = FBox3f(ForceInit);
+
+	/** Chunks covered by the node, leaves cover a single chunk. */
+	int32 ChunkBegin = 0;
+	int32 ChunkEnd = 0;
+
+	int32 Children[2] = { INDEX_NONE, INDEX_NONE };
+
+	bool IsLeaf() const { return Children[0] == INDEX_NONE; }
+
+	friend FArchive& operator<<(FArchive& Ar, FGaussianSplattingChunkNode& Node)
+	{
+		Ar << Node.Bounds;
+		Ar << Node.ChunkBegin;
+		Ar << Node.ChunkEnd;
+		Ar << Node.Children[0];
+		Ar << Node.Children[1];
+		return Ar;
+	}
+};
+
+enum class EGaussianSplattingChunkTest : uint8
+{
+	Outside,
+	Intersects,
+	Inside,
+};
+
+/**
+ * Groups the points of a cloud into fixed-size chunks and organizes them in one bounding volume hierarchy per LOD segment.
+ * Points keep their coarse-to-fine order in the cloud, chunks reference them through a permutation table sorted along a
+ * Morton curve, so every chunk of a segment is spatially coherent and a resident prefix of segments maps to a prefix of chunks.
+ */
+class GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingChunkHierarchy
+{
+public:
+	static constexpr int32 DefaultChunkSize = 2048;
+
+	static constexpr int32 DefaultNumSortDirections = 26;
+
+	/** Number of time slabs 4D clouds are bucketed into. */
+	static constexpr int32 NumTimeSlabs = 64;
+
+	/** A splat counts as active within this many temporal standard deviations of its center, exp(-3^2) is about 1e-4 opacity. */
+	static constexpr float TemporalCutoff = 3.0f;
+
+	/**
+	 * NumSortDirections back-to-front orders are baked for every chunk, as chunk-local 16-bit indices. Only half of the directions
+	 * are stored since the order for a direction is the reversed order of its opposite, 0 disables the bake.
+	 * Clouds with temporal data are sorted by time slab before the Morton order, so chunks also stay coherent in time.
+	 */
+	void Build(TConstArrayView<FGaussianSplattingPoint> Points, TConstArrayView<int32> SegmentEnds, int32 ChunkSize = DefaultChunkSize, int32 NumSortDirections = DefaultNumSortDirections);
+
+	void Reset();
+
+	bool IsEmpty() const { return Chunks.IsEmpty(); }
+
+	int32 GetNumSegments() const { return SegmentChunkEnds.Num(); }
+
+	int32 GetNumChunks() const { return Chunks.Num(); }
+
+	/** Whether the chunks carry active intervals, which is the case when any point has temporal data. */
+	bool HasTemporalIndex() const { return !SlabChunkOffsets.IsEmpty(); }
+
+	/** Chunks whose active interval overlaps the time slab containing PlaybackTime, in ascending order. */
+	TConstArrayView<int32> GetActiveChunkCandidates(float PlaybackTime) const;
+
+	/**
+	 * Union of the candidates of every time slab overlapped by the ranges of (begin, end) times, in ascending order.
+	 * OutBounds optionally receives the bounds of each candidate swept over the overlapped slabs only.
+	 */
+	void GetActiveChunkCandidates(TConstArrayView<FVector2f> TimeRanges, TArray<int32>& OutChunks, TArray<FBox3f>* OutBounds = nullptr) const;
+
+	/** Number of chunks covering the first NumSegments segments. */
+	int32 GetNumChunksForSegments(int32 NumSegments) const;
+
+	TConstArrayView<FGaussianSplattingChunk> GetChunks() const { return Chunks; }
+
+	TConstArrayView<FGaussianSplattingChunkNode> GetNodes() const { return Nodes; }
+
+	TConstArrayView<uint32> GetPointIndices() const { return PointIndices; }
+
+	TConstArrayView<uint32> GetChunkPointIndices(int32 ChunkIndex) const;
+
+	/** Number of view directions with a baked order, opposite directions included. */
+	int32 GetNumSortDirections() const { return SortDirections.Num() * 2; }
+
+	TConstArrayView<FVector3f> GetSortDirections() const { return SortDirections; }
+
+	/** Baked orders laid out as [StoredDirection][PointIndexTableEntry], entries are offsets inside the chunk. */
+	TConstArrayView<uint16> GetSortedOrders() const { return SortedOrders; }
+
+	/**
+	 * Returns the order code whose baked order best matches a view looking along ViewDirection, which is 0 when no order is baked
+	 * and otherwise (StoredDirection * 2 + bReversed) + 1.
+	 */
+	uint32 FindSortOrder(const FVector3f& ViewDirection) const;
+
+	/** Union of the chunk bounds of the first NumSegments segments. */
+	FBox3f GetBounds(int32 NumSegments) const;
+
+	/** Clip times the swept bounds of 4D clouds cover, from the start of playback to the last splat center. */
+	FVector2f GetSweptTimeRange() const { return SweptTimeRange; }
+
+	/**
+	 * Union of the chunk bounds of the first NumSegments segments restricted to the time slabs overlapped by TimeRanges,
+	 * which is much tighter than GetBounds for moving splats. Clouds without temporal index return GetBounds.
+	 */
+	FBox3f GetBounds(int32 NumSegments, TConstArrayView<FVector2f> TimeRanges) const;
+
+	/**
+	 * Walks the hierarchies of the first NumSegments segments. TestBounds classifies node bounds, Visit receives every chunk
+	 * that is not outside and whether it is known to be fully inside. Chunks are visited in segment order.
+	 */
+	void Traverse(int32 NumSegments, TFunctionRef<EGaussianSplattingChunkTest(const FBox3f&)> TestBounds, TFunctionRef<void(int32 ChunkIndex, bool bFullyInside)> Visit) const;
+
+	/** Collects the chunks of the first NumSegments segments whose bounds intersect Box. */
+	void QueryBox(const FBox3f& Box, int32 NumSegments, TArray<int32>& OutChunks) const;
+
+	/**
+	 * Collects, in chunk order, the chunks of the first NumSegments segments that intersect any of the frustums and lie within
+	 * MaxDistance of ViewOrigin. Frustums and origin are given in the space of the points, MaxDistance <= 0 disables the distance test
+	 * and an empty frustum list disables the frustum test. With time ranges, only the chunks active during any of them are tested.
+	 */
+	void Cull(TConstArrayView<FConvexVolume> Frustums, const FVector3f& ViewOrigin, float MaxDistance, int32 NumSegments, TArray<int32>& OutVisibleChunks, TConstArrayView<FVector2f> ActiveTimeRanges = {}) const;
+
+	/**
+	 * Merges chunks that are adjacent in the point index table into ranges of (first compacted index, first point index entry, count, 0).
+	 * Returns the number of points covered by the ranges.
+	 */
+	int32 BuildVisibleRanges(TConstArrayView<int32> VisibleChunks, TArray<FUintVector4>& OutRanges) const;
+
+	/**
+	 * Orders the visible chunks back to front from ViewOrigin and emits one range per chunk, carrying the baked order that best
+	 * matches the chunk in the fourth component. Falls back to BuildVisibleRanges when no order is baked.
+	 */
+	int32 BuildSortedRanges(TConstArrayView<int32> VisibleChunks, const FVector3f& ViewOrigin, TArray<FUintVector4>& OutRanges) const;
+
+	/** Maps an index into the compacted ranges to the index of the point in the cloud, the CPU mirror of the data interface HLSL. */
+	uint32 MapVisibleIndex(TConstArrayView<FUintVector4> Ranges, uint32 Index) const;
+
+	friend FArchive& operator<<(FArchive& Ar, FGaussianSplattingChunkHierarchy& Hierarchy)
+	{
+		Ar << Hierarchy.Chunks;
+		Ar << Hierarchy.Nodes;
+		Ar << Hierarchy.SegmentChunkEnds;
+		Ar << Hierarchy.SegmentRoots;
+		Ar << Hierarchy.PointIndices;
+		if (Ar.CustomVer(FGaussianSplattingCustomVersion::GUID) >= FGaussianSplattingCustomVersion::ChunkSortedOrders) {
+			Ar << Hierarchy.SortDirections;
+			Ar << Hierarchy.SortedOrders;
+		}
+		if (Ar.CustomVer(FGaussianSplattingCustomVersion::GUID) >= FGaussianSplattingCustomVersion::ChunkTemporalIndex) {
+			Ar << Hierarchy.SlabStart;
+			Ar << Hierarchy.SlabDuration;
+			Ar << Hierarchy.SlabChunkOffsets;
+			Ar << Hierarchy.SlabChunks;
+		}
+		if (Ar.CustomVer(FGaussianSplattingCustomVersion::GUID) >= FGaussianSplattingCustomVersion::SweptChunkBounds) {
+			Ar << Hierarchy.SweptTimeRange;
+			Ar << Hierarchy.SlabChunkBounds;
+		}
+		return Ar;
+	}
+
+private:
+	int32 BuildNodes(int32 ChunkBegin, int32 ChunkEnd);
+
+	int32 GetTimeSlab(float Time) const;
+
+	TArray<FGaussianSplattingChunk> Chunks;
+
+	TArray<FGaussianSplattingChunkNode> Nodes;
+
+	TArray<int32> SegmentChunkEnds;
+
+	TArray<int32> SegmentRoots;
+
+	TArray<uint32> PointIndices;
+
+	TArray<FVector3f> SortDirections;
+
+	TArray<uint16> SortedOrders;
+
+	float SlabStart = 0.0f;
+
+	float SlabDuration = 0.0f;
+
+	/** Chunks overlapping each time slab, slab i owns SlabChunks[SlabChunkOffsets[i], SlabChunkOffsets[i + 1]). */
+	TArray<int32> SlabChunkOffsets;
+
+	TArray<int32> SlabChunks;
+
+	/** Bounds of each SlabChunks entry, swept over that slab only. */
+	TArray<FBox3f> SlabChunkBounds;
+
+	FVector2f SweptTimeRange = FVector2f::ZeroVector;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+
+struct GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingCustomVersion
+{
+	enum Type
+	{
+		BeforeCustomVersionWasAdded = 0,
+
+		// Points are stored as ordered LOD prefix segments in separate bulk data payloads.
+		SegmentedPayload,
+
+		// A chunk hierarchy over the points is saved next to the segments.
+		ChunkHierarchy,
+
+		// Chunks carry presorted back-to-front orders for a set of view directions.
+		ChunkSortedOrders,
+
+		// Chunks of 4D clouds are bucketed into time slabs and carry their active interval.
+		ChunkTemporalIndex,
+
+		// Chunk bounds of 4D clouds are swept over the motion of their points, overall and per time slab.
+		SweptChunkBounds,
+
+		// Coarser levels of merged splats are saved after the chunk hierarchy, each in its own bulk data payload.
+		LODLevels,
+
+		// Editor only contribution scores of the points measured over the capture views.
+		ContributionScores,
+
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	const static FGuid GUID;
+
+private:
+	FGaussianSplattingCustomVersion() {}
+};
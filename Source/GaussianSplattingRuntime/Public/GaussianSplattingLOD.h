@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGaussianSplattingPoint;
+
+/** A coarser version of a whole point cloud, made of merged splats. */
+struct GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingLODLevel
+{
+	/** Largest distance, in the units of the points, between a merged splat and the original splats it replaces. */
+	float Error = 0.0f;
+
+	int32 NumPoints = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FGaussianSplattingLODLevel& Level)
+	{
+		Ar << Level.Error;
+		Ar << Level.NumPoints;
+		return Ar;
+	}
+};
+
+/**
+ * Builds a tree of coarser levels over a static cloud. Splats are bucketed in the cells of an octree aligned on a Morton curve,
+ * every level merges the splats of the next coarser cells by moment matching: the merged Gaussian keeps the mean and covariance
+ * of its children weighted by their coverage, the coverage weighted color and the total coverage.
+ */
+namespace GaussianSplattingLOD
+{
+	struct FSettings
+	{
+		/** Number of coarser levels at most, each built from the one before it. */
+		int32 MaxLevels = 8;
+
+		/** Every level holds at most this many times fewer points than the level it merges. */
+		float ReductionRatio = 8.0f;
+
+		/** No level is built below this many points. */
+		int32 MinPoints = 1024;
+	};
+
+	/** Appends the levels from the finest to the coarsest, the errors grow from one level to the next. */
+	GAUSSIANSPLATTINGRUNTIME_API void BuildLevels(TConstArrayView<FGaussianSplattingPoint> Points, const FSettings& Settings, TArray<TArray<FGaussianSplattingPoint>>& OutLevels, TArray<FGaussianSplattingLODLevel>& OutLevelInfos);
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "GaussianSplattingPlaybackComponent.generated.h"
+
+class UGaussianSplattingSequence;
+class FGaussianSplattingSequenceStreamer;
+struct FGaussianSplattingSequenceFrame;
+
+UENUM(BlueprintType)
+enum class EGaussianSplattingLoopMode : uint8
+{
+	Loop,
+	Once,
+	PingPong,
+};
+
+/**
+ * Drives the playback time of the 4D point clouds on the Niagara components of its owner.
+ * The time is handed to the "PointCloud" data interface explicitly, so playback can be paused, scrubbed, or keyed in Sequencer.
+ * With a Sequence, the data interfaces show its decoded frames instead.
+ */
+UCLASS(ClassGroup = (GaussianSplatting), meta = (BlueprintSpawnableComponent))
+class GAUSSIANSPLATTINGRUNTIME_API UGaussianSplattingPlaybackComponent : public UActorComponent
+{
+	GENERATED_BODY()
+public:
+	UGaussianSplattingPlaybackComponent();
+
+	/** Maps an unbounded time to the clip time, in [0, Duration]. */
+	static float EvaluateTime(float RawTime, float Duration, EGaussianSplattingLoopMode LoopMode);
+
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	void Play();
+
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	void Pause();
+
+	/** Jumps to RawTime, which is wrapped by the loop mode. */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	void SetTime(float RawTime);
+
+	/** The clip time handed to the point clouds. */
+	UFUNCTION(BlueprintPure, Category = "Gaussian Splatting")
+	float GetPlaybackTime() const;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	virtual void OnUnregister() override;
+
+	/** Ignored while a Sequence is set, which has its own duration. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting", meta = (ClampMin = 0))
+	float Duration = 5.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting")
+	float PlayRate = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting")
+	EGaussianSplattingLoopMode LoopMode = EGaussianSplattingLoopMode::Loop;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting")
+	bool bPlaying = true;
+
+	/** Unwrapped playback position, keyable in Sequencer. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Interp, Category = "Gaussian Splatting")
+	float Time = 0.0f;
+
+	/** Chunks that become active within this many seconds of playback are exposed ahead of time. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting", meta = (ClampMin = 0))
+	float PrefetchTime = 0.25f;
+
+	/** Fits the fixed bounds of the Niagara components to the splats active around the playback time, instead of the whole clip. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting")
+	bool bFitBoundsToPlayback = true;
+
+	/** Volumetric video shown by the "PointCloud" data interfaces instead of their point cloud. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting")
+	TObjectPtr<UGaussianSplattingSequence> Sequence;
+
+	/**
+	 * Frames of the Sequence decoded and uploaded ahead of the playback position, each one holds a whole frame in memory.
+	 * The upload ring of the data interface has room for three next to the displayed frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting", meta = (ClampMin = 1, ClampMax = 3))
+	int32 DecodeAheadFrames = 3;
+
+private:
+	float GetDuration() const;
+
+	void PushPlaybackTime();
+
+	void PushSequenceFrames(TConstArrayView<class UNiagaraComponent*> NiagaraComponents);
+
+	void ReleaseSequence();
+
+	/** Sets the fixed bounds of the system only when they differ from the last ones set, which resets its bounds state. */
+	void SetFixedBounds(class UNiagaraComponent* NiagaraComponent, const FBox& Bounds);
+
+	TSharedPtr<FGaussianSplattingSequenceStreamer> SequenceStreamer;
+
+	/** Last fixed bounds set on each Niagara component of the owner. */
+	TMap<TWeakObjectPtr<class UNiagaraComponent>, FBox> FixedBounds;
+
+	/** Kept on screen until the frame at the playback position is decoded. */
+	TSharedPtr<const FGaussianSplattingSequenceFrame> DisplayedFrame;
+};
@@ -2,8 +2,12 @@
 
 #include "UObject/NoExportTypes.h"
 #include "NiagaraDataInterfaceCurve.h"
+#include "Serialization/BulkData.h"
+#include "GaussianSplattingChunkHierarchy.h"
+#include "GaussianSplattingLOD.h"
 #include "GaussianSplattingPointCloud.generated.h"
 
+struct FAssetData;
 
 UENUM() 
 enum class EGaussianSplattingCompressionMethod : uint8
@@ -42,6 +46,20 @@ public:
 		FVector4f InTime = FVector4f(0.f, 0.f, 0.f, 0.f),
 		FVector4f InMotion = FVector4f(0.f, 0.f, 0.f, 0.f));
 
+	/** Center of the splat at InTime, moved along the velocity and acceleration stored in Time and Motion like the data interface HLSL does. */
+	FVector3f GetPositionAt(float InTime) const;
+
+	/** Bounds swept by the splat, grown by three standard deviations, while the time runs over [TimeBegin, TimeEnd]. */
+	FBox3f GetSweptBounds(float TimeBegin, float TimeEnd) const;
+
+	/** Number of float4 the data interface stores per point. */
+	static constexpr int32 NumPackedVectors = 6;
+
+	/** Writes the point in the layout of the data interface point buffer: position, rotation, scale, color, time and motion. */
+	void Pack(FVector4f* OutVectors) const;
+
+	static FGaussianSplattingPoint Unpack(const FVector4f* InVectors);
+
 	bool operator==(const FGaussianSplattingPoint& Other)const;
 	bool operator!=(const FGaussianSplattingPoint& Other)const;
 	bool operator<(const FGaussianSplattingPoint& Other)const;
@@ -73,6 +91,47 @@ public:
 	}
 };
 
+/** How much a splat shows in the capture images, measured by blending it into the views of the capture cameras. */
+struct FGaussianSplattingContributionScore
+{
+	/** Largest alpha times transmittance the splat reached in any pixel. */
+	float MaxWeight = 0.0f;
+
+	/** Alpha times transmittance summed over the pixels of all views, in pixels of the captured resolution. */
+	float SumWeight = 0.0f;
+
+	friend FArchive& operator<<(FArchive& Ar, FGaussianSplattingContributionScore& Score)
+	{
+		Ar << Score.MaxWeight;
+		Ar << Score.SumWeight;
+		return Ar;
+	}
+};
+
+/** File a cloud was imported from, compared on reimport to skip the clouds whose file and settings did not change. */
+USTRUCT()
+struct FGaussianSplattingSourceInfo
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(VisibleAnywhere, Category = "Gaussian Splatting")
+	FString FilePath;
+
+	UPROPERTY(VisibleAnywhere, Category = "Gaussian Splatting")
+	int64 FileSize = 0;
+
+	UPROPERTY(VisibleAnywhere, Category = "Gaussian Splatting")
+	FDateTime Timestamp;
+
+	/** xxHash64 of the file contents. */
+	UPROPERTY(VisibleAnywhere, Category = "Gaussian Splatting")
+	uint64 ContentHash = 0;
+
+	/** xxHash64 of the settings the file was imported with. */
+	UPROPERTY(VisibleAnywhere, Category = "Gaussian Splatting")
+	uint64 SettingsHash = 0;
+};
+
 UCLASS(Blueprintable, BlueprintType, EditInlineNew, CollapseCategories)
 class GAUSSIANSPLATTINGRUNTIME_API UGaussianSplattingPointCloud : public UObject {
 	GENERATED_UCLASS_BODY()
@@ -81,32 +140,217 @@ public:
 
 	FRichCurve CalcFeatureCurve();
 
+	/** Bounds of every point over the whole playback of 4D clouds, suitable as fixed Niagara bounds. */
 	FBox CalcBounds();
 
 	void SetPoints(const TArray<FGaussianSplattingPoint>& InPoints, bool bReorder = true);
 
+	/** Points from the largest to the smallest, the order SetPoints puts them in, sorted with the parallel radix sort. */
+	static TArray<FGaussianSplattingPoint> SortPointsBySize(TConstArrayView<FGaussianSplattingPoint> InPoints);
+
 	const TArray<FGaussianSplattingPoint>& GetPoints() const;
 
+	/** Number of resident points, which is a prefix of the full cloud while segments are streamed out. */
 	int32 GetPointCount() const;
 
+	int32 GetTotalPointCount() const;
+
+	int32 GetNumSegments() const { return SegmentEnds.Num(); }
+
+	int32 GetSegmentEnd(int32 SegmentIndex) const { return SegmentEnds[SegmentIndex]; }
+
+	int32 GetResidentSegmentCount() const { return ResidentSegmentCount; }
+
+	/** Returns the smallest number of segments whose prefix holds at least InPointCount points. */
+	int32 GetSegmentCountForPoints(int32 InPointCount) const;
+
+	/**
+	 * Streams segments in asynchronously, or releases trailing segments, until NumSegments are resident.
+	 * Segments are only released when they can be decoded again, from the package or their encoded payloads in memory.
+	 */
+	void RequestResidentSegments(int32 NumSegments);
+
+	/** Synchronously loads every segment that is not resident yet. */
+	void LoadAllSegments();
+
+	/**
+	 * Releases every segment past the first NumSegments, in the editor too, once the points were copied out of the cloud or saved.
+	 * Segments are only released when they can be decoded again, LoadAllSegments brings them back.
+	 */
+	void ReleaseSegments(int32 NumSegments = 1);
+
+	/** Number of levels of detail, LOD 0 is the cloud itself and every following LOD is a coarser cloud of merged splats. */
+	int32 GetNumLODs() const { return LODLevels.Num() + 1; }
+
+	/** Distance in the units of the points between the splats of an LOD and the original ones they replace, 0 for LOD 0. */
+	float GetLODError(int32 LOD) const { return LOD > 0 ? LODLevels[LOD - 1].Error : 0.0f; }
+
+	int32 GetLODPointCount(int32 LOD) const { return LOD > 0 ? LODLevels[LOD - 1].NumPoints : GetTotalPointCount(); }
+
+	/** Coarsest LOD whose error stays below MaxScreenError times the distance to the cloud, both in the units of the points. */
+	int32 SelectLOD(float Distance, float MaxScreenError) const;
+
+	/** Points of a coarser LOD, null for LOD 0 and while the LOD is not resident. */
+	TSharedPtr<const TArray<FGaussianSplattingPoint>> GetLODPoints(int32 LOD) const;
+
+	/**
+	 * Streams the points of an LOD in asynchronously and releases the other ones, except the coarsest which is always resident.
+	 * Levels are only released when they can be reloaded from the package.
+	 */
+	void RequestLOD(int32 LOD);
+
+	/** Rebuilds the coarser levels from the whole cloud, or removes them when MaxLODLevels is 0. */
+	void BuildLODLevels();
+
+#if WITH_EDITORONLY_DATA
+	/** Scores of the whole cloud in the order of its points, empty until the cloud is scored against its capture. SetPoints clears them. */
+	const TArray<FGaussianSplattingContributionScore>& GetContributionScores() const { return ContributionScores; }
+
+	/** Stores one score per point of the whole cloud and rebuilds the levels of detail, which leave out the splats no view shows. */
+	void SetContributionScores(TArray<FGaussianSplattingContributionScore> InScores);
+
+	const FGaussianSplattingSourceInfo& GetSourceInfo() const { return SourceInfo; }
+
+	void SetSourceInfo(const FGaussianSplattingSourceInfo& InSourceInfo) { SourceInfo = InSourceInfo; }
+
+	/** Reads the source info a saved cloud exposes as asset registry tags, false when the asset was saved without them. */
+	static bool GetSourceInfoFromAssetData(const FAssetData& AssetData, FGaussianSplattingSourceInfo& OutSourceInfo);
+#endif
+
+	/** Spatial chunks of all segments, only the chunks of resident segments may be used to access points. */
+	const FGaussianSplattingChunkHierarchy& GetChunkHierarchy() const { return ChunkHierarchy; }
+
 	void LoadFromFile(FString InFilePath);
 
 	static TArray<FGaussianSplattingPoint> LoadPointsFromFile(FString InFilePath);
 
+	/** Parses a PLY file already read into memory, so reading and parsing can run as separate stages of an import. */
+	static TArray<FGaussianSplattingPoint> LoadPointsFromMemory(TConstArrayView<uint8> Data);
+
+	/**
+	 * Compresses the payloads of every segment and level ahead of saving, which then only writes them. Freshly built clouds may
+	 * be encoded on a worker thread while nothing else uses them. The payloads are kept until the points or settings change.
+	 */
+	void EncodePayloads();
+
 	EGaussianSplattingCompressionMethod GetCompressionMethod() const { return CompressionMethod; }
 
-	void SetCompressionMethod(EGaussianSplattingCompressionMethod val) { CompressionMethod = val; }
+	void SetCompressionMethod(EGaussianSplattingCompressionMethod val)
+	{
+		bPayloadsEncoded = bPayloadsEncoded && CompressionMethod == val;
+		CompressionMethod = val;
+	}
+
+	/** Takes over the compression, segment, sorting, LOD and feature settings of Other. The points are left as they are. */
+	void CopySettings(const UGaussianSplattingPointCloud& Other);
 
 private:
 	void Serialize(FArchive& Ar) override;
 
+	void BeginDestroy() override;
+
+	void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+
+#if WITH_EDITOR
+	void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	void UpdateSegments();
+
+	void BuildChunkHierarchy();
+
+	void EncodeSegment(int32 SegmentIndex, TArray<uint8>& OutPayload) const;
+
+	static bool DecodeSegment(const uint8* Payload, int64 PayloadSize, TArray<FGaussianSplattingPoint>& OutPoints);
+
+	void LoadSegments(int32 NumSegments);
+
+	void AppendSegment(int32 SegmentIndex, TArray<FGaussianSplattingPoint>&& SegmentPoints);
+
+	void StreamNextSegment();
+
+	/** Drops the resident segments past RequestedSegmentCount when they can all be decoded again. */
+	void EvictSegments();
+
+	static void EncodePoints(const TArray<FGaussianSplattingPoint>& InPoints, EGaussianSplattingCompressionMethod Method, TArray<uint8>& OutPayload);
+
+	void LoadAllLODs();
+
+	/** Synchronously loads the points of LOD LevelIndex + 1 unless they are resident. */
+	void LoadLOD(int32 LevelIndex);
+
+	void StreamRequestedLOD();
+
+	/** Copies the resident points, levels and streaming state for undo, redo and duplication, which keep the payloads as they are. */
+	void SerializeResidentPoints(FArchive& Ar);
+
 private:
 	UPROPERTY(EditAnywhere, Category = "Gaussian Splatting")
 	EGaussianSplattingCompressionMethod CompressionMethod = EGaussianSplattingCompressionMethod::Zlib;
 
+	/** Cumulative fractions of the coarse-to-fine ordered points stored in each streamable segment, the last one must be 1. */
+	UPROPERTY(EditAnywhere, Category = "Gaussian Splatting")
+	TArray<float> SegmentFractions = { 0.05f, 0.2f, 1.0f };
+
+	/** Number of view directions, opposite ones included, for which every chunk bakes a back-to-front order. 0 disables the bake. */
+	UPROPERTY(EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 0, ClampMax = 128))
+	int32 NumSortDirections = FGaussianSplattingChunkHierarchy::DefaultNumSortDirections;
+
+	TArray<int32> SegmentEnds;
+
+	TIndirectArray<FByteBulkData> SegmentPayloads;
+
+	FGaussianSplattingChunkHierarchy ChunkHierarchy;
+
+	int32 ResidentSegmentCount = 0;
+
+	int32 RequestedSegmentCount = 0;
+
+	class IBulkDataIORequest* PendingRequest = nullptr;
+
+	/** Identifies PendingRequest in its completion, the address of a dropped request may be reused by the next one. */
+	uint32 PendingRequestSerial = 0;
+
+	/**
+	 * Coarser levels merged from the whole cloud, built on import for static clouds, see GaussianSplattingLOD::BuildLevels.
+	 * Distant clouds switch to them instead of drawing thousands of tiny splats. 0 disables them.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 0, ClampMax = 16))
+	int32 MaxLODLevels = 0;
+
+	/** Every level holds at most this many times fewer points than the finer one. */
+	UPROPERTY(EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 2))
+	float LODReductionRatio = 8.0f;
+
+	TArray<FGaussianSplattingLODLevel> LODLevels;
+
+	TIndirectArray<FByteBulkData> LODPayloads;
+
+	/** Resident points of LOD i + 1, shared with the data interfaces displaying them. */
+	TArray<TSharedPtr<const TArray<FGaussianSplattingPoint>>> LODPoints;
+
+	int32 RequestedLOD = 0;
+
+	/** Levels whose payload failed to decode, skipped instead of requested again until the levels are rebuilt or reloaded. */
+	TSet<int32> FailedLODLevels;
+
+	class IBulkDataIORequest* PendingLODRequest = nullptr;
+
+	uint32 PendingLODRequestSerial = 0;
+
+	/** Whether the payloads match the points and settings since EncodePayloads, so saving can skip compressing them. */
+	bool bPayloadsEncoded = false;
+
 	UPROPERTY(Transient)
 	TArray<FGaussianSplattingPoint> Points;
 
+#if WITH_EDITORONLY_DATA
+	TArray<FGaussianSplattingContributionScore> ContributionScores;
+
+	UPROPERTY(VisibleAnywhere, Category = "Gaussian Splatting")
+	FGaussianSplattingSourceInfo SourceInfo;
+#endif
+
 	UPROPERTY(EditAnywhere, Category = "Gaussian Splatting")
 	uint32 FeatureLevel = 64;
 };
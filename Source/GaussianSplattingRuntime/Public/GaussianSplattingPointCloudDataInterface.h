@@ -3,25 +3,69 @@
 #include "NiagaraDataInterfaceArray.h"
 #include "Misc/EngineVersionComparison.h"
 #include "GaussianSplattingPointCloud.h"
+#include "GaussianSplattingSorter.h"
+#include "Tasks/Task.h"
+#include <atomic>
 #include "GaussianSplattingPointCloudDataInterface.generated.h"
 
+struct FGaussianSplattingSequenceFrame;
+
+struct FNDIGaussianSplattingPointCloudInstanceData
+{
+	FNiagaraSystemInstanceID InstanceID;
+	TWeakObjectPtr<class UGaussianSplattingBudgetSubsystem> BudgetSubsystem;
+};
+
 struct FNiagaraDataInterfaceProxyGaussianSplattingPointCloud : public FNiagaraDataInterfaceProxy
 {
 	FNiagaraDataInterfaceProxyGaussianSplattingPointCloud(class UNiagaraDataInterfaceGaussianSplattingPointCloud* InOwner);
 
 	virtual ~FNiagaraDataInterfaceProxyGaussianSplattingPointCloud();
 
-	void MakeBufferDirty();
-	void TryUpdateBuffer();
-	void PostDataToGPU();
+	/** Replaces the point, point index and sorted order buffers with a snapshot taken on the game thread. Render thread only. */
+	void UpdatePointBuffers(FRHICommandListImmediate& RHICmdList, const TArray<FVector4f>& PointData, const TArray<uint32>& PointIndices, const TArray<uint16>& SortedOrders);
+
+	/**
+	 * Makes DisplayedFrame the one the shaders read, uploading it unless a slot already holds it, then uploads as many of
+	 * UpcomingFrames as there are slots left. Render thread only.
+	 */
+	void UploadSequenceFrames(FRHICommandListImmediate& RHICmdList, const TSharedPtr<const FGaussianSplattingSequenceFrame>& DisplayedFrame, TConstArrayView<TSharedPtr<const FGaussianSplattingSequenceFrame>> UpcomingFrames);
+	void ReleaseSequenceFrames();
 
 	virtual int32 PerInstanceDataPassedToRenderThreadSize() const override{ return 0; }
 
+	/** Number of the PointCount points exposed once the sequence, LOD, visible ranges and budget are applied. */
+	int32 GetBudgetedPointCount(int32 PointCount) const;
+
 	TObjectPtr<class UNiagaraDataInterfaceGaussianSplattingPointCloud> Owner = nullptr;
-	TObjectPtr<class UGaussianSplattingPointCloud> PointCloud;
-	bool bDirty = false;
+	std::atomic<int32> PointBudget = INDEX_NONE;
+
+	/** Points in GaussianPointDataBuffer, set when they are uploaded so the render thread never reads the cloud. */
+	std::atomic<int32> UploadedPointCount = 0;
+	std::atomic<int32> VisiblePointCount = INDEX_NONE;
+	uint32 NumVisibleRanges = 0;
 	FReadBuffer GaussianPointDataBuffer;
-	FCriticalSection BufferLock;
+	FReadBuffer PointIndexBuffer;
+	FReadBuffer SortedOrderBuffer;
+	uint32 SortedOrderStride = 0;
+	FReadBuffer VisibleRangeBuffer;
+
+	/** Ring of point buffers for sequence frames, upcoming frames are uploaded ahead so showing them only switches the bound buffer. */
+	struct FSequenceUploadSlot
+	{
+		FReadBuffer Buffer;
+		TWeakPtr<const FGaussianSplattingSequenceFrame> Frame;
+		int32 NumPoints = 0;
+	};
+	static constexpr int32 NumSequenceUploadSlots = 4;
+	FSequenceUploadSlot SequenceUploadSlots[NumSequenceUploadSlots];
+	int32 DisplayedSequenceSlot = INDEX_NONE;
+	std::atomic<int32> SequencePointCount = INDEX_NONE;
+
+	/** Points of the coarser LOD shown instead of the cloud, small enough to be uploaded whole and drawn without culling. */
+	FReadBuffer LODPointDataBuffer;
+	int32 LODBufferPointCount = 0;
+	std::atomic<int32> LODPointCount = INDEX_NONE;
 };
 
 UCLASS(EditInlineNew, Category = "Array", meta = (DisplayName = "Gaussian Splatting Point Cloud", Experimental), Blueprintable, BlueprintType)
@@ -32,6 +76,14 @@ class GAUSSIANSPLATTINGRUNTIME_API UNiagaraDataInterfaceGaussianSplattingPointCl
 	BEGIN_SHADER_PARAMETER_STRUCT(FShaderParameters, )
 		SHADER_PARAMETER(int,	PointCount)
 		SHADER_PARAMETER_SRV(Buffer<float4>, PointDataBuffer)
+		SHADER_PARAMETER(uint, NumVisibleRanges)
+		SHADER_PARAMETER_SRV(Buffer<uint>, PointIndexBuffer)
+		SHADER_PARAMETER_SRV(Buffer<uint4>, VisibleRangeBuffer)
+		SHADER_PARAMETER(uint, SortedOrderStride)
+		SHADER_PARAMETER_SRV(Buffer<uint>, SortedOrderBuffer)
+		SHADER_PARAMETER(float, PlaybackTime)
+		SHADER_PARAMETER(int, HasPlaybackTime)
+		SHADER_PARAMETER(float, ClipDuration)
 	END_SHADER_PARAMETER_STRUCT()
 public:
 	void SetPointCloud(UGaussianSplattingPointCloud* InPointCloud);
@@ -39,6 +91,64 @@ public:
 	void GetPointCount(FVectorVMExternalFunctionContext& Context);
 	void GetPointData(FVectorVMExternalFunctionContext& Context);
 
+	/** Limits the number of points exposed to the simulation, INDEX_NONE exposes all of them. */
+	void SetPointBudget(int32 InPointBudget);
+	int32 GetBudgetedPointCount() const;
+	int32 GetPointBudget() const;
+
+	/**
+	 * Restricts the exposed points to the visible ranges built by FGaussianSplattingChunkHierarchy::BuildVisibleRanges,
+	 * point indices seen by the simulation then run over the compacted ranges. An empty array exposes every resident point.
+	 */
+	void SetVisibleRanges(TArray<FUintVector4>&& InVisibleRanges, int32 InVisiblePointCount);
+
+	/** Maps an index seen by the simulation to the index of the point in the cloud, or in the points of the displayed LOD. */
+	int32 GetVisiblePointIndex(int32 Index) const;
+
+	/**
+	 * Sorts the exposed points back to front from LocalViewOrigin for the CPU simulation when bSortPointsOnCPU is set,
+	 * the visible ranges or, without them, the whole cloud or displayed LOD. Sequence frames are not sorted.
+	 * repairing the previous frame order when possible. The sort runs on a worker task and its order is used once it is
+	 * done, calls made while it runs are skipped. A null origin drops the order.
+	 */
+	void UpdateCPUSortOrder(const FVector3f* LocalViewOrigin);
+
+	/** Time fed to the temporal visibility term by the last system tick, unset until the system ticked. */
+	TOptional<float> GetPlaybackTime() const;
+
+	/**
+	 * Drives the clip time explicitly instead of wrapping the system age, see UGaussianSplattingPlaybackComponent.
+	 * ActiveTimeRanges are the clip times whose chunks should be exposed, covering the upcoming playback so they are ready ahead of time.
+	 */
+	void SetPlaybackTime(float InPlaybackTime, TConstArrayView<FVector2f> ActiveTimeRanges);
+
+	/** Returns to wrapping the system age over ClipDuration. */
+	void ClearPlaybackTime();
+
+	/** Clip times the temporal culling keeps chunks for, empty until the system ticked. */
+	void GetActiveTimeRanges(TArray<FVector2f>& OutRanges) const;
+
+	/**
+	 * Shows a decoded sequence frame instead of the point cloud, see UGaussianSplattingPlaybackComponent::Sequence.
+	 * UpcomingFrames are uploaded ahead while the ring of upload buffers has room.
+	 */
+	void SetSequenceFrames(TSharedPtr<const FGaussianSplattingSequenceFrame> DisplayedFrame, TConstArrayView<TSharedPtr<const FGaussianSplattingSequenceFrame>> UpcomingFrames);
+
+	/** Returns to showing the point cloud and releases the sequence buffers. */
+	void ClearSequenceFrames();
+
+	/** The sequence frame shown instead of the point cloud, if any. */
+	TSharedPtr<const FGaussianSplattingSequenceFrame> GetSequenceFrame() const;
+
+	/**
+	 * Shows a coarser LOD of the point cloud, see UGaussianSplattingPointCloud::GetNumLODs. The current LOD stays displayed
+	 * until the points of the new one are resident. LOD 0 returns to the full cloud.
+	 */
+	void SetLOD(int32 LOD);
+
+	/** The displayed LOD, whose points are uploaded. */
+	int32 GetLOD() const { return DisplayedLOD; }
+
 protected:
 	friend struct FNiagaraDataInterfaceProxyGaussianSplattingPointCloud;
 
@@ -47,14 +157,61 @@ protected:
 
 	static const FString PointCountName;
 	static const FString PointDataBufferName;
+	static const FString NumVisibleRangesName;
+	static const FString PointIndexBufferName;
+	static const FString VisibleRangeBufferName;
+	static const FString SortedOrderStrideName;
+	static const FString SortedOrderBufferName;
+	static const FString PlaybackTimeName;
+	static const FString HasPlaybackTimeName;
+	static const FString ClipDurationName;
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting")
 	TObjectPtr<UGaussianSplattingPointCloud> PointCloud;
 
+	/** Sorts the points by view depth every frame for CPU simulations, which have no other sorting path. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting")
+	bool bSortPointsOnCPU = false;
+
+	/** Without a playback component, 4D clouds loop over this duration of system age, in seconds. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 0.01))
+	float ClipDuration = 5.0f;
+
+	/**
+	 * Follows the points of PointCloud, a snapshot of them is uploaded now and again whenever they change. Streaming
+	 * appends and evicts segments on the game thread, so the render thread never reads the cloud itself.
+	 */
+	void BindPointCloud();
+	void UploadPoints();
+
+	/** GetVisiblePointIndex for callers already holding VisibleRangesLock. */
+	int32 GetVisiblePointIndexLocked(int32 Index) const;
+
+	TWeakObjectPtr<UGaussianSplattingPointCloud> BoundPointCloud;
+	FDelegateHandle PointsChangedHandle;
+	TArray<FUintVector4> VisibleRanges;
+	TArray<uint32> CPUSortedOrder;
+	TSharedPtr<const FGaussianSplattingSequenceFrame> SequenceFrame;
+	TSharedPtr<const TArray<FGaussianSplattingPoint>> LODPoints;
+	int32 DisplayedLOD = 0;
+	mutable FRWLock VisibleRangesLock;
+	FGaussianSplattingDepthSorter CPUSorter;
+	UE::Tasks::FTask SortTask;
+	std::atomic<float> PlaybackTime = TNumericLimits<float>::Lowest();
+	std::atomic<float> ExplicitPlaybackTime = TNumericLimits<float>::Lowest();
+	TArray<FVector2f> ExplicitTimeRanges;
+	mutable FCriticalSection TimeRangesLock;
+
 	virtual void GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction& OutFunc) override;
 
 	virtual bool CanExecuteOnTarget(ENiagaraSimTarget Target) const override{ return true; }
 
+	virtual int32 PerInstanceDataSize() const override { return sizeof(FNDIGaussianSplattingPointCloudInstanceData); }
+	virtual bool InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
+	virtual void DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
+	virtual bool HasPreSimulateTick() const override { return true; }
+	virtual bool PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds) override;
+
 #if WITH_EDITORONLY_DATA
 	virtual bool AppendCompileHash(FNiagaraCompileHashVisitor* InVisitor) const override;
 	virtual bool GetFunctionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, const FNiagaraDataInterfaceGeneratedFunction& FunctionInfo, int FunctionInstanceIndex, FString& OutHLSL) override;
@@ -71,6 +228,7 @@ protected:
 
 	virtual void PostInitProperties() override;
 	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
 
 protected:
 #if WITH_EDITORONLY_DATA
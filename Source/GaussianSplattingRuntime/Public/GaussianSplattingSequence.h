@@ -0,0 +1,198 @@
+#pragma once
+
+#include "UObject/Object.h"
+#include "Serialization/BulkData.h"
+#include "GaussianSplattingPointCloud.h"
+#include "GaussianSplattingSequence.generated.h"
+
+/** A decoded frame of a sequence, ready to be uploaded by the data interface. */
+struct GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingSequenceFrame
+{
+	int32 FrameIndex = INDEX_NONE;
+
+	int32 NumPoints = 0;
+
+	/** FGaussianSplattingPoint::NumPackedVectors vectors per point, in the layout of FGaussianSplattingPoint::Pack. */
+	TArray<FVector4f> PointData;
+};
+
+/** Per-frame index of a sequence, kept with the asset while the payloads are streamed. */
+struct GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingSequenceFrameInfo
+{
+	bool bKeyframe = false;
+
+	int32 NumPoints = 0;
+
+	/** Bounds of the decoded frame, grown by three standard deviations of each splat. */
+	FBox3f Bounds = FBox3f(ForceInit);
+
+	friend FArchive& operator<<(FArchive& Ar, FGaussianSplattingSequenceFrameInfo& Info)
+	{
+		Ar << Info.bKeyframe;
+		Ar << Info.NumPoints;
+		Ar << Info.Bounds;
+		return Ar;
+	}
+};
+
+/**
+ * Reconstructs the frames of a sequence one after the other, a delta frame applies on top of the frame before it.
+ * The encoder runs the same decoder over its own output, so both sides stay bit identical and deltas never drift.
+ */
+class GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingSequenceDecoder
+{
+public:
+	/** Frame the decoder holds, INDEX_NONE before the first keyframe. */
+	int32 GetFrameIndex() const { return FrameIndex; }
+
+	const TArray<FGaussianSplattingPoint>& GetPoints() const { return Points; }
+
+	/** Applies an encoded frame, which must be a keyframe or the delta following the current frame. */
+	bool DecodeFrame(int32 InFrameIndex, TConstArrayView<uint8> Payload);
+
+	void Pack(FGaussianSplattingSequenceFrame& OutFrame) const;
+
+	void Reset();
+
+private:
+	int32 FrameIndex = INDEX_NONE;
+
+	TArray<FGaussianSplattingPoint> Points;
+};
+
+/**
+ * Volumetric video made of static frames, stored as SPZ packed keyframes followed by deltas that remove, move and add splats.
+ * Every frame is a separate bulk data payload, so only the frames around the playback position need to be resident.
+ * See UGaussianSplattingPlaybackComponent for playback.
+ */
+UCLASS(BlueprintType)
+class GAUSSIANSPLATTINGRUNTIME_API UGaussianSplattingSequence : public UObject
+{
+	GENERATED_BODY()
+public:
+	int32 GetNumFrames() const { return FrameInfos.Num(); }
+
+	float GetFrameRate() const { return FrameRate; }
+
+	void SetFrameRate(float InFrameRate) { FrameRate = FMath::Max(InFrameRate, 1.0f); }
+
+	int32 GetKeyframeInterval() const { return KeyframeInterval; }
+
+	void SetKeyframeInterval(int32 InKeyframeInterval) { KeyframeInterval = FMath::Max(InKeyframeInterval, 1); }
+
+	/** Length of the sequence in seconds, each frame lasts 1 / FrameRate. */
+	float GetDuration() const;
+
+	/** Frame shown at a time in [0, GetDuration()]. */
+	int32 GetFrameAtTime(float Time) const;
+
+	/** Last keyframe at or before FrameIndex, decoding has to start there. */
+	int32 GetKeyframeIndex(int32 FrameIndex) const;
+
+	const FGaussianSplattingSequenceFrameInfo& GetFrameInfo(int32 FrameIndex) const { return FrameInfos[FrameIndex]; }
+
+	/** Size of the encoded frame in bytes. */
+	int64 GetFramePayloadSize(int32 FrameIndex) const;
+
+	/**
+	 * Reads an encoded frame, right away when the payload is resident and through an asynchronous request otherwise.
+	 * OnRead receives the payload, empty on failure, on any thread. The returned request, if any, must be completed and deleted once OnRead ran.
+	 */
+	class IBulkDataIORequest* ReadFramePayload(int32 FrameIndex, TFunction<void(TArray<uint8>&&)> OnRead) const;
+
+private:
+	friend class FGaussianSplattingSequenceBuilder;
+
+	void Serialize(FArchive& Ar) override;
+
+	void AddFrame(const FGaussianSplattingSequenceFrameInfo& Info, const TArray<uint8>& Payload);
+
+	UPROPERTY(EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 1))
+	float FrameRate = 30.0f;
+
+	/** Frames between forced keyframes, which bounds how far back seeking has to decode. Deltas that change most splats become keyframes anyway. */
+	UPROPERTY(EditAnywhere, Category = "Gaussian Splatting", meta = (ClampMin = 1))
+	int32 KeyframeInterval = 30;
+
+	TArray<FGaussianSplattingSequenceFrameInfo> FrameInfos;
+
+	TIndirectArray<FByteBulkData> FramePayloads;
+};
+
+/**
+ * Encodes frames into a sequence one at a time, so the source frames never need to be in memory all at once.
+ * A frame becomes a delta against the frame before it, unless a keyframe is due or the delta would replace most splats.
+ */
+class GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingSequenceBuilder
+{
+public:
+	/** Clears InSequence, which then receives the added frames. */
+	explicit FGaussianSplattingSequenceBuilder(UGaussianSplattingSequence* InSequence);
+
+	/**
+	 * Appends a frame. Ids optionally give every splat an identifier that is stable across frames,
+	 * without them the splats of consecutive frames correspond by index.
+	 */
+	bool AddFrame(const TArray<FGaussianSplattingPoint>& Points, TConstArrayView<uint32> Ids = {});
+
+	int32 GetNumKeyframes() const { return NumKeyframes; }
+
+	int64 GetKeyframeBytes() const { return KeyframeBytes; }
+
+	int64 GetDeltaBytes() const { return DeltaBytes; }
+
+private:
+	UGaussianSplattingSequence* Sequence = nullptr;
+
+	FGaussianSplattingSequenceDecoder Decoder;
+
+	/** Identifiers of the splats the decoder holds, in its order. */
+	TArray<uint32> DecodedIds;
+
+	int32 NumKeyframes = 0;
+
+	int64 KeyframeBytes = 0;
+
+	int64 DeltaBytes = 0;
+};
+
+/**
+ * Decodes the frames of a sequence ahead of playback on background tasks, keeping a small ring of decoded frames.
+ * Frames are decoded one at a time in order, reading each payload asynchronously first. Game thread only.
+ */
+class GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingSequenceStreamer : public TSharedFromThis<FGaussianSplattingSequenceStreamer>
+{
+public:
+	explicit FGaussianSplattingSequenceStreamer(UGaussianSplattingSequence* InSequence);
+
+	~FGaussianSplattingSequenceStreamer();
+
+	/** Keeps WantedFrames decoded, by decreasing priority, and releases every other frame. */
+	void Update(TConstArrayView<int32> InWantedFrames);
+
+	/** The decoded frame, null while it is not ready. */
+	TSharedPtr<const FGaussianSplattingSequenceFrame> GetFrame(int32 FrameIndex) const;
+
+	UGaussianSplattingSequence* GetSequence() const { return Sequence.Get(); }
+
+private:
+	void DecodeNext();
+
+	void OnFrameDecoded(int32 FrameIndex, TSharedPtr<FGaussianSplattingSequenceFrame> Frame, bool bSucceeded);
+
+	TWeakObjectPtr<UGaussianSplattingSequence> Sequence;
+
+	TArray<int32> WantedFrames;
+
+	TArray<TSharedPtr<const FGaussianSplattingSequenceFrame>> ReadyFrames;
+
+	/** Shared with the decode task in flight, which is the only one touching it until OnFrameDecoded. */
+	TSharedPtr<FGaussianSplattingSequenceDecoder> Decoder;
+
+	bool bDecoding = false;
+
+	/** Frames whose payload failed to decode, skipped instead of retried every update. */
+	TSet<int32> FailedFrames;
+
+	class IBulkDataIORequest* PendingRequest = nullptr;
+};
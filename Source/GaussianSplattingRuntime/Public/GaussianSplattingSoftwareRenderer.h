@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGaussianSplattingPoint;
+
+/** Pinhole camera of the software renderer, looking along the X axis of Rotation with Z up like engine cameras. */
+struct GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingRenderView
+{
+	FVector3f Location = FVector3f::ZeroVector;
+
+	FQuat4f Rotation = FQuat4f::Identity;
+
+	/** Horizontal field of view in degrees. */
+	float FieldOfView = 90.0f;
+
+	int32 Width = 256;
+
+	int32 Height = 256;
+
+	/** Focal lengths in pixels of cameras with known intrinsics, zero derives both from FieldOfView. */
+	FVector2f FocalLength = FVector2f::ZeroVector;
+
+	/** Pixel the optical axis goes through, zero is the center of the image. */
+	FVector2f PrincipalPoint = FVector2f::ZeroVector;
+
+	/** Playback time the motion and temporal visibility of 4D points are evaluated at, like the data interface does. */
+	float Time = 0.0f;
+
+	/** Splats closer than this to the camera plane are skipped. */
+	float NearPlane = 1.0f;
+
+	FLinearColor BackgroundColor = FLinearColor::Black;
+
+	static FGaussianSplattingRenderView LookAt(const FVector3f& Location, const FVector3f& Target, int32 Width, int32 Height, float FieldOfView = 90.0f);
+};
+
+/**
+ * Reference rasterizer running on the CPU, for machines without a GPU. Splats are projected with their 2D covariance,
+ * binned into screen tiles in depth order and alpha blended front to back per tile, four pixels at a time.
+ */
+namespace GaussianSplattingSoftwareRenderer
+{
+	constexpr int32 TileSize = 16;
+
+	struct FStats
+	{
+		int32 NumVisibleSplats = 0;
+
+		/** Splat and tile pairs, a splat overlapping several tiles is blended in each of them. */
+		int64 NumTileEntries = 0;
+
+		double ProjectSeconds = 0.0;
+		double BinSeconds = 0.0;
+		double RasterSeconds = 0.0;
+	};
+
+	/** Renders the points into Width * Height pixels, row by row from the top left, in the color space the points are stored in. */
+	GAUSSIANSPLATTINGRUNTIME_API void Render(TConstArrayView<FGaussianSplattingPoint> Points, const FGaussianSplattingRenderView& View, TArray<FLinearColor>& OutPixels, FStats* OutStats = nullptr);
+
+	/**
+	 * Rasterizes the points like Render and measures the blending weight of every point, its alpha times the transmittance
+	 * in front of it, in each pixel. Adds the sum over the pixels to InOutSumWeights and raises InOutMaxWeights to the
+	 * largest weight, so several views accumulate into the same arrays. Both hold one value per point.
+	 */
+	GAUSSIANSPLATTINGRUNTIME_API void AccumulateWeights(TConstArrayView<FGaussianSplattingPoint> Points, const FGaussianSplattingRenderView& View, TArrayView<float> InOutMaxWeights, TArrayView<float> InOutSumWeights, FStats* OutStats = nullptr);
+
+	/** Peak signal to noise ratio in decibels between two images of the same size, over RGB clamped to [0, 1]. Identical images give UE_MAX_FLT. */
+	GAUSSIANSPLATTINGRUNTIME_API float ComputePSNR(TConstArrayView<FLinearColor> Image, TConstArrayView<FLinearColor> Reference);
+}
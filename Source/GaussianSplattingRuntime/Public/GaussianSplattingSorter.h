@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace GaussianSplattingSort
+{
+	/** Maps a float to a key whose unsigned integer order matches the float order. */
+	FORCEINLINE uint32 FloatToSortableKey(float Value)
+	{
+		const uint32 Bits = *reinterpret_cast<const uint32*>(&Value);
+		return Bits ^ ((Bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u);
+	}
+
+	/**
+	 * Stable LSD radix sort of Values by ascending Keys, both arrays are permuted in place.
+	 * Large inputs are split into blocks that build their digit histograms and scatter in parallel on the task graph.
+	 */
+	GAUSSIANSPLATTINGRUNTIME_API void RadixSort(TArrayView<uint32> Keys, TArrayView<uint32> Values);
+}
+
+/**
+ * Sorts point indices back to front by depth, keeping the previous order around so that small camera moves only need a repair.
+ * When the previous order is still almost sorted for the new depths, a bounded insertion pass fixes it up, otherwise
+ * the sorter falls back to a full parallel radix sort.
+ */
+class GAUSSIANSPLATTINGRUNTIME_API FGaussianSplattingDepthSorter
+{
+public:
+	/** Sorts the indices [0, Depths.Num()) by descending depth. */
+	void Sort(TConstArrayView<float> Depths, bool bAllowIncremental = true);
+
+	void Reset();
+
+	/** Indices into the depths of the last call, farthest first. */
+	TConstArrayView<uint32> GetOrder() const { return Order; }
+
+	/** Whether the last call repaired the previous order instead of sorting from scratch. */
+	bool WasIncremental() const { return bWasIncremental; }
+
+	/** Element moves the insertion repair may spend, relative to the number of keys, before giving up and sorting from scratch. */
+	float MaxRepairMovesPerKey = 4.0f;
+
+private:
+	bool TryRepair(TConstArrayView<float> Depths);
+
+	TArray<uint32> Order;
+
+	TArray<uint32> Keys;
+
+	bool bWasIncremental = false;
+};